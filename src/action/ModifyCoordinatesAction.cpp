@@ -26,32 +26,29 @@ void ModifyCoordinatesAction::performAction(
     double fullDt)
 {
   TRACE();
-  auto &          values = _data->values();
-  int             dim    = getMesh()->getDimensions();
-  Eigen::VectorXd data(dim);
+  auto &           values = _data->values();
+  int              dim    = getMesh()->getDimensions();
+  std::vector<int> movedIDs;
+  Eigen::MatrixXd  coords(dim, getMesh()->vertices().size());
+  double           sign;
   if (_mode == ADD_TO_COORDINATES_MODE) {
     DEBUG("Adding data to coordinates");
-    for (mesh::Vertex &vertex : getMesh()->vertices()) {
-      for (int i = 0; i < dim; i++) {
-        data[i] = values[vertex.getID() * dim + i];
-      }
-      data += vertex.getCoords();
-      vertex.setCoords(data);
-    }
+    sign = 1.0;
   } else if (_mode == SUBTRACT_FROM_COORDINATES_MODE) {
     DEBUG("Subtracting data from coordinates");
-    for (mesh::Vertex &vertex : getMesh()->vertices()) {
-      data = vertex.getCoords();
-      for (int i = 0; i < dim; i++) {
-        data[i] -= values[vertex.getID() * dim + i];
-      }
-      vertex.setCoords(data);
-    }
+    sign = -1.0;
   } else {
     ERROR("Unknown mode type!");
   }
-  getMesh()->computeState();
-  getMesh()->meshChanged(*getMesh());
+  // Only vertices with non-zero displacement are moved, to limit the update of the mesh state
+  for (mesh::Vertex &vertex : getMesh()->vertices()) {
+    auto displacement = values.segment(vertex.getID() * dim, dim);
+    if (displacement.isZero(0.0))
+      continue;
+    coords.col(movedIDs.size()) = vertex.getCoords() + sign * displacement;
+    movedIDs.push_back(vertex.getID());
+  }
+  getMesh()->moveVertices(movedIDs, coords.leftCols(movedIDs.size()));
 }
 
 } // namespace action
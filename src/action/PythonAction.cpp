@@ -37,6 +37,10 @@ PythonAction::~PythonAction()
   if (_module != nullptr) {
     assertion(_moduleNameObject != nullptr);
     assertion(_module != nullptr);
+    Py_XDECREF(_performAction);
+    Py_XDECREF(_vertexCallback);
+    Py_XDECREF(_vertexCallbackBlock);
+    Py_XDECREF(_postAction);
     Py_DECREF(_moduleNameObject);
     Py_DECREF(_module);
     Py_Finalize();
@@ -85,33 +89,10 @@ void PythonAction::performAction(double time,
     }
   }
 
-  if (_vertexCallback != nullptr) {
-    PyObject *      vertexArgs = PyTuple_New(3);
-    mesh::PtrMesh   mesh       = getMesh();
-    Eigen::VectorXd coords(mesh->getDimensions());
-    Eigen::VectorXd normal(mesh->getDimensions());
-    for (mesh::Vertex &vertex : mesh->vertices()) {
-      npy_intp vdim[]        = {mesh->getDimensions()};
-      int      id            = vertex.getID();
-      coords                 = vertex.getCoords();
-      normal                 = vertex.getNormal();
-      PyObject *pythonID     = PyInt_FromLong(id);
-      PyObject *pythonCoords = PyArray_SimpleNewFromData(1, vdim, NPY_DOUBLE, coords.data());
-      PyObject *pythonNormal = PyArray_SimpleNewFromData(1, vdim, NPY_DOUBLE, coords.data());
-      CHECK(pythonID != nullptr, "Creating python ID failed!");
-      CHECK(pythonCoords != nullptr, "Creating python coords failed!");
-      CHECK(pythonNormal != nullptr, "Creating python normal failed!");
-      PyTuple_SetItem(vertexArgs, 0, pythonID);
-      PyTuple_SetItem(vertexArgs, 1, pythonCoords);
-      PyTuple_SetItem(vertexArgs, 2, pythonNormal);
-      PyObject_CallObject(_vertexCallback, vertexArgs);
-      if (PyErr_Occurred()) {
-        PyErr_Print();
-        ERROR("Error occurred during call of function "
-              << "vertexCallback() python module \"" << _moduleName << "\"!");
-      }
-    }
-    Py_DECREF(vertexArgs);
+  if (_vertexCallbackBlock != nullptr) {
+    performBlockCallback();
+  } else if (_vertexCallback != nullptr) {
+    performVertexCallbacks();
   }
 
   if (_postAction != nullptr) {
@@ -128,6 +109,83 @@ void PythonAction::performAction(double time,
   Py_DECREF(dataArgs);
 }
 
+void PythonAction::performBlockCallback()
+{
+  mesh::PtrMesh mesh       = getMesh();
+  int           dimensions = mesh->getDimensions();
+  int           size       = mesh->vertices().size();
+
+  // Vertices are not stored contiguously, hence coordinates and normals are gathered
+  // into persistent buffers which are only reallocated if the mesh size changes.
+  _coords.resize(size, dimensions);
+  _normals.resize(size, dimensions);
+  for (const mesh::Vertex &vertex : mesh->vertices()) {
+    _coords.row(vertex.getID())  = vertex.getCoords();
+    _normals.row(vertex.getID()) = vertex.getNormal();
+  }
+
+  PyObject *blockArgs = PyTuple_New(_numberArguments);
+  PyTuple_SetItem(blockArgs, 0, createArrayView(_coords.data(), size, dimensions, false));
+  PyTuple_SetItem(blockArgs, 1, createArrayView(_normals.data(), size, dimensions, false));
+  int argumentIndex = 2;
+  if (_sourceData.use_count() > 0) {
+    PyTuple_SetItem(blockArgs, argumentIndex, createArrayView(_sourceData->values().data(), size,
+                                                              _sourceData->getDimensions(), true));
+    argumentIndex++;
+  }
+  if (_targetData.use_count() > 0) {
+    PyTuple_SetItem(blockArgs, argumentIndex, createArrayView(_targetData->values().data(), size,
+                                                              _targetData->getDimensions(), true));
+  }
+  PyObject_CallObject(_vertexCallbackBlock, blockArgs);
+  if (PyErr_Occurred()) {
+    PyErr_Print();
+    ERROR("Error occurred during call of function "
+          << "vertexCallbackBlock() python module \"" << _moduleName << "\"!");
+  }
+  Py_DECREF(blockArgs);
+}
+
+void PythonAction::performVertexCallbacks()
+{
+  PyObject *      vertexArgs = PyTuple_New(3);
+  mesh::PtrMesh   mesh       = getMesh();
+  npy_intp        vdim[]     = {mesh->getDimensions()};
+  Eigen::VectorXd coords(mesh->getDimensions());
+  Eigen::VectorXd normal(mesh->getDimensions());
+  for (mesh::Vertex &vertex : mesh->vertices()) {
+    coords                 = vertex.getCoords();
+    normal                 = vertex.getNormal();
+    PyObject *pythonID     = PyInt_FromLong(vertex.getID());
+    PyObject *pythonCoords = PyArray_SimpleNewFromData(1, vdim, NPY_DOUBLE, coords.data());
+    PyObject *pythonNormal = PyArray_SimpleNewFromData(1, vdim, NPY_DOUBLE, normal.data());
+    CHECK(pythonID != nullptr, "Creating python ID failed!");
+    CHECK(pythonCoords != nullptr, "Creating python coords failed!");
+    CHECK(pythonNormal != nullptr, "Creating python normal failed!");
+    PyTuple_SetItem(vertexArgs, 0, pythonID);
+    PyTuple_SetItem(vertexArgs, 1, pythonCoords);
+    PyTuple_SetItem(vertexArgs, 2, pythonNormal);
+    PyObject_CallObject(_vertexCallback, vertexArgs);
+    if (PyErr_Occurred()) {
+      PyErr_Print();
+      ERROR("Error occurred during call of function "
+            << "vertexCallback() python module \"" << _moduleName << "\"!");
+    }
+  }
+  Py_DECREF(vertexArgs);
+}
+
+PyObject *PythonAction::createArrayView(double *values, int rows, int cols, bool writeable)
+{
+  npy_intp  dims[] = {rows, cols};
+  PyObject *array  = PyArray_SimpleNewFromData(2, dims, NPY_DOUBLE, values);
+  CHECK(array != nullptr, "Creating python array failed!");
+  if (not writeable) {
+    PyArray_CLEARFLAGS(reinterpret_cast<PyArrayObject *>(array), NPY_ARRAY_WRITEABLE);
+  }
+  return array;
+}
+
 void PythonAction::initialize()
 {
   assertion(not _isInitialized);
@@ -157,11 +215,21 @@ void PythonAction::initialize()
   //  if (not valid){
   //  }
 
+  // Construct method vertexCallbackBlock, which takes precedence over vertexCallback
+  _vertexCallbackBlock = PyObject_GetAttrString(_module, "vertexCallbackBlock");
+  if (PyErr_Occurred()) {
+    PyErr_Clear();
+    _vertexCallbackBlock = nullptr;
+  }
+
   // Construct method vertexCallback
   _vertexCallback = PyObject_GetAttrString(_module, "vertexCallback");
   if (PyErr_Occurred()) {
     PyErr_Clear();
-    WARN("No function void vertexCallback() in python module \"" << _moduleName << "\" found.");
+    if (_vertexCallbackBlock == nullptr) {
+      WARN("No function void vertexCallback() or vertexCallbackBlock() in python module \""
+           << _moduleName << "\" found.");
+    }
     _vertexCallback = nullptr;
   }
 
@@ -172,6 +240,8 @@ void PythonAction::initialize()
     WARN("No function void postAction() in python module \"" << _moduleName << "\" found.");
     _postAction = nullptr;
   }
+
+  _isInitialized = true;
 }
 
 int PythonAction::makeNumPyArraysAvailable()
@@ -4,6 +4,7 @@
 #include "action/Action.hpp"
 #include "mesh/SharedPointer.hpp"
 #include "logging/Logger.hpp"
+#include <Eigen/Core>
 #include <string>
 
 struct _object;
@@ -14,7 +15,13 @@ namespace precice
 namespace action
 {
 
-/// Action whose implementation is given in a Python file.
+/**
+ * @brief Action whose implementation is given in a Python file.
+ *
+ * If the module defines vertexCallbackBlock(), it is called once per action with the coordinates
+ * and normals of all vertices as (N x dim) arrays and the source/target data as (N x dataDim) arrays.
+ * Otherwise, vertexCallback() is called once per vertex.
+ */
 class PythonAction : public Action
 {
 public:
@@ -61,10 +68,29 @@ private:
 
   PyObject *_vertexCallback = nullptr;
 
+  PyObject *_vertexCallbackBlock = nullptr;
+
   PyObject *_postAction = nullptr; 
 
+  using RowMatrix = Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+
+  /// Contiguous copy of all vertex coordinates, handed to vertexCallbackBlock().
+  RowMatrix _coords;
+
+  /// Contiguous copy of all vertex normals, handed to vertexCallbackBlock().
+  RowMatrix _normals;
+
   void initialize();
 
+  /// Calls vertexCallbackBlock() once for the whole mesh.
+  void performBlockCallback();
+
+  /// Calls vertexCallback() for every vertex of the mesh.
+  void performVertexCallbacks();
+
+  /// Returns a (rows x cols) NumPy array sharing the memory at values.
+  PyObject *createArrayView(double *values, int rows, int cols, bool writeable);
+
   int makeNumPyArraysAvailable();
 };
 
@@ -26,6 +26,17 @@ def vertexCallback(id, coords, normal):
     global myTargetData
     # myTargetData[id] += coords[0] + mySourceData[id] # Add data to vertex coords
     
+def vertexCallbackBlock(coords, normals, sourceData, targetData):
+    '''This function is called once for all vertices of the configured mesh, instead of
+    vertexCallback, if it is defined. It is called after performAction, and can also be omitted.
+    Coordinates and normals are read-only arrays of shape (number of vertices, dimensions).
+    Source and target data are arrays of shape (number of vertices, data dimensions), which
+    share memory with the data of the mesh, and are omitted like in performAction.'''
+
+    # Usage example:
+    # targetData[:,0] += coords[:,0] + sourceData[:,0]
+    pass
+
 def postAction():
     '''This function is called at last, if not omitted.'''
     
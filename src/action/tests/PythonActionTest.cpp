@@ -33,6 +33,24 @@ BOOST_AUTO_TEST_CASE(AllMethods)
   BOOST_TEST(testing::equals(mesh->data(targetID)->values(), result));
 }
 
+BOOST_AUTO_TEST_CASE(BlockCallback)
+{
+  mesh::PtrMesh mesh(new mesh::Mesh("Mesh", 3, false));
+  mesh->createVertex(Eigen::Vector3d::Constant(1.0));
+  mesh->createVertex(Eigen::Vector3d::Constant(2.0));
+  mesh->createVertex(Eigen::Vector3d::Constant(3.0));
+  int targetID = mesh->createData("TargetData", 1)->getID();
+  int sourceID = mesh->createData("SourceData", 1)->getID();
+  mesh->allocateDataValues();
+  std::string  path = testing::getPathToSources() + "/action/tests/";
+  PythonAction action(PythonAction::ALWAYS_PRIOR, path, "TestBlockAction", mesh, targetID, sourceID);
+  mesh->data(sourceID)->values() << 0.1, 0.2, 0.3;
+  mesh->data(targetID)->values() = Eigen::VectorXd::Zero(mesh->data(targetID)->values().size());
+  action.performAction(0.0, 0.0, 0.0, 0.0);
+  Eigen::Vector3d result(2.1, 3.2, 4.3);
+  BOOST_TEST(testing::equals(mesh->data(targetID)->values(), result));
+}
+
 BOOST_AUTO_TEST_CASE(OmitMethods)
 {
   std::string path = testing::getPathToSources() + "/action/tests/";
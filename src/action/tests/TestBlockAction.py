@@ -0,0 +1,12 @@
+def performAction(time, dt, sourceData, targetData):
+    for i in range(targetData.size):
+        targetData[i] = sourceData[i] + 1
+
+def vertexCallback(id, coords, normal):
+    raise RuntimeError("vertexCallback must not be called if vertexCallbackBlock is defined")
+
+def vertexCallbackBlock(coords, normals, sourceData, targetData):
+    targetData[:,0] += coords[:,0]
+
+def postAction():
+    pass
@@ -1,10 +1,11 @@
 #include "CommunicateMesh.hpp"
-#include <map>
+#include <algorithm>
 #include <vector>
 #include "Communication.hpp"
 #include "com/SharedPointer.hpp"
 #include "mesh/Edge.hpp"
 #include "mesh/Mesh.hpp"
+#include "mesh/Quad.hpp"
 #include "mesh/Triangle.hpp"
 #include "mesh/Vertex.hpp"
 
@@ -12,6 +13,40 @@ namespace precice
 {
 namespace com
 {
+namespace
+{
+/// Version of the packed mesh format, to be increased on every change of the format.
+const int FORMAT_VERSION = 1;
+
+/// Positions of the entries of the header of the packed mesh.
+enum Header {
+  VERSION = 0,
+  DIMENSIONS,
+  VERTICES,
+  EDGES,
+  TRIANGLES,
+  QUADS,
+  HEADER_SIZE
+};
+
+/// Returns a dense table from element IDs to positions in the given container.
+template <typename CONTAINER_T>
+std::vector<int> createPositions(const CONTAINER_T &elements)
+{
+  int maxID = -1;
+  for (const auto &element : elements) {
+    maxID = std::max(maxID, element.getID());
+  }
+  std::vector<int> positions(maxID + 1, -1);
+  int              position = 0;
+  for (const auto &element : elements) {
+    assertion(element.getID() >= 0, element.getID());
+    positions[element.getID()] = position++;
+  }
+  return positions;
+}
+} // namespace
+
 CommunicateMesh::CommunicateMesh(
     com::PtrCommunication communication)
     : _communication(communication)
@@ -23,62 +58,12 @@ void CommunicateMesh::sendMesh(
     int               rankReceiver)
 {
   TRACE(mesh.getName(), rankReceiver);
-  int dim = mesh.getDimensions();
-
-  int numberOfVertices = mesh.vertices().size();
-  _communication->send(numberOfVertices, rankReceiver);
-  if (not mesh.vertices().empty()) {
-    std::vector<double> coords(numberOfVertices * dim);
-    std::vector<int> globalIDs(numberOfVertices);
-    for (int i = 0; i < numberOfVertices; i++) {
-      for (int d = 0; d < dim; d++) {
-        coords[i * dim + d] = mesh.vertices()[i].getCoords()[d];
-      }
-      globalIDs[i] = mesh.vertices()[i].getGlobalIndex();
-    }
+  std::vector<int>    content;
+  std::vector<double> coords;
+  packMesh(mesh, content, coords);
+  _communication->send(content, rankReceiver);
+  if (not coords.empty()) {
     _communication->send(coords, rankReceiver);
-    _communication->send(globalIDs, rankReceiver);
-  }
-
-  int numberOfEdges = mesh.edges().size();
-  _communication->send(numberOfEdges, rankReceiver);
-  if (not mesh.edges().empty()) {
-    //we need to send the vertexIDs first such that the right edges can be created later
-    //contrary to the normal sendMesh, this variant must also work for adding delta meshes
-    std::vector<int> vertexIDs(numberOfVertices);
-    for (int i = 0; i < numberOfVertices; i++) {
-      vertexIDs[i] = mesh.vertices()[i].getID();
-    }
-    _communication->send(vertexIDs, rankReceiver);
-
-    std::vector<int> edgeIDs(numberOfEdges * 2);
-    for (int i = 0; i < numberOfEdges; i++) {
-      edgeIDs[i * 2]     = mesh.edges()[i].vertex(0).getID();
-      edgeIDs[i * 2 + 1] = mesh.edges()[i].vertex(1).getID();
-    }
-    _communication->send(edgeIDs, rankReceiver);
-  }
-
-  if (dim == 3) {
-    int numberOfTriangles = mesh.triangles().size();
-    _communication->send(numberOfTriangles, rankReceiver);
-    if (not mesh.triangles().empty()) {
-      //we need to send the edgeIDs first such that the right edges can be created later
-      //contrary to the normal sendMesh, this variant must also work for adding delta meshes
-      std::vector<int> edgeIDs(numberOfEdges);
-      for (int i = 0; i < numberOfEdges; i++) {
-        edgeIDs[i] = mesh.edges()[i].getID();
-      }
-      _communication->send(edgeIDs, rankReceiver);
-
-      std::vector<int> triangleIDs(numberOfTriangles * 3);
-      for (int i = 0; i < numberOfTriangles; i++) {
-        triangleIDs[i * 3]     = mesh.triangles()[i].edge(0).getID();
-        triangleIDs[i * 3 + 1] = mesh.triangles()[i].edge(1).getID();
-        triangleIDs[i * 3 + 2] = mesh.triangles()[i].edge(2).getID();
-      }
-      _communication->send(triangleIDs, rankReceiver);
-    }
   }
 }
 
@@ -87,142 +72,25 @@ void CommunicateMesh::receiveMesh(
     int         rankSender)
 {
   TRACE(mesh.getName(), rankSender);
-  int dim = mesh.getDimensions();
-
-  std::vector<mesh::Vertex *>   vertices;
-  std::map<int, mesh::Vertex *> vertexMap;
-  int                           numberOfVertices = 0;
-  _communication->receive(numberOfVertices, rankSender);
-  DEBUG("Number of vertices to receive: " << numberOfVertices);
-
-  if (numberOfVertices > 0) {
-    std::vector<double> vertexCoords;
-    std::vector<int> globalIDs;
-    _communication->receive(vertexCoords, rankSender);
-    _communication->receive(globalIDs, rankSender);
-    for (int i = 0; i < numberOfVertices; i++) {
-      Eigen::VectorXd coords(dim);
-      for (int d = 0; d < dim; d++) {
-        coords[d] = vertexCoords[i * dim + d];
-      }
-      mesh::Vertex &v = mesh.createVertex(coords);
-      assertion(v.getID() >= 0, v.getID());
-      v.setGlobalIndex(globalIDs[i]);
-      vertices.push_back(&v);
-    }
-  }
-
-  int                       numberOfEdges = 0;
-  std::vector<mesh::Edge *> edges;
-  _communication->receive(numberOfEdges, rankSender);
-  DEBUG("Number of edges to receive: " << numberOfEdges);
-  if (numberOfEdges > 0) {
-    std::vector<int> vertexIDs;
-    _communication->receive(vertexIDs, rankSender);
-    for (int i = 0; i < numberOfVertices; i++) {
-      vertexMap[vertexIDs[i]] = vertices[i];
-    }
-
-    std::vector<int> edgeIDs;
-    _communication->receive(edgeIDs, rankSender);
-    for (int i = 0; i < numberOfEdges; i++) {
-      assertion(vertexMap.find(edgeIDs[i * 2]) != vertexMap.end());
-      assertion(vertexMap.find(edgeIDs[i * 2 + 1]) != vertexMap.end());
-      assertion(edgeIDs[i * 2] != edgeIDs[i * 2 + 1]);
-      mesh::Edge &e = mesh.createEdge(*vertexMap[edgeIDs[i * 2]], *vertexMap[edgeIDs[i * 2 + 1]]);
-      edges.push_back(&e);
-    }
-  }
-
-  if (dim == 3) {
-    int numberOfTriangles = 0;
-    _communication->receive(numberOfTriangles, rankSender);
-    DEBUG("Number of Triangles to receive: " << numberOfTriangles);
-    DEBUG("Number of Edges: " << edges.size());
-    if (numberOfTriangles > 0) {
-      assertion((edges.size() > 0) || (numberOfTriangles == 0));
-      std::vector<int> edgeIDs;
-      _communication->receive(edgeIDs, rankSender);
-      std::map<int, mesh::Edge *> edgeMap;
-      for (int i = 0; i < numberOfEdges; i++) {
-        edgeMap[edgeIDs[i]] = edges[i];
-      }
-
-      std::vector<int> triangleIDs;
-      _communication->receive(triangleIDs, rankSender);
-
-      for (int i = 0; i < numberOfTriangles; i++) {
-        assertion(edgeMap.find(triangleIDs[i * 3]) != edgeMap.end());
-        assertion(edgeMap.find(triangleIDs[i * 3 + 1]) != edgeMap.end());
-        assertion(edgeMap.find(triangleIDs[i * 3 + 2]) != edgeMap.end());
-        assertion(triangleIDs[i * 3] != triangleIDs[i * 3 + 1]);
-        assertion(triangleIDs[i * 3 + 1] != triangleIDs[i * 3 + 2]);
-        assertion(triangleIDs[i * 3 + 2] != triangleIDs[i * 3]);
-        mesh.createTriangle(*edgeMap[triangleIDs[i * 3]], *edgeMap[triangleIDs[i * 3 + 1]], *edgeMap[triangleIDs[i * 3 + 2]]);
-      }
-    }
+  std::vector<int>    content;
+  std::vector<double> coords;
+  _communication->receive(content, rankSender);
+  assertion(content.size() >= HEADER_SIZE, content.size());
+  if (content[VERTICES] > 0) {
+    _communication->receive(coords, rankSender);
   }
+  unpackMesh(mesh, content, coords);
 }
 
 void CommunicateMesh::broadcastSendMesh(const mesh::Mesh &mesh)
 {
   TRACE(mesh.getName());
-  int dim = mesh.getDimensions();
-
-  int numberOfVertices = mesh.vertices().size();
-  _communication->broadcast(numberOfVertices);
-  if (numberOfVertices > 0) {
-    std::vector<double> coords(numberOfVertices * dim);
-    std::vector<int> globalIDs(numberOfVertices);
-    for (int i = 0; i < numberOfVertices; i++) {
-      for (int d = 0; d < dim; d++) {
-        coords[i * dim + d] = mesh.vertices()[i].getCoords()[d];
-      }
-      globalIDs[i] = mesh.vertices()[i].getGlobalIndex();
-    }
+  std::vector<int>    content;
+  std::vector<double> coords;
+  packMesh(mesh, content, coords);
+  _communication->broadcast(content);
+  if (not coords.empty()) {
     _communication->broadcast(coords);
-    _communication->broadcast(globalIDs);
-  }
-
-  int numberOfEdges = mesh.edges().size();
-  _communication->broadcast(numberOfEdges);
-  if (numberOfEdges > 0) {
-    //we need to send the vertexIDs first such that the right edges can be created later
-    //contrary to the normal sendMesh, this variant must also work for adding delta meshes
-    std::vector<int> vertexIDs(numberOfVertices);
-    for (int i = 0; i < numberOfVertices; i++) {
-      vertexIDs[i] = mesh.vertices()[i].getID();
-    }
-    _communication->broadcast(vertexIDs);
-
-    std::vector<int> edgeIDs(numberOfEdges * 2);
-    for (int i = 0; i < numberOfEdges; i++) {
-      edgeIDs[i * 2]     = mesh.edges()[i].vertex(0).getID();
-      edgeIDs[i * 2 + 1] = mesh.edges()[i].vertex(1).getID();
-    }
-    _communication->broadcast(edgeIDs);
-  }
-
-  if (dim == 3) {
-    int numberOfTriangles = mesh.triangles().size();
-    _communication->broadcast(numberOfTriangles);
-    if (numberOfTriangles > 0) {
-      //we need to send the edgeIDs first such that the right edges can be created later
-      //contrary to the normal sendMesh, this variant must also work for adding delta meshes
-      std::vector<int> edgeIDs(numberOfEdges);
-      for (int i = 0; i < numberOfEdges; i++) {
-        edgeIDs[i] = mesh.edges()[i].getID();
-      }
-      _communication->broadcast(edgeIDs);
-
-      std::vector<int> triangleIDs(numberOfTriangles * 3);
-      for (int i = 0; i < numberOfTriangles; i++) {
-        triangleIDs[i * 3]     = mesh.triangles()[i].edge(0).getID();
-        triangleIDs[i * 3 + 1] = mesh.triangles()[i].edge(1).getID();
-        triangleIDs[i * 3 + 2] = mesh.triangles()[i].edge(2).getID();
-      }
-      _communication->broadcast(triangleIDs);
-    }
   }
 }
 
@@ -230,77 +98,117 @@ void CommunicateMesh::broadcastReceiveMesh(
     mesh::Mesh &mesh)
 {
   TRACE(mesh.getName());
-  int dim             = mesh.getDimensions();
   int rankBroadcaster = 0;
+  std::vector<int>    content;
+  std::vector<double> coords;
+  _communication->broadcast(content, rankBroadcaster);
+  assertion(content.size() >= HEADER_SIZE, content.size());
+  if (content[VERTICES] > 0) {
+    _communication->broadcast(coords, rankBroadcaster);
+  }
+  unpackMesh(mesh, content, coords);
+}
 
-  std::vector<mesh::Vertex *>   vertices;
-  std::map<int, mesh::Vertex *> vertexMap;
-  int                           numberOfVertices = 0;
-  _communication->broadcast(numberOfVertices, rankBroadcaster);
+void CommunicateMesh::packMesh(
+    const mesh::Mesh &   mesh,
+    std::vector<int> &   content,
+    std::vector<double> &coords) const
+{
+  int dim               = mesh.getDimensions();
+  int numberOfVertices  = mesh.vertices().size();
+  int numberOfEdges     = mesh.edges().size();
+  int numberOfTriangles = mesh.triangles().size();
+  int numberOfQuads     = mesh.quads().size();
+
+  content.clear();
+  content.reserve(HEADER_SIZE + numberOfVertices + 2 * numberOfEdges + 3 * numberOfTriangles + 4 * numberOfQuads);
+  content.insert(content.end(), {FORMAT_VERSION, dim, numberOfVertices, numberOfEdges, numberOfTriangles, numberOfQuads});
+  assertion(content.size() == HEADER_SIZE);
+
+  coords.resize(numberOfVertices * dim);
+  for (int i = 0; i < numberOfVertices; i++) {
+    const mesh::Vertex &vertex = mesh.vertices()[i];
+    for (int d = 0; d < dim; d++) {
+      coords[i * dim + d] = vertex.getCoords()[d];
+    }
+    content.push_back(vertex.getGlobalIndex());
+  }
 
-  if (numberOfVertices > 0) {
-    std::vector<double> vertexCoords;
-    std::vector<int> globalIDs;
-    _communication->broadcast(vertexCoords, rankBroadcaster);
-    _communication->broadcast(globalIDs, rankBroadcaster);
-    for (int i = 0; i < numberOfVertices; i++) {
-      Eigen::VectorXd coords(dim);
-      for (int d = 0; d < dim; d++) {
-        coords[d] = vertexCoords[i * dim + d];
-      }
-      mesh::Vertex &v = mesh.createVertex(coords);
-      assertion(v.getID() >= 0, v.getID());
-      v.setGlobalIndex(globalIDs[i]);
-      vertices.push_back(&v);
-    }
+  // Connectivity refers to positions in the sent containers, such that the receiver
+  // does not need to know the IDs of the sender
+  std::vector<int> vertexPositions = createPositions(mesh.vertices());
+  for (const mesh::Edge &edge : mesh.edges()) {
+    content.push_back(vertexPositions[edge.vertex(0).getID()]);
+    content.push_back(vertexPositions[edge.vertex(1).getID()]);
   }
 
-  int                       numberOfEdges = 0;
-  std::vector<mesh::Edge *> edges;
-  _communication->broadcast(numberOfEdges, rankBroadcaster);
-  if (numberOfEdges > 0) {
-    std::vector<int> vertexIDs;
-    _communication->broadcast(vertexIDs, rankBroadcaster);
-    for (int i = 0; i < numberOfVertices; i++) {
-      vertexMap[vertexIDs[i]] = vertices[i];
+  std::vector<int> edgePositions = createPositions(mesh.edges());
+  for (const mesh::Triangle &triangle : mesh.triangles()) {
+    for (int i = 0; i < 3; i++) {
+      content.push_back(edgePositions[triangle.edge(i).getID()]);
     }
-
-    std::vector<int> edgeIDs;
-    _communication->broadcast(edgeIDs, rankBroadcaster);
-    for (int i = 0; i < numberOfEdges; i++) {
-      assertion(vertexMap.find(edgeIDs[i * 2]) != vertexMap.end());
-      assertion(vertexMap.find(edgeIDs[i * 2 + 1]) != vertexMap.end());
-      assertion(edgeIDs[i * 2] != edgeIDs[i * 2 + 1]);
-      mesh::Edge &e = mesh.createEdge(*vertexMap[edgeIDs[i * 2]], *vertexMap[edgeIDs[i * 2 + 1]]);
-      edges.push_back(&e);
+  }
+  for (const mesh::Quad &quad : mesh.quads()) {
+    for (int i = 0; i < 4; i++) {
+      content.push_back(edgePositions[quad.edge(i).getID()]);
     }
   }
+}
 
-  if (dim == 3) {
-    int numberOfTriangles = 0;
-    _communication->broadcast(numberOfTriangles, rankBroadcaster);
-    if (numberOfTriangles > 0) {
-      assertion((edges.size() > 0) || (numberOfTriangles == 0));
-      std::vector<int> edgeIDs;
-      _communication->broadcast(edgeIDs, rankBroadcaster);
-      std::map<int, mesh::Edge *> edgeMap;
-      for (int i = 0; i < numberOfEdges; i++) {
-        edgeMap[edgeIDs[i]] = edges[i];
-      }
+void CommunicateMesh::unpackMesh(
+    mesh::Mesh &               mesh,
+    const std::vector<int> &   content,
+    const std::vector<double> &coords)
+{
+  CHECK(content[VERSION] == FORMAT_VERSION,
+        "Received mesh \"" << mesh.getName() << "\" has format version " << content[VERSION]
+        << ", expected version " << FORMAT_VERSION << ". Are both participants using the same preCICE version?");
+  int dim               = mesh.getDimensions();
+  int numberOfVertices  = content[VERTICES];
+  int numberOfEdges     = content[EDGES];
+  int numberOfTriangles = content[TRIANGLES];
+  int numberOfQuads     = content[QUADS];
+  assertion(content[DIMENSIONS] == dim, content[DIMENSIONS], dim);
+  assertion(static_cast<int>(coords.size()) == numberOfVertices * dim, coords.size(), numberOfVertices);
+  assertion(content.size() == static_cast<size_t>(HEADER_SIZE + numberOfVertices + 2 * numberOfEdges +
+                                                 3 * numberOfTriangles + 4 * numberOfQuads),
+            content.size());
+  DEBUG("Received " << numberOfVertices << " vertices, " << numberOfEdges << " edges, "
+        << numberOfTriangles << " triangles, and " << numberOfQuads << " quads");
+
+  mesh.reserve(numberOfVertices, numberOfEdges, numberOfTriangles, numberOfQuads);
+  const int *entry = content.data() + HEADER_SIZE;
+
+  std::vector<mesh::Vertex *> vertices(numberOfVertices);
+  for (int i = 0; i < numberOfVertices; i++) {
+    mesh::Vertex &v = mesh.createVertex(Eigen::Map<const Eigen::VectorXd>(&coords[i * dim], dim));
+    v.setGlobalIndex(*entry++);
+    vertices[i] = &v;
+  }
+
+  std::vector<mesh::Edge *> edges(numberOfEdges);
+  for (int i = 0; i < numberOfEdges; i++) {
+    assertion(entry[0] >= 0 && entry[0] < numberOfVertices, entry[0]);
+    assertion(entry[1] >= 0 && entry[1] < numberOfVertices, entry[1]);
+    assertion(entry[0] != entry[1]);
+    edges[i] = &mesh.createEdge(*vertices[entry[0]], *vertices[entry[1]]);
+    entry += 2;
+  }
 
-      std::vector<int> triangleIDs;
-      _communication->broadcast(triangleIDs, rankBroadcaster);
+  for (int i = 0; i < numberOfTriangles; i++) {
+    for (int j = 0; j < 3; j++) {
+      assertion(entry[j] >= 0 && entry[j] < numberOfEdges, entry[j]);
+    }
+    mesh.createTriangle(*edges[entry[0]], *edges[entry[1]], *edges[entry[2]]);
+    entry += 3;
+  }
 
-      for (int i = 0; i < numberOfTriangles; i++) {
-        assertion(edgeMap.find(triangleIDs[i * 3]) != edgeMap.end());
-        assertion(edgeMap.find(triangleIDs[i * 3 + 1]) != edgeMap.end());
-        assertion(edgeMap.find(triangleIDs[i * 3 + 2]) != edgeMap.end());
-        assertion(triangleIDs[i * 3] != triangleIDs[i * 3 + 1]);
-        assertion(triangleIDs[i * 3 + 1] != triangleIDs[i * 3 + 2]);
-        assertion(triangleIDs[i * 3 + 2] != triangleIDs[i * 3]);
-        mesh.createTriangle(*edgeMap[triangleIDs[i * 3]], *edgeMap[triangleIDs[i * 3 + 1]], *edgeMap[triangleIDs[i * 3 + 2]]);
-      }
+  for (int i = 0; i < numberOfQuads; i++) {
+    for (int j = 0; j < 4; j++) {
+      assertion(entry[j] >= 0 && entry[j] < numberOfEdges, entry[j]);
     }
+    mesh.createQuad(*edges[entry[0]], *edges[entry[1]], *edges[entry[2]], *edges[entry[3]]);
+    entry += 4;
   }
 }
 
@@ -9,7 +9,13 @@ namespace precice
 namespace com
 {
 
-/// Copies a Mesh object from a sender to a receiver.
+/**
+ * @brief Copies a Mesh object from a sender to a receiver.
+ *
+ * A mesh is transferred as one packed, versioned block of integers, holding a header,
+ * the global indices, and the connectivity of edges, triangles, and quads, followed
+ * by one block of vertex coordinates. Received meshes are added to the given mesh.
+ */
 class CommunicateMesh
 {
 public:
@@ -27,9 +33,11 @@ public:
       mesh::Mesh &mesh,
       int         rankSender);
 
+  /// Broadcasts a constructed mesh from rank 0 to all other ranks.
   void broadcastSendMesh(
       const mesh::Mesh &mesh);
 
+  /// Receives a broadcasted mesh. Adds received mesh to mesh.
   void broadcastReceiveMesh(
       mesh::Mesh &mesh);
 
@@ -43,6 +51,18 @@ public:
 
 private:
   logging::Logger _log{"com::CommunicateMesh"};
+
+  /// Packs the mesh into a block of header, global indices, and connectivity, and a block of coordinates.
+  void packMesh(
+      const mesh::Mesh &   mesh,
+      std::vector<int> &   content,
+      std::vector<double> &coords) const;
+
+  /// Adds the mesh elements of a packed mesh to mesh.
+  void unpackMesh(
+      mesh::Mesh &               mesh,
+      const std::vector<int> &   content,
+      const std::vector<double> &coords);
   
   /// Communication means used for the transfer of the geometry.
   com::PtrCommunication _communication;
@@ -78,7 +78,7 @@ void Communication::allreduceSum(double *itemsToSend, double *itemsToReceive, in
     auto request = aSend(itemsToReceive, size, rank + _rankOffset);
     requests[rank] = request;
   }
-  Request::wait(requests);
+  Request::waitAll(requests);
 }
 
 /**
@@ -113,7 +113,7 @@ void Communication::allreduceSum(double itemToSend, double &itemToReceive)
     auto request = aSend(&itemToReceive, 1, rank + _rankOffset);
     requests[rank] = request;
   }
-  Request::wait(requests);
+  Request::waitAll(requests);
 }
 
 void Communication::allreduceSum(double itemToSend, double &itemsToReceive, int rankMaster)
@@ -145,7 +145,7 @@ void Communication::allreduceSum(int itemToSend, int &itemToReceive)
     auto request = aSend(&itemToReceive, 1, rank + _rankOffset);
     requests[rank] = request;
   }
-  Request::wait(requests);
+  Request::waitAll(requests);
 }
 
 void Communication::allreduceSum(int itemToSend, int &itemToReceive, int rankMaster)
@@ -169,7 +169,7 @@ void Communication::broadcast(const int *itemsToSend, int size)
     requests[rank] = request;
   }
 
-  Request::wait(requests);
+  Request::waitAll(requests);
 }
 
 void Communication::broadcast(int *itemsToReceive, int size, int rankBroadcaster)
@@ -190,7 +190,7 @@ void Communication::broadcast(int itemToSend)
     requests[rank] = request;
   }
 
-  Request::wait(requests);
+  Request::waitAll(requests);
 }
 
 void Communication::broadcast(int &itemToReceive, int rankBroadcaster)
@@ -210,7 +210,7 @@ void Communication::broadcast(const double *itemsToSend, int size)
     requests[rank] = request;
   }
 
-  Request::wait(requests);
+  Request::waitAll(requests);
 }
 
 void Communication::broadcast(double *itemsToReceive,
@@ -232,7 +232,7 @@ void Communication::broadcast(double itemToSend)
     requests[rank] = request;
   }
 
-  Request::wait(requests);
+  Request::waitAll(requests);
 }
 
 void Communication::broadcast(double &itemToReceive, int rankBroadcaster)
@@ -24,6 +24,24 @@ void MPIRequest::wait()
 {
   MPI_Wait(&_request, MPI_STATUS_IGNORE);
 }
+
+size_t MPIRequest::waitAny(std::vector<PtrRequest> &requests)
+{
+  std::vector<MPI_Request> handles(requests.size(), MPI_REQUEST_NULL);
+  for (size_t i = 0; i < requests.size(); i++) {
+    if (requests[i])
+      handles[i] = static_cast<MPIRequest &>(*requests[i])._request;
+  }
+
+  int index = MPI_UNDEFINED;
+  MPI_Waitany(handles.size(), handles.data(), &index, MPI_STATUS_IGNORE);
+  if (index == MPI_UNDEFINED)
+    return requests.size();
+
+  // MPI_Waitany frees the completed handle, the request must not wait for it again
+  static_cast<MPIRequest &>(*requests[index])._request = handles[index];
+  return index;
+}
 } // namespace com
 } // namespace precice
 
@@ -1,6 +1,7 @@
 #pragma once
 #ifndef PRECICE_NO_MPI
 
+#include <vector>
 #include "Request.hpp"
 #include <mpi.h>
 
@@ -17,6 +18,15 @@ public:
 
   void wait() override;
 
+  /**
+   * @brief Waits with MPI_Waitany until any of the requests is completed.
+   *
+   * All requests need to be MPIRequests or null. The completed request is not reset to null.
+   *
+   * @return Index of the completed request, or requests.size() if all requests are null.
+   */
+  static size_t waitAny(std::vector<PtrRequest> &requests);
+
 private:
   MPI_Request _request;
 };
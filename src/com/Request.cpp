@@ -1,17 +1,121 @@
 #include "Request.hpp"
+#include <thread>
+#include "MPIRequest.hpp"
 
 namespace precice
 {
 namespace com
 {
+namespace
+{
+/// Number of polling cycles before a thread waiting for any request parks.
+const int SPIN_CYCLES = 1000;
+
+/// Returns the index of a completed request or requests.size(), pending tells if any request is left.
+size_t findCompleted(std::vector<PtrRequest> &requests, bool &pending)
+{
+  pending = false;
+  for (size_t i = 0; i < requests.size(); i++) {
+    if (not requests[i])
+      continue;
+    if (requests[i]->test())
+      return i;
+    pending = true;
+  }
+  return requests.size();
+}
+
+#ifndef PRECICE_NO_MPI
+/// Returns true, if all requests are MPIRequests or null.
+bool allMPIRequests(const std::vector<PtrRequest> &requests)
+{
+  for (const PtrRequest &request : requests) {
+    if (request and not dynamic_cast<MPIRequest *>(request.get()))
+      return false;
+  }
+  return true;
+}
+#endif // not PRECICE_NO_MPI
+} // namespace
+
+void Request::Notifier::notify()
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  _notified = true;
+  _condition.notify_all();
+}
+
+void Request::Notifier::wait()
+{
+  std::unique_lock<std::mutex> lock(_mutex);
+  _condition.wait(lock, [this] { return _notified; });
+  _notified = false;
+}
 
-void Request::wait(std::vector<PtrRequest> &requests)
+void Request::waitAll(std::vector<PtrRequest> &requests)
 {
-  for (auto request : requests) {
-    request->wait();
+  for (auto &request : requests) {
+    if (request) {
+      request->wait();
+    }
   }
 }
 
+size_t Request::waitAny(std::vector<PtrRequest> &requests)
+{
+  bool pending = true;
+  for (int cycle = 0; cycle < SPIN_CYCLES; cycle++) {
+    size_t index = findCompleted(requests, pending);
+    if (index < requests.size()) {
+      requests[index] = nullptr;
+      return index;
+    }
+    if (not pending)
+      return requests.size();
+    if (cycle >= SPIN_CYCLES / 2)
+      std::this_thread::yield();
+  }
+
+#ifndef PRECICE_NO_MPI
+  if (allMPIRequests(requests)) {
+    size_t index = MPIRequest::waitAny(requests);
+    if (index < requests.size())
+      requests[index] = nullptr;
+    return index;
+  }
+#endif
+
+  // Requests completing after their registration raise the notifier, all others are found by polling
+  auto notifier  = std::make_shared<Notifier>();
+  bool allNotify = true;
+  for (auto &request : requests) {
+    if (request and not request->setNotifier(notifier))
+      allNotify = false;
+  }
+
+  size_t index = findCompleted(requests, pending);
+  while (index == requests.size() and pending) {
+    if (allNotify)
+      notifier->wait();
+    else
+      std::this_thread::yield();
+    index = findCompleted(requests, pending);
+  }
+
+  for (auto &request : requests) {
+    if (request)
+      request->setNotifier(nullptr);
+  }
+  if (index < requests.size())
+    requests[index] = nullptr;
+  return index;
+}
+
+bool Request::setNotifier(PtrNotifier const &)
+{
+  return false;
+}
+
 Request::~Request()
 {
 }
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <condition_variable>
+#include <memory>
+#include <mutex>
 #include <vector>
 #include "com/SharedPointer.hpp"
 
@@ -11,13 +14,52 @@ class Request
 {
 
 public:
-  static void wait(std::vector<PtrRequest> &requests);
+  /// Signal shared by several requests, which is raised when any of them completes.
+  class Notifier
+  {
+  public:
+    void notify();
+
+    /// Blocks until the notifier has been notified and resets it.
+    void wait();
+
+  private:
+    std::mutex              _mutex;
+    std::condition_variable _condition;
+    bool                    _notified = false;
+  };
+
+  using PtrNotifier = std::shared_ptr<Notifier>;
+
+  /// Waits until all requests are completed, null requests are skipped.
+  static void waitAll(std::vector<PtrRequest> &requests);
+
+  /**
+   * @brief Waits until any of the requests is completed.
+   *
+   * The completed request is reset to null, such that repeated calls process all requests
+   * in the order of their completion. Null requests are skipped.
+   *
+   * The requests are polled for a short time. Afterwards, MPI requests are waited for with
+   * MPI_Waitany. Other requests park the calling thread until one of them notifies completion.
+   * If a request cannot notify, the requests are polled until one completes.
+   *
+   * @return Index of the completed request, or requests.size() if all requests are null.
+   */
+  static size_t waitAny(std::vector<PtrRequest> &requests);
 
   virtual ~Request();
 
   virtual bool test() = 0;
 
   virtual void wait() = 0;
+
+  /**
+   * @brief Registers a notifier, which is notified on completion. A null notifier unregisters.
+   *
+   * @return False, if the request cannot notify on completion.
+   */
+  virtual bool setNotifier(PtrNotifier const &notifier);
 };
 } // namespace com
 } // namespace precice
@@ -0,0 +1,328 @@
+#if !defined(PRECICE_NO_SOCKETS) && defined(__linux__)
+
+#include "SharedMemoryChannel.hpp"
+
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <thread>
+#include "utils/assertion.hpp"
+
+namespace precice
+{
+namespace com
+{
+
+static_assert(ATOMIC_INT_LOCK_FREE == 2 && ATOMIC_LLONG_LOCK_FREE == 2,
+              "Shared memory channels require lock-free atomics.");
+
+namespace
+{
+/// Number of checks of the ring buffer before a blocked thread sleeps on the futex.
+const int SPIN_ITERATIONS = 1000;
+
+const uint64_t SEGMENT_MAGIC = 0x5052454349434531; // "PRECICE1"
+
+const size_t CACHE_LINE = 64;
+
+/// Leading part of the segment, followed by the two rings.
+struct alignas(CACHE_LINE) SegmentHeader {
+  uint64_t magic;
+  uint64_t capacity;
+};
+
+size_t roundUp(size_t size)
+{
+  return (size + CACHE_LINE - 1) / CACHE_LINE * CACHE_LINE;
+}
+
+void futexWait(std::atomic<uint32_t> &word, uint32_t expected)
+{
+  syscall(SYS_futex, reinterpret_cast<uint32_t *>(&word), FUTEX_WAIT, expected, nullptr, nullptr, 0);
+}
+
+void futexWake(std::atomic<uint32_t> &word)
+{
+  syscall(SYS_futex, reinterpret_cast<uint32_t *>(&word), FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+}
+
+/// Wakes up the peer, if it sleeps on the sequence.
+void notify(std::atomic<uint32_t> &sequence, std::atomic<uint32_t> &waiting)
+{
+  sequence.fetch_add(1);
+  if (waiting.load()) {
+    futexWake(sequence);
+  }
+}
+
+/**
+ * @brief Blocks until ready() holds or the channel has been closed.
+ *
+ * The sequence is read before the final check of ready(), so that a notification in between
+ * lets the futex return immediately.
+ *
+ * @return ready()
+ */
+template <typename Predicate>
+bool waitFor(std::atomic<uint32_t> &sequence,
+             std::atomic<uint32_t> &waiting,
+             std::atomic<uint32_t> &closed,
+             Predicate              ready)
+{
+  for (int i = 0; i < SPIN_ITERATIONS; i++) {
+    if (ready())
+      return true;
+    if (closed.load(std::memory_order_acquire))
+      return ready();
+    if (i >= SPIN_ITERATIONS / 2)
+      std::this_thread::yield();
+  }
+
+  while (true) {
+    uint32_t expected = sequence.load();
+    waiting.store(1);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (ready() or closed.load()) {
+      waiting.store(0);
+      return ready();
+    }
+    futexWait(sequence, expected);
+    waiting.store(0);
+  }
+}
+} // namespace
+
+logging::Logger SharedMemoryChannel::_log("com::SharedMemoryChannel");
+
+struct alignas(CACHE_LINE) SharedMemoryChannel::Ring {
+  /// Number of bytes written in total, only modified by the writer.
+  alignas(CACHE_LINE) std::atomic<uint64_t> head;
+
+  /// Number of bytes read in total, only modified by the reader.
+  alignas(CACHE_LINE) std::atomic<uint64_t> tail;
+
+  /// Incremented on every write, the reader sleeps on it.
+  alignas(CACHE_LINE) std::atomic<uint32_t> dataSequence;
+  std::atomic<uint32_t> readerWaiting;
+
+  /// Incremented on every read, the writer sleeps on it.
+  std::atomic<uint32_t> spaceSequence;
+  std::atomic<uint32_t> writerWaiting;
+
+  std::atomic<uint32_t> closed;
+
+  uint64_t capacity;
+
+  char *buffer()
+  {
+    return reinterpret_cast<char *>(this + 1);
+  }
+
+  static size_t size(size_t capacity)
+  {
+    return sizeof(Ring) + capacity;
+  }
+};
+
+std::unique_ptr<SharedMemoryChannel> SharedMemoryChannel::create(std::string const &name, size_t capacity)
+{
+  TRACE(name, capacity);
+
+  capacity           = roundUp(std::max<size_t>(capacity, CACHE_LINE));
+  size_t segmentSize = sizeof(SegmentHeader) + 2 * Ring::size(capacity);
+
+  int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+  if (fd == -1) {
+    WARN("Creating shared memory segment " << name << " failed: " << std::strerror(errno));
+    return nullptr;
+  }
+  void *segment = MAP_FAILED;
+  if (ftruncate(fd, segmentSize) == 0) {
+    segment = mmap(nullptr, segmentSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  }
+  int error = errno;
+  ::close(fd);
+  if (segment == MAP_FAILED) {
+    WARN("Mapping shared memory segment " << name << " failed: " << std::strerror(error));
+    shm_unlink(name.c_str());
+    return nullptr;
+  }
+
+  auto header      = new (segment) SegmentHeader();
+  header->capacity = capacity;
+  for (int i = 0; i < 2; i++) {
+    auto ring      = new (static_cast<char *>(segment) + sizeof(SegmentHeader) + i * Ring::size(capacity)) Ring();
+    ring->capacity = capacity;
+  }
+  std::atomic_thread_fence(std::memory_order_release);
+  header->magic = SEGMENT_MAGIC;
+
+  return std::unique_ptr<SharedMemoryChannel>(new SharedMemoryChannel(name, segment, segmentSize, true));
+}
+
+std::unique_ptr<SharedMemoryChannel> SharedMemoryChannel::open(std::string const &name)
+{
+  TRACE(name);
+
+  int fd = shm_open(name.c_str(), O_RDWR, 0);
+  if (fd == -1) {
+    WARN("Opening shared memory segment " << name << " failed: " << std::strerror(errno));
+    return nullptr;
+  }
+  struct stat status;
+  void *      segment     = MAP_FAILED;
+  size_t      segmentSize = 0;
+  if (fstat(fd, &status) == 0 and static_cast<size_t>(status.st_size) > sizeof(SegmentHeader)) {
+    segmentSize = status.st_size;
+    segment     = mmap(nullptr, segmentSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  }
+  int error = errno;
+  ::close(fd);
+  if (segment == MAP_FAILED) {
+    WARN("Mapping shared memory segment " << name << " failed: " << std::strerror(error));
+    return nullptr;
+  }
+
+  auto header = static_cast<SegmentHeader *>(segment);
+  std::atomic_thread_fence(std::memory_order_acquire);
+  if (header->magic != SEGMENT_MAGIC or
+      sizeof(SegmentHeader) + 2 * Ring::size(header->capacity) != segmentSize) {
+    WARN("Shared memory segment " << name << " has an unexpected layout");
+    munmap(segment, segmentSize);
+    return nullptr;
+  }
+
+  return std::unique_ptr<SharedMemoryChannel>(new SharedMemoryChannel(name, segment, segmentSize, false));
+}
+
+SharedMemoryChannel::SharedMemoryChannel(std::string const &name,
+                                         void *             segment,
+                                         size_t             segmentSize,
+                                         bool               isCreator)
+    : _name(name),
+      _segment(segment),
+      _segmentSize(segmentSize)
+{
+  auto   rings    = static_cast<char *>(segment) + sizeof(SegmentHeader);
+  size_t capacity = static_cast<SegmentHeader *>(segment)->capacity;
+  auto   first    = reinterpret_cast<Ring *>(rings);
+  auto   second   = reinterpret_cast<Ring *>(rings + Ring::size(capacity));
+  _out            = isCreator ? first : second;
+  _in             = isCreator ? second : first;
+}
+
+SharedMemoryChannel::~SharedMemoryChannel()
+{
+  unlink();
+  munmap(_segment, _segmentSize);
+}
+
+void SharedMemoryChannel::unlink()
+{
+  if (not _name.empty()) {
+    // Fails harmlessly, if the peer has removed the name already
+    shm_unlink(_name.c_str());
+    _name.clear();
+  }
+}
+
+bool SharedMemoryChannel::write(const void *data, size_t size)
+{
+  Ring &         ring      = *_out;
+  const uint64_t capacity  = ring.capacity;
+  const uint64_t chunkSize = std::max<uint64_t>(capacity / 4, 1);
+  auto           bytes     = static_cast<const char *>(data);
+  uint64_t       head      = ring.head.load(std::memory_order_relaxed);
+
+  while (size > 0) {
+    uint64_t freeBytes = 0;
+    auto     hasSpace  = [&] {
+      freeBytes = capacity - (head - ring.tail.load(std::memory_order_acquire));
+      return freeBytes > 0;
+    };
+    waitFor(ring.spaceSequence, ring.writerWaiting, ring.closed, hasSpace);
+    if (ring.closed.load()) {
+      return false;
+    }
+
+    // Hand over large messages in chunks, so that the peer reads while the rest is written
+    size_t count    = std::min<uint64_t>({size, freeBytes, chunkSize});
+    size_t position = head % capacity;
+    size_t first    = std::min<uint64_t>(count, capacity - position);
+    std::memcpy(ring.buffer() + position, bytes, first);
+    std::memcpy(ring.buffer(), bytes + first, count - first);
+
+    head += count;
+    ring.head.store(head, std::memory_order_release);
+    notify(ring.dataSequence, ring.readerWaiting);
+
+    bytes += count;
+    size -= count;
+  }
+  return true;
+}
+
+bool SharedMemoryChannel::read(void *data, size_t size)
+{
+  Ring &         ring      = *_in;
+  const uint64_t capacity  = ring.capacity;
+  const uint64_t chunkSize = std::max<uint64_t>(capacity / 4, 1);
+  auto           bytes     = static_cast<char *>(data);
+  uint64_t       tail      = ring.tail.load(std::memory_order_relaxed);
+
+  while (size > 0) {
+    uint64_t availableBytes = 0;
+    auto     hasData        = [&] {
+      availableBytes = ring.head.load(std::memory_order_acquire) - tail;
+      return availableBytes > 0;
+    };
+    // Data written before the peer closed the channel is still delivered
+    if (not waitFor(ring.dataSequence, ring.readerWaiting, ring.closed, hasData)) {
+      return false;
+    }
+
+    size_t count    = std::min<uint64_t>({size, availableBytes, chunkSize});
+    size_t position = tail % capacity;
+    size_t first    = std::min<uint64_t>(count, capacity - position);
+    std::memcpy(bytes, ring.buffer() + position, first);
+    std::memcpy(bytes + first, ring.buffer(), count - first);
+
+    tail += count;
+    ring.tail.store(tail, std::memory_order_release);
+    notify(ring.spaceSequence, ring.writerWaiting);
+
+    bytes += count;
+    size -= count;
+  }
+  return true;
+}
+
+void SharedMemoryChannel::close()
+{
+  TRACE(_name);
+  for (Ring *ring : {_out, _in}) {
+    ring->closed.store(1);
+    notify(ring->dataSequence, ring->readerWaiting);
+    notify(ring->spaceSequence, ring->writerWaiting);
+  }
+}
+
+size_t SharedMemoryChannel::getCapacity() const
+{
+  return _out->capacity;
+}
+
+} // namespace com
+} // namespace precice
+
+#endif // not PRECICE_NO_SOCKETS and __linux__
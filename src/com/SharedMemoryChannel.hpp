@@ -0,0 +1,81 @@
+#if !defined(PRECICE_NO_SOCKETS) && defined(__linux__)
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include "logging/Logger.hpp"
+
+namespace precice
+{
+namespace com
+{
+/**
+ * @brief Bidirectional byte stream between two processes on the same host.
+ *
+ * The channel is a POSIX shared memory segment holding one single-producer single-consumer
+ * ring buffer per direction. The process creating the segment writes to the first ring and
+ * reads from the second one, the process opening it the other way round. A blocked reader or
+ * writer first spins and then sleeps on a futex in the segment, which is woken by the peer.
+ *
+ * write() and read() must only be called by one thread at a time per direction.
+ */
+class SharedMemoryChannel
+{
+public:
+  /// Creates a segment with the given name and a ring buffer of capacity bytes per direction.
+  static std::unique_ptr<SharedMemoryChannel> create(std::string const &name, size_t capacity);
+
+  /// Maps a segment created by the peer.
+  static std::unique_ptr<SharedMemoryChannel> open(std::string const &name);
+
+  /// Unmaps the segment.
+  ~SharedMemoryChannel();
+
+  /// Removes the name of the segment, the mapping stays valid.
+  void unlink();
+
+  /**
+   * @brief Writes size bytes, blocks until all of them are in the ring buffer.
+   *
+   * @return false, if the peer closed the channel before.
+   */
+  bool write(const void *data, size_t size);
+
+  /**
+   * @brief Reads size bytes, blocks until all of them have been received.
+   *
+   * @return false, if the peer closed the channel before sending them.
+   */
+  bool read(void *data, size_t size);
+
+  /// Wakes up and fails all blocked and future operations of both sides.
+  void close();
+
+  size_t getCapacity() const;
+
+private:
+  struct Ring;
+
+  SharedMemoryChannel(std::string const &name, void *segment, size_t segmentSize, bool isCreator);
+
+  static logging::Logger _log;
+
+  std::string _name;
+
+  void *_segment;
+
+  size_t _segmentSize;
+
+  /// Ring buffer this process writes to.
+  Ring *_out;
+
+  /// Ring buffer this process reads from.
+  Ring *_in;
+};
+
+} // namespace com
+} // namespace precice
+
+#endif // not PRECICE_NO_SOCKETS and __linux__
@@ -0,0 +1,656 @@
+#if !defined(PRECICE_NO_SOCKETS) && defined(__linux__)
+
+#include "SharedMemoryCommunication.hpp"
+
+#include <unistd.h>
+#include <atomic>
+#include <boost/asio/ip/host_name.hpp>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include "SharedMemoryChannel.hpp"
+#include "SocketRequest.hpp"
+#include "utils/assertion.hpp"
+
+namespace precice
+{
+namespace com
+{
+namespace
+{
+/**
+ * @brief Thread carrying out the asynchronous operations of one direction to a peer in order.
+ *
+ * The thread is started when the first task is posted.
+ */
+class Worker
+{
+public:
+  ~Worker()
+  {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _stop = true;
+    }
+    _posted.notify_one();
+    if (_thread.joinable()) {
+      _thread.join();
+    }
+  }
+
+  void post(std::function<void()> task)
+  {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      if (not _thread.joinable()) {
+        _thread = std::thread([this] { run(); });
+      }
+      _tasks.push_back(std::move(task));
+      _pending++;
+    }
+    _posted.notify_one();
+  }
+
+  /// Blocks until all posted tasks have been carried out.
+  void drain()
+  {
+    if (_pending.load() == 0)
+      return;
+    std::unique_lock<std::mutex> lock(_mutex);
+    _drained.wait(lock, [this] { return _pending.load() == 0; });
+  }
+
+private:
+  void run()
+  {
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (true) {
+      _posted.wait(lock, [this] { return _stop or not _tasks.empty(); });
+      if (_tasks.empty()) {
+        return;
+      }
+      auto task = std::move(_tasks.front());
+      _tasks.pop_front();
+      lock.unlock();
+      task();
+      lock.lock();
+      _pending--;
+      _drained.notify_all();
+    }
+  }
+
+  std::mutex                        _mutex;
+  std::condition_variable           _posted;
+  std::condition_variable           _drained;
+  std::deque<std::function<void()>> _tasks;
+  std::atomic<int>                  _pending{0};
+  bool                              _stop = false;
+  std::thread                       _thread;
+};
+
+/// Counter making the names of the segments created by this process unique.
+std::atomic<int> segmentCounter{0};
+} // namespace
+
+/// Remote rank connected by a shared memory channel.
+class SharedMemoryCommunication::Peer
+{
+public:
+  explicit Peer(std::unique_ptr<SharedMemoryChannel> channel)
+      : _channel(std::move(channel))
+  {
+  }
+
+  bool write(const void *data, size_t size)
+  {
+    _sender.drain();
+    return _channel->write(data, size);
+  }
+
+  bool read(void *data, size_t size)
+  {
+    _receiver.drain();
+    return _channel->read(data, size);
+  }
+
+  void aWrite(const void *data, size_t size, PtrRequest request)
+  {
+    SharedMemoryChannel *channel = _channel.get();
+    _sender.post([channel, data, size, request] {
+      std::static_pointer_cast<SocketRequest>(request)->complete(channel->write(data, size));
+    });
+  }
+
+  void aRead(void *data, size_t size, PtrRequest request)
+  {
+    SharedMemoryChannel *channel = _channel.get();
+    _receiver.post([channel, data, size, request] {
+      std::static_pointer_cast<SocketRequest>(request)->complete(channel->read(data, size));
+    });
+  }
+
+  /// Fails the blocked and pending operations of both sides.
+  void close()
+  {
+    _channel->close();
+  }
+
+private:
+  // Declared first, so that the workers are joined before the channel is unmapped
+  std::unique_ptr<SharedMemoryChannel> _channel;
+
+  Worker _sender;
+
+  Worker _receiver;
+};
+
+SharedMemoryCommunication::SharedMemoryCommunication(size_t             bufferSize,
+                                                     std::string const &networkName,
+                                                     std::string const &addressDirectory)
+    : SocketCommunication(0, false, networkName, addressDirectory),
+      _bufferSize(bufferSize),
+      _requestPool(std::make_shared<SocketRequestPool>())
+{
+}
+
+SharedMemoryCommunication::~SharedMemoryCommunication()
+{
+  TRACE(_isConnected);
+  closeConnection();
+}
+
+void SharedMemoryCommunication::acceptConnection(std::string const &acceptorName,
+                                                 std::string const &requesterName,
+                                                 int                acceptorRank)
+{
+  TRACE(acceptorName, requesterName, acceptorRank);
+  SocketCommunication::acceptConnection(acceptorName, requesterName, acceptorRank);
+  setUpSharedMemory(true);
+}
+
+void SharedMemoryCommunication::acceptConnectionAsServer(std::string const &acceptorName,
+                                                         std::string const &requesterName,
+                                                         int                acceptorRank,
+                                                         int                requesterCommunicatorSize)
+{
+  TRACE(acceptorName, requesterName, acceptorRank, requesterCommunicatorSize);
+  SocketCommunication::acceptConnectionAsServer(acceptorName, requesterName, acceptorRank, requesterCommunicatorSize);
+  setUpSharedMemory(true);
+}
+
+void SharedMemoryCommunication::requestConnection(std::string const &acceptorName,
+                                                  std::string const &requesterName,
+                                                  int                requesterRank,
+                                                  int                requesterCommunicatorSize)
+{
+  TRACE(acceptorName, requesterName, requesterRank, requesterCommunicatorSize);
+  SocketCommunication::requestConnection(acceptorName, requesterName, requesterRank, requesterCommunicatorSize);
+  setUpSharedMemory(false);
+}
+
+void SharedMemoryCommunication::requestConnectionAsClient(std::string   const &acceptorName,
+                                                          std::string   const &requesterName,
+                                                          std::set<int> const &acceptorRanks,
+                                                          int                  requesterRank)
+{
+  TRACE(acceptorName, requesterName, acceptorRanks, requesterRank);
+  SocketCommunication::requestConnectionAsClient(acceptorName, requesterName, acceptorRanks, requesterRank);
+  setUpSharedMemory(false);
+}
+
+void SharedMemoryCommunication::setUpSharedMemory(bool isAcceptor)
+{
+  TRACE(isAcceptor);
+
+  // All messages of one step are sent before any is received, so that no pair of ranks
+  // waits for each other, when the requesters are connected to several acceptors.
+  std::vector<int> remoteRanks = getConnectedRanks();
+  std::string      hostName    = boost::asio::ip::host_name();
+
+  if (isAcceptor) {
+    std::vector<std::string> remoteHostNames(remoteRanks.size());
+    for (size_t i = 0; i < remoteRanks.size(); i++) {
+      SocketCommunication::receive(remoteHostNames[i], remoteRanks[i]);
+    }
+
+    std::vector<std::unique_ptr<SharedMemoryChannel>> channels(remoteRanks.size());
+    for (size_t i = 0; i < remoteRanks.size(); i++) {
+      std::string segmentName;
+      if (remoteHostNames[i] == hostName) {
+        segmentName = "/precice-" + std::to_string(getpid()) + "-" + std::to_string(segmentCounter++) +
+                      "-" + std::to_string(remoteRanks[i]);
+        channels[i] = SharedMemoryChannel::create(segmentName, _bufferSize);
+        if (not channels[i]) {
+          segmentName.clear();
+        }
+      }
+      SocketCommunication::send(segmentName, remoteRanks[i]);
+    }
+
+    for (size_t i = 0; i < remoteRanks.size(); i++) {
+      bool isOpened = false;
+      SocketCommunication::receive(isOpened, remoteRanks[i]);
+      // A channel, which has not been opened by the requester, is removed here
+      if (isOpened) {
+        _peers[remoteRanks[i]].reset(new Peer(std::move(channels[i])));
+      }
+    }
+  } else {
+    for (int remoteRank : remoteRanks) {
+      SocketCommunication::send(hostName, remoteRank);
+    }
+
+    std::vector<std::unique_ptr<SharedMemoryChannel>> channels(remoteRanks.size());
+    for (size_t i = 0; i < remoteRanks.size(); i++) {
+      std::string segmentName;
+      SocketCommunication::receive(segmentName, remoteRanks[i]);
+      if (not segmentName.empty()) {
+        channels[i] = SharedMemoryChannel::open(segmentName);
+        if (channels[i]) {
+          // The segment is freed by the OS, as soon as both sides unmapped it
+          channels[i]->unlink();
+        }
+      }
+    }
+
+    for (size_t i = 0; i < remoteRanks.size(); i++) {
+      bool isOpened = (channels[i] != nullptr);
+      SocketCommunication::send(isOpened, remoteRanks[i]);
+      if (isOpened) {
+        _peers[remoteRanks[i]].reset(new Peer(std::move(channels[i])));
+      }
+    }
+  }
+
+  DEBUG("Connected " << _peers.size() << " of " << remoteRanks.size() << " remote ranks by shared memory");
+}
+
+void SharedMemoryCommunication::closeConnection()
+{
+  TRACE();
+
+  if (not isConnected())
+    return;
+
+  for (auto &peer : _peers) {
+    peer.second->close();
+  }
+  _peers.clear();
+
+  SocketCommunication::closeConnection();
+}
+
+size_t SharedMemoryCommunication::getNumberOfSharedMemoryPeers() const
+{
+  return _peers.size();
+}
+
+SharedMemoryCommunication::Peer *SharedMemoryCommunication::getPeer(int rank)
+{
+  assertion(isConnected());
+  auto peer = _peers.find(rank - _rankOffset);
+  return peer == _peers.end() ? nullptr : peer->second.get();
+}
+
+void SharedMemoryCommunication::send(std::string const &itemToSend, int rankReceiver)
+{
+  TRACE(itemToSend, rankReceiver);
+  Peer *peer = getPeer(rankReceiver);
+  if (peer == nullptr) {
+    SocketCommunication::send(itemToSend, rankReceiver);
+    return;
+  }
+
+  size_t size = itemToSend.size() + 1;
+  if (not(peer->write(&size, sizeof(size_t)) and peer->write(itemToSend.c_str(), size))) {
+    ERROR("Send failed: the connection has been closed");
+  }
+}
+
+void SharedMemoryCommunication::send(const int *itemsToSend, int size, int rankReceiver)
+{
+  TRACE(size, rankReceiver);
+  Peer *peer = getPeer(rankReceiver);
+  if (peer == nullptr) {
+    SocketCommunication::send(itemsToSend, size, rankReceiver);
+  } else if (not peer->write(itemsToSend, size * sizeof(int))) {
+    ERROR("Send failed: the connection has been closed");
+  }
+}
+
+PtrRequest SharedMemoryCommunication::aSend(const int *itemsToSend, int size, int rankReceiver)
+{
+  TRACE(size, rankReceiver);
+  Peer *peer = getPeer(rankReceiver);
+  if (peer == nullptr) {
+    return SocketCommunication::aSend(itemsToSend, size, rankReceiver);
+  }
+
+  PtrRequest request = _requestPool->acquire();
+  peer->aWrite(itemsToSend, size * sizeof(int), request);
+  return request;
+}
+
+void SharedMemoryCommunication::send(const double *itemsToSend, int size, int rankReceiver)
+{
+  TRACE(size, rankReceiver);
+  Peer *peer = getPeer(rankReceiver);
+  if (peer == nullptr) {
+    SocketCommunication::send(itemsToSend, size, rankReceiver);
+  } else if (not peer->write(itemsToSend, size * sizeof(double))) {
+    ERROR("Send failed: the connection has been closed");
+  }
+}
+
+PtrRequest SharedMemoryCommunication::aSend(const double *itemsToSend, int size, int rankReceiver)
+{
+  TRACE(size, rankReceiver);
+  Peer *peer = getPeer(rankReceiver);
+  if (peer == nullptr) {
+    return SocketCommunication::aSend(itemsToSend, size, rankReceiver);
+  }
+
+  PtrRequest request = _requestPool->acquire();
+  peer->aWrite(itemsToSend, size * sizeof(double), request);
+  return request;
+}
+
+PtrRequest SharedMemoryCommunication::aSend(std::vector<double> const &itemsToSend, int rankReceiver)
+{
+  TRACE(rankReceiver);
+  Peer *peer = getPeer(rankReceiver);
+  if (peer == nullptr) {
+    return SocketCommunication::aSend(itemsToSend, rankReceiver);
+  }
+
+  PtrRequest request = _requestPool->acquire();
+  peer->aWrite(itemsToSend.data(), itemsToSend.size() * sizeof(double), request);
+  return request;
+}
+
+void SharedMemoryCommunication::send(double itemToSend, int rankReceiver)
+{
+  TRACE(itemToSend, rankReceiver);
+  Peer *peer = getPeer(rankReceiver);
+  if (peer == nullptr) {
+    SocketCommunication::send(itemToSend, rankReceiver);
+  } else if (not peer->write(&itemToSend, sizeof(double))) {
+    ERROR("Send failed: the connection has been closed");
+  }
+}
+
+PtrRequest SharedMemoryCommunication::aSend(const double &itemToSend, int rankReceiver)
+{
+  TRACE(itemToSend, rankReceiver);
+  Peer *peer = getPeer(rankReceiver);
+  if (peer == nullptr) {
+    return SocketCommunication::aSend(itemToSend, rankReceiver);
+  }
+
+  PtrRequest request = _requestPool->acquire();
+  peer->aWrite(&itemToSend, sizeof(double), request);
+  return request;
+}
+
+void SharedMemoryCommunication::send(int itemToSend, int rankReceiver)
+{
+  TRACE(itemToSend, rankReceiver);
+  Peer *peer = getPeer(rankReceiver);
+  if (peer == nullptr) {
+    SocketCommunication::send(itemToSend, rankReceiver);
+  } else if (not peer->write(&itemToSend, sizeof(int))) {
+    ERROR("Send failed: the connection has been closed");
+  }
+}
+
+PtrRequest SharedMemoryCommunication::aSend(const int &itemToSend, int rankReceiver)
+{
+  TRACE(itemToSend, rankReceiver);
+  Peer *peer = getPeer(rankReceiver);
+  if (peer == nullptr) {
+    return SocketCommunication::aSend(itemToSend, rankReceiver);
+  }
+
+  PtrRequest request = _requestPool->acquire();
+  peer->aWrite(&itemToSend, sizeof(int), request);
+  return request;
+}
+
+void SharedMemoryCommunication::send(bool itemToSend, int rankReceiver)
+{
+  TRACE(itemToSend, rankReceiver);
+  Peer *peer = getPeer(rankReceiver);
+  if (peer == nullptr) {
+    SocketCommunication::send(itemToSend, rankReceiver);
+  } else if (not peer->write(&itemToSend, sizeof(bool))) {
+    ERROR("Send failed: the connection has been closed");
+  }
+}
+
+PtrRequest SharedMemoryCommunication::aSend(const bool &itemToSend, int rankReceiver)
+{
+  TRACE(itemToSend, rankReceiver);
+  Peer *peer = getPeer(rankReceiver);
+  if (peer == nullptr) {
+    return SocketCommunication::aSend(itemToSend, rankReceiver);
+  }
+
+  PtrRequest request = _requestPool->acquire();
+  peer->aWrite(&itemToSend, sizeof(bool), request);
+  return request;
+}
+
+void SharedMemoryCommunication::receive(std::string &itemToReceive, int rankSender)
+{
+  TRACE(rankSender);
+  Peer *peer = getPeer(rankSender);
+  if (peer == nullptr) {
+    SocketCommunication::receive(itemToReceive, rankSender);
+    return;
+  }
+
+  size_t size = 0;
+  if (not peer->read(&size, sizeof(size_t))) {
+    ERROR("Receive failed: the connection has been closed");
+  }
+  std::vector<char> msg(size);
+  if (not peer->read(msg.data(), size)) {
+    ERROR("Receive failed: the connection has been closed");
+  }
+  itemToReceive = msg.data();
+}
+
+void SharedMemoryCommunication::receive(int *itemsToReceive, int size, int rankSender)
+{
+  TRACE(size, rankSender);
+  Peer *peer = getPeer(rankSender);
+  if (peer == nullptr) {
+    SocketCommunication::receive(itemsToReceive, size, rankSender);
+  } else if (not peer->read(itemsToReceive, size * sizeof(int))) {
+    ERROR("Receive failed: the connection has been closed");
+  }
+}
+
+void SharedMemoryCommunication::receive(double *itemsToReceive, int size, int rankSender)
+{
+  TRACE(size, rankSender);
+  Peer *peer = getPeer(rankSender);
+  if (peer == nullptr) {
+    SocketCommunication::receive(itemsToReceive, size, rankSender);
+  } else if (not peer->read(itemsToReceive, size * sizeof(double))) {
+    ERROR("Receive failed: the connection has been closed");
+  }
+}
+
+PtrRequest SharedMemoryCommunication::aReceive(double *itemsToReceive, int size, int rankSender)
+{
+  TRACE(size, rankSender);
+  Peer *peer = getPeer(rankSender);
+  if (peer == nullptr) {
+    return SocketCommunication::aReceive(itemsToReceive, size, rankSender);
+  }
+
+  PtrRequest request = _requestPool->acquire();
+  peer->aRead(itemsToReceive, size * sizeof(double), request);
+  return request;
+}
+
+PtrRequest SharedMemoryCommunication::aReceive(std::vector<double> &itemsToReceive, int rankSender)
+{
+  TRACE(rankSender);
+  Peer *peer = getPeer(rankSender);
+  if (peer == nullptr) {
+    return SocketCommunication::aReceive(itemsToReceive, rankSender);
+  }
+
+  PtrRequest request = _requestPool->acquire();
+  peer->aRead(itemsToReceive.data(), itemsToReceive.size() * sizeof(double), request);
+  return request;
+}
+
+void SharedMemoryCommunication::receive(double &itemToReceive, int rankSender)
+{
+  TRACE(rankSender);
+  Peer *peer = getPeer(rankSender);
+  if (peer == nullptr) {
+    SocketCommunication::receive(itemToReceive, rankSender);
+  } else if (not peer->read(&itemToReceive, sizeof(double))) {
+    ERROR("Receive failed: the connection has been closed");
+  }
+}
+
+PtrRequest SharedMemoryCommunication::aReceive(double &itemToReceive, int rankSender)
+{
+  TRACE(rankSender);
+  Peer *peer = getPeer(rankSender);
+  if (peer == nullptr) {
+    return SocketCommunication::aReceive(itemToReceive, rankSender);
+  }
+
+  PtrRequest request = _requestPool->acquire();
+  peer->aRead(&itemToReceive, sizeof(double), request);
+  return request;
+}
+
+void SharedMemoryCommunication::receive(int &itemToReceive, int rankSender)
+{
+  TRACE(rankSender);
+  Peer *peer = getPeer(rankSender);
+  if (peer == nullptr) {
+    SocketCommunication::receive(itemToReceive, rankSender);
+  } else if (not peer->read(&itemToReceive, sizeof(int))) {
+    ERROR("Receive failed: the connection has been closed");
+  }
+}
+
+PtrRequest SharedMemoryCommunication::aReceive(int &itemToReceive, int rankSender)
+{
+  TRACE(rankSender);
+  Peer *peer = getPeer(rankSender);
+  if (peer == nullptr) {
+    return SocketCommunication::aReceive(itemToReceive, rankSender);
+  }
+
+  PtrRequest request = _requestPool->acquire();
+  peer->aRead(&itemToReceive, sizeof(int), request);
+  return request;
+}
+
+void SharedMemoryCommunication::receive(bool &itemToReceive, int rankSender)
+{
+  TRACE(rankSender);
+  Peer *peer = getPeer(rankSender);
+  if (peer == nullptr) {
+    SocketCommunication::receive(itemToReceive, rankSender);
+  } else if (not peer->read(&itemToReceive, sizeof(bool))) {
+    ERROR("Receive failed: the connection has been closed");
+  }
+}
+
+PtrRequest SharedMemoryCommunication::aReceive(bool &itemToReceive, int rankSender)
+{
+  TRACE(rankSender);
+  Peer *peer = getPeer(rankSender);
+  if (peer == nullptr) {
+    return SocketCommunication::aReceive(itemToReceive, rankSender);
+  }
+
+  PtrRequest request = _requestPool->acquire();
+  peer->aRead(&itemToReceive, sizeof(bool), request);
+  return request;
+}
+
+void SharedMemoryCommunication::send(std::vector<int> const &v, int rankReceiver)
+{
+  TRACE(rankReceiver);
+  Peer *peer = getPeer(rankReceiver);
+  if (peer == nullptr) {
+    SocketCommunication::send(v, rankReceiver);
+    return;
+  }
+
+  size_t size = v.size();
+  if (not(peer->write(&size, sizeof(size_t)) and peer->write(v.data(), size * sizeof(int)))) {
+    ERROR("Send failed: the connection has been closed");
+  }
+}
+
+void SharedMemoryCommunication::receive(std::vector<int> &v, int rankSender)
+{
+  TRACE(rankSender);
+  Peer *peer = getPeer(rankSender);
+  if (peer == nullptr) {
+    SocketCommunication::receive(v, rankSender);
+    return;
+  }
+
+  size_t size = 0;
+  if (not peer->read(&size, sizeof(size_t))) {
+    ERROR("Receive failed: the connection has been closed");
+  }
+  v.resize(size);
+  if (not peer->read(v.data(), size * sizeof(int))) {
+    ERROR("Receive failed: the connection has been closed");
+  }
+}
+
+void SharedMemoryCommunication::send(std::vector<double> const &v, int rankReceiver)
+{
+  TRACE(rankReceiver);
+  Peer *peer = getPeer(rankReceiver);
+  if (peer == nullptr) {
+    SocketCommunication::send(v, rankReceiver);
+    return;
+  }
+
+  size_t size = v.size();
+  if (not(peer->write(&size, sizeof(size_t)) and peer->write(v.data(), size * sizeof(double)))) {
+    ERROR("Send failed: the connection has been closed");
+  }
+}
+
+void SharedMemoryCommunication::receive(std::vector<double> &v, int rankSender)
+{
+  TRACE(rankSender);
+  Peer *peer = getPeer(rankSender);
+  if (peer == nullptr) {
+    SocketCommunication::receive(v, rankSender);
+    return;
+  }
+
+  size_t size = 0;
+  if (not peer->read(&size, sizeof(size_t))) {
+    ERROR("Receive failed: the connection has been closed");
+  }
+  v.resize(size);
+  if (not peer->read(v.data(), size * sizeof(double))) {
+    ERROR("Receive failed: the connection has been closed");
+  }
+}
+
+} // namespace com
+} // namespace precice
+
+#endif // not PRECICE_NO_SOCKETS and __linux__
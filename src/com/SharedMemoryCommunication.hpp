@@ -0,0 +1,145 @@
+#if !defined(PRECICE_NO_SOCKETS) && defined(__linux__)
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <set>
+#include <vector>
+#include "com/SocketCommunication.hpp"
+#include "logging/Logger.hpp"
+
+namespace precice
+{
+namespace com
+{
+/**
+ * @brief Implements Communication by shared memory for peers on the same host, by sockets otherwise.
+ *
+ * The connection is established by sockets. Afterwards, every pair of ranks on the same host
+ * sets up a SharedMemoryChannel, which carries all their messages from then on. Peers on other
+ * hosts, or for which the segment cannot be set up, keep communicating by sockets.
+ *
+ * Asynchronous operations are carried out by one thread per peer and direction, which is
+ * started on first use. A blocking operation waits for all pending asynchronous operations
+ * to the same peer and direction, so that the order of messages is preserved.
+ */
+class SharedMemoryCommunication : public SocketCommunication
+{
+public:
+  /// Default capacity of the ring buffer per direction in bytes.
+  static const size_t DEFAULT_BUFFER_SIZE = 1 << 20;
+
+  SharedMemoryCommunication(size_t             bufferSize       = DEFAULT_BUFFER_SIZE,
+                            std::string const &networkName      = "lo",
+                            std::string const &addressDirectory = ".");
+
+  virtual ~SharedMemoryCommunication();
+
+  virtual void acceptConnection(std::string const &acceptorName,
+                                std::string const &requesterName,
+                                int                acceptorRank) override;
+
+  virtual void acceptConnectionAsServer(std::string const &acceptorName,
+                                        std::string const &requesterName,
+                                        int                acceptorRank,
+                                        int                requesterCommunicatorSize) override;
+
+  virtual void requestConnection(std::string const &acceptorName,
+                                 std::string const &requesterName,
+                                 int                requesterRank,
+                                 int                requesterCommunicatorSize) override;
+
+  virtual void requestConnectionAsClient(std::string   const &acceptorName,
+                                         std::string   const &requesterName,
+                                         std::set<int> const &acceptorRanks,
+                                         int                  requesterRank) override;
+
+  virtual void closeConnection() override;
+
+  /// Returns the number of remote ranks connected by shared memory.
+  size_t getNumberOfSharedMemoryPeers() const;
+
+  virtual void send(std::string const &itemToSend, int rankReceiver) override;
+
+  virtual void send(const int *itemsToSend, int size, int rankReceiver) override;
+
+  virtual PtrRequest aSend(const int *itemsToSend, int size, int rankReceiver) override;
+
+  virtual void send(const double *itemsToSend, int size, int rankReceiver) override;
+
+  virtual PtrRequest aSend(const double *itemsToSend, int size, int rankReceiver) override;
+
+  virtual PtrRequest aSend(std::vector<double> const & itemsToSend, int rankReceiver) override;
+
+  virtual void send(double itemToSend, int rankReceiver) override;
+
+  virtual PtrRequest aSend(const double & itemToSend, int rankReceiver) override;
+
+  virtual void send(int itemToSend, int rankReceiver) override;
+
+  virtual PtrRequest aSend(const int & itemToSend, int rankReceiver) override;
+
+  virtual void send(bool itemToSend, int rankReceiver) override;
+
+  virtual PtrRequest aSend(const bool & itemToSend, int rankReceiver) override;
+
+  virtual void receive(std::string &itemToReceive, int rankSender) override;
+
+  virtual void receive(int *itemsToReceive, int size, int rankSender) override;
+
+  virtual void receive(double *itemsToReceive, int size, int rankSender) override;
+
+  virtual PtrRequest aReceive(double *itemsToReceive,
+                              int     size,
+                              int     rankSender) override;
+
+  virtual PtrRequest aReceive(std::vector<double> & itemsToReceive, int rankSender) override;
+
+  virtual void receive(double &itemToReceive, int rankSender) override;
+
+  virtual PtrRequest aReceive(double &itemToReceive, int rankSender) override;
+
+  virtual void receive(int &itemToReceive, int rankSender) override;
+
+  virtual PtrRequest aReceive(int &itemToReceive, int rankSender) override;
+
+  virtual void receive(bool &itemToReceive, int rankSender) override;
+
+  virtual PtrRequest aReceive(bool &itemToReceive, int rankSender) override;
+
+  void send(std::vector<int> const &v, int rankReceiver) override;
+  void receive(std::vector<int> &v, int rankSender) override;
+
+  void send(std::vector<double> const &v, int rankReceiver) override;
+  void receive(std::vector<double> &v, int rankSender) override;
+
+private:
+  class Peer;
+
+  logging::Logger _log{"com::SharedMemoryCommunication"};
+
+  /// Capacity of the ring buffer per direction in bytes.
+  size_t _bufferSize;
+
+  std::shared_ptr<SocketRequestPool> _requestPool;
+
+  /// Remote rank -> shared memory peer, only for peers on the same host
+  std::map<int, std::unique_ptr<Peer>> _peers;
+
+  /**
+   * @brief Replaces the sockets to the connected remote ranks by shared memory, where possible.
+   *
+   * The acceptor creates the segments, the requester opens them. The side of every pair that
+   * cannot use shared memory falls back to the socket of the pair.
+   */
+  void setUpSharedMemory(bool isAcceptor);
+
+  /// Returns the shared memory peer of the given rank or nullptr, if it is connected by socket.
+  Peer *getPeer(int rank);
+};
+
+} // namespace com
+} // namespace precice
+
+#endif // not PRECICE_NO_SOCKETS and __linux__
@@ -0,0 +1,38 @@
+#include "SharedMemoryCommunication.hpp"
+
+#include "SharedMemoryCommunicationFactory.hpp"
+#include "com/SharedPointer.hpp"
+
+#if !defined(PRECICE_NO_SOCKETS) && defined(__linux__)
+
+namespace precice
+{
+namespace com
+{
+SharedMemoryCommunicationFactory::SharedMemoryCommunicationFactory(
+    size_t             bufferSize,
+    std::string const &networkName,
+    std::string const &addressDirectory)
+    : _bufferSize(bufferSize),
+      _networkName(networkName),
+      _addressDirectory(addressDirectory)
+{
+  if (_addressDirectory.empty()) {
+    _addressDirectory = ".";
+  }
+}
+
+PtrCommunication SharedMemoryCommunicationFactory::newCommunication()
+{
+  return std::make_shared<SharedMemoryCommunication>(
+      _bufferSize, _networkName, _addressDirectory);
+}
+
+std::string SharedMemoryCommunicationFactory::addressDirectory()
+{
+  return _addressDirectory;
+}
+} // namespace com
+} // namespace precice
+
+#endif // not PRECICE_NO_SOCKETS and __linux__
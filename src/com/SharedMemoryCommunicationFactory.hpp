@@ -0,0 +1,33 @@
+#if !defined(PRECICE_NO_SOCKETS) && defined(__linux__)
+
+#pragma once
+
+#include "CommunicationFactory.hpp"
+#include "com/SharedPointer.hpp"
+
+#include <string>
+
+namespace precice
+{
+namespace com
+{
+class SharedMemoryCommunicationFactory : public CommunicationFactory
+{
+public:
+  SharedMemoryCommunicationFactory(size_t             bufferSize,
+                                   std::string const &networkName      = "lo",
+                                   std::string const &addressDirectory = ".");
+
+  PtrCommunication newCommunication() override;
+
+  std::string addressDirectory() override;
+
+private:
+  size_t      _bufferSize;
+  std::string _networkName;
+  std::string _addressDirectory;
+};
+} // namespace com
+} // namespace precice
+
+#endif // not PRECICE_NO_SOCKETS and __linux__
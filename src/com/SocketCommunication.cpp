@@ -1,5 +1,6 @@
 #include "SocketCommunication.hpp"
 
+#include "SocketIOService.hpp"
 #include "SocketRequest.hpp"
 
 #include <boost/asio.hpp>
@@ -27,7 +28,8 @@ SocketCommunication::SocketCommunication(unsigned short     portNumber,
       _reuseAddress(reuseAddress),
       _networkName(networkName),
       _addressDirectory(addressDirectory),
-      _ioService(new IOService)
+      _ioService(SocketIOService::getInstance()),
+      _requestPool(std::make_shared<SocketRequestPool>())
 {
   if (_addressDirectory.empty()) {
     _addressDirectory = ".";
@@ -68,7 +70,7 @@ void SocketCommunication::acceptConnection(std::string const &acceptorName,
 
     using asio::ip::tcp;
 
-    tcp::acceptor acceptor(*_ioService);
+    tcp::acceptor acceptor(_ioService->getIOService());
     tcp::endpoint endpoint(tcp::v4(), _portNumber);
 
     acceptor.open(endpoint.protocol());
@@ -90,7 +92,7 @@ void SocketCommunication::acceptConnection(std::string const &acceptorName,
     int requesterCommunicatorSize = -1;
         
     do {
-      auto socket = std::make_shared<Socket>(*_ioService);
+      auto socket = std::make_shared<Socket>(_ioService->getIOService());
       
       acceptor.accept(*socket);
       DEBUG("Accepted connection at " << address);
@@ -103,7 +105,7 @@ void SocketCommunication::acceptConnection(std::string const &acceptorName,
       CHECK(_sockets.count(requesterRank) == 0,
             "Duplicate request to connect by same rank (" << requesterRank << ")!");
       
-      _sockets[requesterRank] = socket;
+      addSocket(requesterRank, socket);
       send(acceptorRank, requesterRank);
       receive(requesterCommunicatorSize, requesterRank);
 
@@ -122,11 +124,6 @@ void SocketCommunication::acceptConnection(std::string const &acceptorName,
   } catch (std::exception &e) {
     ERROR("Accepting connection at " << address << " failed: " << e.what());
   }
-
-  // NOTE:
-  // Keep IO service running so that it fires asynchronous handlers from another thread.
-  _work   = std::make_shared<asio::io_service::work>(*_ioService);
-  _thread = std::thread([this]() { _ioService->run(); });
 }
 
 void SocketCommunication::acceptConnectionAsServer(std::string const &acceptorName,
@@ -149,7 +146,7 @@ void SocketCommunication::acceptConnectionAsServer(std::string const &acceptorNa
 
     using asio::ip::tcp;
 
-    tcp::acceptor acceptor(*_ioService);
+    tcp::acceptor acceptor(_ioService->getIOService());
     {
       tcp::endpoint endpoint(tcp::v4(), _portNumber);
 
@@ -170,25 +167,20 @@ void SocketCommunication::acceptConnectionAsServer(std::string const &acceptorNa
     DEBUG("Accepting connection at " << address);
 
     for (int connection = 0; connection < requesterCommunicatorSize; ++connection) {
-      auto socket = std::make_shared<Socket>(*_ioService);
+      auto socket = std::make_shared<Socket>(_ioService->getIOService());
       acceptor.accept(*socket);
       DEBUG("Accepted connection at " << address);
       _isConnected = true;
 
       int requesterRank;
       asio::read(*socket, asio::buffer(&requesterRank, sizeof(int)));
-      _sockets[requesterRank] = socket;
+      addSocket(requesterRank, socket);
     }
 
     acceptor.close();
   } catch (std::exception &e) {
     ERROR("Accepting connection at " << address << " failed: " << e.what());
   }
-
-  // NOTE:
-  // Keep IO service running so that it fires asynchronous handlers from another thread.
-  _work   = std::make_shared<asio::io_service::work>(*_ioService);
-  _thread = std::thread([this]() { _ioService->run(); });  
 }
 
 void SocketCommunication::requestConnection(std::string const &acceptorName,
@@ -214,14 +206,14 @@ void SocketCommunication::requestConnection(std::string const &acceptorName,
 
     _portNumber = static_cast<unsigned short>(std::stoi(portNumber));
 
-    auto socket = std::make_shared<Socket>(*_ioService);
+    auto socket = std::make_shared<Socket>(_ioService->getIOService());
 
     using asio::ip::tcp;
 
     tcp::resolver::query query(tcp::v4(), ipAddress, portNumber, tcp::resolver::query::canonical_name);
 
     while (not isConnected()) {
-      tcp::resolver resolver(*_ioService);
+      tcp::resolver resolver(_ioService->getIOService());
       tcp::resolver::endpoint_type endpoint = *(resolver.resolve(query));
       boost::system::error_code    error    = asio::error::host_not_found;
       socket->connect(endpoint, error);
@@ -231,7 +223,7 @@ void SocketCommunication::requestConnection(std::string const &acceptorName,
       if (not isConnected()) {
         // Wait a little, since after a couple of ten-thousand trials the system
         // seems to get confused and the requester connects wrongly to itself.
-        boost::asio::deadline_timer timer(*_ioService, boost::posix_time::milliseconds(1));
+        boost::asio::deadline_timer timer(_ioService->getIOService(), boost::posix_time::milliseconds(1));
         timer.wait();
       }
     }
@@ -242,18 +234,13 @@ void SocketCommunication::requestConnection(std::string const &acceptorName,
     
     int acceptorRank = -1;
     asio::read(*socket, asio::buffer(&acceptorRank, sizeof(int)));
-    _sockets[0] = socket; // should be acceptorRank instead of 0, likewise all communication below
+    addSocket(0, socket); // should be acceptorRank instead of 0, likewise all communication below
     
     send(requesterCommunicatorSize, 0);
 
   } catch (std::exception &e) {
     ERROR("Requesting connection to " << address << " failed: " << e.what());
   }
-
-  // NOTE:
-  // Keep IO service running so that it fires asynchronous handlers from another thread.
-  _work   = std::make_shared<asio::io_service::work>(*_ioService);
-  _thread = std::thread([this]() { _ioService->run(); });
 }
 
 void SocketCommunication::requestConnectionAsClient(std::string      const &acceptorName,
@@ -281,7 +268,7 @@ void SocketCommunication::requestConnectionAsClient(std::string      const &acce
 
       _portNumber = static_cast<unsigned short>(std::stoi(portNumber));
 
-      auto socket = std::make_shared<Socket>(*_ioService);
+      auto socket = std::make_shared<Socket>(_ioService->getIOService());
 
       using asio::ip::tcp;
 
@@ -290,7 +277,7 @@ void SocketCommunication::requestConnectionAsClient(std::string      const &acce
       tcp::resolver::query query(tcp::v4(), ipAddress, portNumber);
 
       while (not isConnected()) {
-        tcp::resolver resolver(*_ioService);
+        tcp::resolver resolver(_ioService->getIOService());
         tcp::resolver::iterator endpoint_iterator = resolver.resolve(query);
         boost::system::error_code error = asio::error::host_not_found;
         boost::asio::connect(*socket, endpoint_iterator, error);
@@ -300,23 +287,19 @@ void SocketCommunication::requestConnectionAsClient(std::string      const &acce
         if (not isConnected()) {
           // Wait a little, since after a couple of ten-thousand trials the system
           // seems to get confused and the requester connects wrongly to itself.
-          boost::asio::deadline_timer timer(*_ioService, boost::posix_time::milliseconds(1));
+          boost::asio::deadline_timer timer(_ioService->getIOService(), boost::posix_time::milliseconds(1));
           timer.wait();
         }
       }
       
       DEBUG("Requested connection to " << address << ", rank = " << acceptorRank);
-      _sockets[acceptorRank] = socket;
+      addSocket(acceptorRank, socket);
       send(requesterRank, acceptorRank); // send my rank
 
     } catch (std::exception &e) {
       ERROR("Requesting connection to " << address << " failed: " << e.what());
     }
   }
-  // NOTE:
-  // Keep IO service running so that it fires asynchronous handlers from another thread.
-  _work   = std::make_shared<asio::io_service::work>(*_ioService);
-  _thread = std::thread([this]() { _ioService->run(); });
 }
 
 void SocketCommunication::closeConnection()
@@ -326,19 +309,29 @@ void SocketCommunication::closeConnection()
   if (not isConnected())
     return;
 
-  if (_thread.joinable()) {
-    _work.reset();
-    _ioService->stop();
-    _thread.join();
-  }
-
+  // Pending asynchronous operations are aborted and their handlers run on the shared I/O service
   for (auto &socket : _sockets) {
     assertion(socket.second->is_open());
     socket.second->shutdown(Socket::shutdown_both);
     socket.second->close();
   }
 
-  _isConnected            = false;
+  _isConnected = false;
+}
+
+std::vector<int> SocketCommunication::getConnectedRanks() const
+{
+  std::vector<int> ranks;
+  for (auto &socket : _sockets) {
+    ranks.push_back(socket.first);
+  }
+  return ranks;
+}
+
+void SocketCommunication::addSocket(int remoteRank, std::shared_ptr<Socket> socket)
+{
+  _sockets[remoteRank] = socket;
+  _strands.emplace(remoteRank, Strand(_ioService->getIOService()));
 }
 
 void SocketCommunication::send(std::string const &itemToSend, int rankReceiver)
@@ -384,14 +377,14 @@ PtrRequest SocketCommunication::aSend(const int *itemsToSend, int size, int rank
   assertion(rankReceiver >= 0, rankReceiver);
   assertion(isConnected());
 
-  PtrRequest request(new SocketRequest);
+  PtrRequest request = _requestPool->acquire();
 
   try {
     asio::async_write(*_sockets[rankReceiver],
                       asio::buffer(itemsToSend, size * sizeof(int)),
-                      [request](boost::system::error_code const &, std::size_t) {
+                      _strands.at(rankReceiver).wrap([request](boost::system::error_code const &, std::size_t) {
                         std::static_pointer_cast<SocketRequest>(request)->complete();
-                      });
+                      }));
   } catch (std::exception &e) {
     ERROR("Send failed: " << e.what());
   }
@@ -424,14 +417,14 @@ PtrRequest SocketCommunication::aSend(const double *itemsToSend, int size, int r
   assertion(rankReceiver >= 0, rankReceiver);
   assertion(isConnected());
 
-  PtrRequest request(new SocketRequest);
+  PtrRequest request = _requestPool->acquire();
 
   try {
     asio::async_write(*_sockets[rankReceiver],
                       asio::buffer(itemsToSend, size * sizeof(double)),
-                      [request](boost::system::error_code const &, std::size_t) {
+                      _strands.at(rankReceiver).wrap([request](boost::system::error_code const &, std::size_t) {
                         std::static_pointer_cast<SocketRequest>(request)->complete();
-                      });
+                      }));
   } catch (std::exception &e) {
     ERROR("Send failed: " << e.what());
   }
@@ -448,14 +441,14 @@ PtrRequest SocketCommunication::aSend(std::vector<double> const & itemsToSend, i
   assertion(rankReceiver >= 0, rankReceiver);
   assertion(isConnected());
 
-  PtrRequest request(new SocketRequest);
+  PtrRequest request = _requestPool->acquire();
 
   try {
     asio::async_write(*_sockets[rankReceiver],
                       asio::buffer(itemsToSend),
-                      [request](boost::system::error_code const &, std::size_t) {
+                      _strands.at(rankReceiver).wrap([request](boost::system::error_code const &, std::size_t) {
                         std::static_pointer_cast<SocketRequest>(request)->complete();
-                      });
+                      }));
   } catch (std::exception &e) {
     ERROR("Send failed: " << e.what());
   }
@@ -531,14 +524,14 @@ PtrRequest SocketCommunication::aSend(const bool & itemToSend, int rankReceiver)
   assertion(rankReceiver >= 0, rankReceiver);
   assertion(isConnected());
 
-  PtrRequest request(new SocketRequest);
+  PtrRequest request = _requestPool->acquire();
 
   try {
     asio::async_write(*_sockets[rankReceiver],
                       asio::buffer(&itemToSend, sizeof(bool)),
-                      [request](boost::system::error_code const &, std::size_t) {
+                      _strands.at(rankReceiver).wrap([request](boost::system::error_code const &, std::size_t) {
                         std::static_pointer_cast<SocketRequest>(request)->complete();
-                      });
+                      }));
   } catch (std::exception &e) {
     ERROR("Send failed: " << e.what());
   }
@@ -610,14 +603,14 @@ PtrRequest SocketCommunication::aReceive(double *itemsToReceive,
   assertion(rankSender >= 0, rankSender);
   assertion(isConnected());
 
-  PtrRequest request(new SocketRequest);
+  PtrRequest request = _requestPool->acquire();
 
   try {
     asio::async_read(*_sockets[rankSender],
                      asio::buffer(itemsToReceive, size * sizeof(double)),
-                     [request](boost::system::error_code const &, std::size_t) {
+                     _strands.at(rankSender).wrap([request](boost::system::error_code const &, std::size_t) {
                        std::static_pointer_cast<SocketRequest>(request)->complete();
-                     });
+                     }));
   } catch (std::exception &e) {
     ERROR("Receive failed: " << e.what());
   }
@@ -634,14 +627,14 @@ PtrRequest SocketCommunication::aReceive(std::vector<double> & itemsToReceive, i
   assertion(rankSender >= 0, rankSender);
   assertion(isConnected());
 
-  PtrRequest request(new SocketRequest);
+  PtrRequest request = _requestPool->acquire();
 
   try {
     asio::async_read(*_sockets[rankSender],
                      asio::buffer(itemsToReceive),
-                     [request](boost::system::error_code const &, std::size_t) {
+                     _strands.at(rankSender).wrap([request](boost::system::error_code const &, std::size_t) {
                        std::static_pointer_cast<SocketRequest>(request)->complete();
-                     });
+                     }));
   } catch (std::exception &e) {
     ERROR("Receive failed: " << e.what());
   }
@@ -696,14 +689,14 @@ PtrRequest SocketCommunication::aReceive(int &itemToReceive, int rankSender)
             rankSender, _sockets.size());
   assertion(isConnected());
 
-  PtrRequest request(new SocketRequest);
+  PtrRequest request = _requestPool->acquire();
 
   try {
     asio::async_read(*_sockets[rankSender],
                      asio::buffer(&itemToReceive, sizeof(int)),
-                     [request](boost::system::error_code const &, std::size_t) {
+                     _strands.at(rankSender).wrap([request](boost::system::error_code const &, std::size_t) {
                        std::static_pointer_cast<SocketRequest>(request)->complete();
-                     });
+                     }));
   } catch (std::exception &e) {
     ERROR("Receive failed: " << e.what());
   }
@@ -736,14 +729,14 @@ PtrRequest SocketCommunication::aReceive(bool &itemToReceive, int rankSender)
   assertion(rankSender >= 0, rankSender);
   assertion(isConnected());
 
-  PtrRequest request(new SocketRequest);
+  PtrRequest request = _requestPool->acquire();
 
   try {
     asio::async_read(*_sockets[rankSender],
                      asio::buffer(&itemToReceive, sizeof(bool)),
-                     [request](boost::system::error_code const &, std::size_t) {
-                        std::static_pointer_cast<SocketRequest>(request)->complete();
-                     });
+                     _strands.at(rankSender).wrap([request](boost::system::error_code const &, std::size_t) {
+                       std::static_pointer_cast<SocketRequest>(request)->complete();
+                     }));
   } catch (std::exception &e) {
     ERROR("Receive failed: " << e.what());
   }
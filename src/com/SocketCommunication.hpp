@@ -5,12 +5,17 @@
 #include "com/Communication.hpp"
 #include <boost/asio.hpp>
 #include "logging/Logger.hpp"
-#include <thread>
+#include <map>
+#include <memory>
+#include <vector>
 
 namespace precice
 {
 namespace com
 {
+class SocketIOService;
+class SocketRequestPool;
+
 /// Implements Communication by using sockets.
 class SocketCommunication : public Communication
 {
@@ -122,6 +127,10 @@ public:
 
   void send(std::vector<double> const &v, int rankReceiver) override;
   void receive(std::vector<double> &v, int rankSender) override;
+
+protected:
+  /// Returns the remote ranks connected by a socket.
+  std::vector<int> getConnectedRanks() const;
   
 private:
   logging::Logger _log{"com::SocketCommunication"};
@@ -137,19 +146,25 @@ private:
   /// Directory where IP address is exchanged by file.
   std::string _addressDirectory;
 
-  using IOService     = boost::asio::io_service;
-  using TCP           = boost::asio::ip::tcp;
-  using SocketService = boost::asio::stream_socket_service<TCP>;
-  using Socket        = boost::asio::basic_stream_socket<TCP, SocketService>;
-  using Work          = boost::asio::io_service::work;
-  
-  std::shared_ptr<IOService> _ioService;
-  std::shared_ptr<Work> _work;
-  std::thread _thread;
+  using TCP    = boost::asio::ip::tcp;
+  using Socket = TCP::socket;
+  using Strand = boost::asio::io_service::strand;
+
+  /// Process-wide I/O service shared by all socket communications.
+  std::shared_ptr<SocketIOService> _ioService;
+
+  /// Reusable requests of asynchronous operations.
+  std::shared_ptr<SocketRequestPool> _requestPool;
   
   /// Remote rank -> socket map
   std::map<int, std::shared_ptr<Socket>> _sockets;
 
+  /// Remote rank -> strand serializing the asynchronous handlers of the socket
+  std::map<int, Strand> _strands;
+
+  /// Registers the socket to a remote rank.
+  void addSocket(int remoteRank, std::shared_ptr<Socket> socket);
+
   bool isClient();
   bool isServer();
 
@@ -0,0 +1,66 @@
+#ifndef PRECICE_NO_SOCKETS
+
+#include "SocketIOService.hpp"
+#include "utils/assertion.hpp"
+
+namespace precice
+{
+namespace com
+{
+logging::Logger SocketIOService::_log("com::SocketIOService");
+
+std::weak_ptr<SocketIOService> SocketIOService::_instance;
+
+std::mutex SocketIOService::_instanceMutex;
+
+int SocketIOService::_numberOfThreads = 1;
+
+SocketIOService::SocketIOService(int numberOfThreads)
+    : _work(new IOService::work(_ioService))
+{
+  TRACE(numberOfThreads);
+  assertion(numberOfThreads > 0, numberOfThreads);
+  for (int i = 0; i < numberOfThreads; i++) {
+    _threads.emplace_back([this]() { _ioService.run(); });
+  }
+}
+
+SocketIOService::~SocketIOService()
+{
+  TRACE();
+  // All communications have closed their sockets, handlers of aborted operations are not needed
+  _work.reset();
+  _ioService.stop();
+  for (std::thread &thread : _threads) {
+    thread.join();
+  }
+}
+
+std::shared_ptr<SocketIOService> SocketIOService::getInstance()
+{
+  std::lock_guard<std::mutex> lock(_instanceMutex);
+  std::shared_ptr<SocketIOService> instance = _instance.lock();
+  if (not instance) {
+    instance  = std::make_shared<SocketIOService>(_numberOfThreads);
+    _instance = instance;
+  }
+  return instance;
+}
+
+void SocketIOService::setNumberOfThreads(int numberOfThreads)
+{
+  std::lock_guard<std::mutex> lock(_instanceMutex);
+  assertion(numberOfThreads > 0, numberOfThreads);
+  std::shared_ptr<SocketIOService> instance = _instance.lock();
+  if (instance and instance->getNumberOfThreads() != numberOfThreads) {
+    WARN("The socket I/O service of this process is already running with " << instance->getNumberOfThreads()
+         << " threads. " << numberOfThreads << " threads are only used once it has been restarted, "
+         << "i.e., after all socket communications have been closed.");
+  }
+  _numberOfThreads = numberOfThreads;
+}
+
+} // namespace com
+} // namespace precice
+
+#endif // not PRECICE_NO_SOCKETS
@@ -0,0 +1,73 @@
+#ifndef PRECICE_NO_SOCKETS
+
+#pragma once
+
+#include <boost/asio.hpp>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "logging/Logger.hpp"
+
+namespace precice
+{
+namespace com
+{
+/**
+ * @brief Process-wide I/O service running the asynchronous operations of all socket communications.
+ *
+ * A fixed number of threads runs the service, independent of the number of communication
+ * partners. The service is started on first use and stopped when the last socket communication
+ * releases it. Communications serialize the handlers of each socket by a strand.
+ */
+class SocketIOService
+{
+public:
+  using IOService = boost::asio::io_service;
+
+  explicit SocketIOService(int numberOfThreads);
+
+  /// Stops the service as soon as all pending handlers have been run.
+  ~SocketIOService();
+
+  /// Returns the running process-wide service, starts it if required.
+  static std::shared_ptr<SocketIOService> getInstance();
+
+  /**
+   * @brief Sets the number of threads used when the process-wide service is started the next time.
+   *
+   * The setting is global to the process. A running service keeps its threads, a warning is
+   * given if their number differs.
+   */
+  static void setNumberOfThreads(int numberOfThreads);
+
+  IOService &getIOService()
+  {
+    return _ioService;
+  }
+
+  int getNumberOfThreads() const
+  {
+    return static_cast<int>(_threads.size());
+  }
+
+private:
+  static logging::Logger _log;
+
+  IOService _ioService;
+
+  /// Keeps the threads running while no asynchronous operation is pending.
+  std::unique_ptr<IOService::work> _work;
+
+  std::vector<std::thread> _threads;
+
+  static std::weak_ptr<SocketIOService> _instance;
+
+  static std::mutex _instanceMutex;
+
+  static int _numberOfThreads;
+};
+} // namespace com
+} // namespace precice
+
+#endif // not PRECICE_NO_SOCKETS
@@ -1,37 +1,121 @@
 #include "SocketRequest.hpp"
+#include <thread>
 
 namespace precice
 {
 namespace com
 {
+namespace
+{
+/// Number of checks of the completion flag before a waiting thread parks.
+const int SPIN_ITERATIONS = 1000;
+} // namespace
+
+logging::Logger SocketRequest::_log("com::SocketRequest");
+
 SocketRequest::SocketRequest()
-    : _complete(false)
+    : _complete(false),
+      _failed(false),
+      _waiting(false)
 {
 }
 
-void SocketRequest::complete()
+void SocketRequest::complete(bool success)
 {
-  {
+  _failed.store(not success);
+  _complete.store(true);
+
+  // only take the lock, if a waiting thread might be parked
+  if (_waiting.load()) {
     std::lock_guard<std::mutex> lock(_completeMutex);
+    _completeCondition.notify_one();
+    if (_notifier)
+      _notifier->notify();
+  }
+}
 
-    _complete = true;
+bool SocketRequest::test()
+{
+  if (not _complete.load(std::memory_order_acquire))
+    return false;
+  checkSuccess();
+  return true;
+}
+
+void SocketRequest::wait()
+{
+  for (int i = 0; i < SPIN_ITERATIONS; i++) {
+    if (_complete.load(std::memory_order_acquire)) {
+      checkSuccess();
+      return;
+    }
+    if (i >= SPIN_ITERATIONS / 2)
+      std::this_thread::yield();
   }
 
-  _completeCondition.notify_one();
+  std::unique_lock<std::mutex> lock(_completeMutex);
+  _waiting.store(true);
+  _completeCondition.wait(lock, [this] { return _complete.load(); });
+  _waiting.store(_notifier != nullptr);
+  checkSuccess();
 }
 
-bool SocketRequest::test()
+bool SocketRequest::setNotifier(PtrNotifier const &notifier)
 {
   std::lock_guard<std::mutex> lock(_completeMutex);
+  _notifier = notifier;
+  _waiting.store(notifier != nullptr);
+  return true;
+}
+
+void SocketRequest::reset()
+{
+  _complete.store(false);
+  _failed.store(false);
+  _waiting.store(false);
+  _notifier = nullptr;
+}
 
-  return _complete;
+void SocketRequest::checkSuccess() const
+{
+  if (_failed.load()) {
+    ERROR("Asynchronous send or receive failed: the connection has been closed");
+  }
 }
 
-void SocketRequest::wait()
+SocketRequestPool::~SocketRequestPool()
 {
-  std::unique_lock<std::mutex> lock(_completeMutex);
+  for (SocketRequest *request : _freeRequests) {
+    delete request;
+  }
+}
 
-  _completeCondition.wait(lock, [this] { return _complete; });
+PtrRequest SocketRequestPool::acquire()
+{
+  SocketRequest *request = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(_freeRequestsMutex);
+    if (not _freeRequests.empty()) {
+      request = _freeRequests.back();
+      _freeRequests.pop_back();
+    }
+  }
+  if (request == nullptr) {
+    request = new SocketRequest;
+  } else {
+    request->reset();
+  }
+
+  // the pool is kept alive by its requests, which may outlive the communication
+  PtrSocketRequestPool pool = shared_from_this();
+  return PtrRequest(request, [pool](SocketRequest *released) { pool->release(released); });
 }
+
+void SocketRequestPool::release(SocketRequest *request)
+{
+  std::lock_guard<std::mutex> lock(_freeRequestsMutex);
+  _freeRequests.push_back(request);
+}
+
 } // namespace com
 } // namespace precice
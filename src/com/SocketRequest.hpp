@@ -2,31 +2,88 @@
 #ifndef PRECICE_NO_SOCKETS
 
 #include "Request.hpp"
+#include "logging/Logger.hpp"
 
+#include <atomic>
 #include <condition_variable>
+#include <memory>
 #include <mutex>
+#include <vector>
 
 namespace precice
 {
 namespace com
 {
+/**
+ * @brief Request of an asynchronous socket operation.
+ *
+ * Completion is signaled by an atomic flag. A waiting thread first spins on the flag and only
+ * parks on the condition variable, if the operation does not complete within a short time.
+ * A registered notifier is notified on completion as well. An operation, which failed because
+ * the connection has been closed, is reported as an error when its completion is observed.
+ */
 class SocketRequest : public Request
 {
 public:
   SocketRequest();
 
-  void complete();
+  /// Marks the operation as completed, success is false if it failed.
+  void complete(bool success = true);
 
   bool test() override;
 
   void wait() override;
 
+  bool setNotifier(PtrNotifier const &notifier) override;
+
+  /// Prepares a pooled request for its next operation.
+  void reset();
+
 private:
-  bool _complete;
+  static logging::Logger _log;
+
+  /// Raises an error, if the completed operation failed.
+  void checkSuccess() const;
+
+  std::atomic<bool> _complete;
+
+  /// True, if the completed operation failed. Written before _complete.
+  std::atomic<bool> _failed;
+
+  /// True, if a thread is parked or about to park in wait(), or a notifier is registered.
+  std::atomic<bool> _waiting;
+
+  /// Notified on completion, guarded by _completeMutex.
+  PtrNotifier _notifier;
 
   std::condition_variable _completeCondition;
   std::mutex              _completeMutex;
 };
+
+/**
+ * @brief Pool of reusable socket requests.
+ *
+ * Requests obtained by acquire() return to the pool when their last reference is released,
+ * which might happen on the thread running the completion handler.
+ */
+class SocketRequestPool : public std::enable_shared_from_this<SocketRequestPool>
+{
+public:
+  ~SocketRequestPool();
+
+  /// Returns a request, which is not completed.
+  PtrRequest acquire();
+
+private:
+  void release(SocketRequest *request);
+
+  std::vector<SocketRequest *> _freeRequests;
+
+  std::mutex _freeRequestsMutex;
+};
+
+using PtrSocketRequestPool = std::shared_ptr<SocketRequestPool>;
+
 } // namespace com
 } // namespace precice
 
@@ -3,6 +3,7 @@
 #include "com/CommunicateMesh.hpp"
 #include "com/MPIDirectCommunication.hpp"
 #include "mesh/Edge.hpp"
+#include "mesh/Quad.hpp"
 #include "mesh/Triangle.hpp"
 #include "mesh/Mesh.hpp"
 #include "mesh/PropertyContainer.hpp"
@@ -188,6 +189,65 @@ BOOST_AUTO_TEST_CASE(BroadcastVertexEdgeTriangleMesh,
   }
 }
 
+BOOST_AUTO_TEST_CASE(VertexEdgeQuadMesh,
+                     * testing::MinRanks(2))
+{
+  utils::Parallel::synchronizeProcesses();
+  assertion(utils::Parallel::getCommunicatorSize() > 1);
+  mesh::PropertyContainer::resetPropertyIDCounter();
+
+  std::string participant0("rank0");
+  std::string participant1("rank1");
+
+  int dim = 3;
+  mesh::Mesh sendMesh("Sent Mesh", dim, false);
+  mesh::Vertex &v0 = sendMesh.createVertex(Eigen::Vector3d(0.0, 0.0, 0.0));
+  mesh::Vertex &v1 = sendMesh.createVertex(Eigen::Vector3d(1.0, 0.0, 0.0));
+  mesh::Vertex &v2 = sendMesh.createVertex(Eigen::Vector3d(1.0, 1.0, 0.0));
+  mesh::Vertex &v3 = sendMesh.createVertex(Eigen::Vector3d(0.0, 1.0, 0.0));
+  mesh::Edge &e0 = sendMesh.createEdge(v0, v1);
+  mesh::Edge &e1 = sendMesh.createEdge(v1, v2);
+  mesh::Edge &e2 = sendMesh.createEdge(v2, v3);
+  mesh::Edge &e3 = sendMesh.createEdge(v3, v0);
+  mesh::Quad &q0 = sendMesh.createQuad(e0, e1, e2, e3);
+  for (int i = 0; i < 4; i++) {
+    sendMesh.vertices()[i].setGlobalIndex(10 + i);
+  }
+
+  // Create mesh communicator
+  std::vector<int> involvedRanks = {0, 1};
+  MPI_Comm         comm          = utils::Parallel::getRestrictedCommunicator(involvedRanks);
+
+  if (utils::Parallel::getProcessRank() < 2) {
+    utils::Parallel::setGlobalCommunicator(comm);
+    com::PtrCommunication com(new com::MPIDirectCommunication());
+    CommunicateMesh       comMesh(com);
+
+    if (utils::Parallel::getProcessRank() == 0) {
+      utils::Parallel::splitCommunicator(participant0);
+      com->acceptConnection(participant0, participant1, utils::Parallel::getProcessRank());
+      comMesh.sendMesh(sendMesh, 0);
+    } else if (utils::Parallel::getProcessRank() == 1) {
+      mesh::Mesh recvMesh("Received Mesh", dim, false);
+      utils::Parallel::splitCommunicator(participant1);
+      com->requestConnection(participant0, participant1, 0, 1);
+      comMesh.receiveMesh(recvMesh, 0);
+      BOOST_TEST(recvMesh.vertices().size() == 4);
+      BOOST_TEST(recvMesh.edges().size() == 4);
+      BOOST_TEST(recvMesh.triangles().size() == 0);
+      BOOST_TEST(recvMesh.quads().size() == 1);
+      for (int i = 0; i < 4; i++) {
+        BOOST_TEST(recvMesh.vertices()[i].getGlobalIndex() == 10 + i);
+      }
+      BOOST_TEST(recvMesh.quads()[0] == q0);
+    }
+    com->closeConnection();
+
+    utils::Parallel::clearGroups();
+    utils::Parallel::setGlobalCommunicator(utils::Parallel::getCommunicatorWorld());
+  }
+}
+
 
 BOOST_AUTO_TEST_SUITE_END() // Mesh
 BOOST_AUTO_TEST_SUITE_END() // Communication
@@ -3,7 +3,7 @@
 using namespace precice;
 
 /// Generic test function that is called from the tests for MPIPortsCommunication,
-/// MPIDirectCommunication and SocketCommunication
+/// MPIDirectCommunication, SocketCommunication and SharedMemoryCommunication
 
 
 /// This tests still uses the old rank enumeration
@@ -0,0 +1,57 @@
+#ifndef PRECICE_NO_MPI
+
+#include <mpi.h>
+#include "com/MPIRequest.hpp"
+#include "testing/Testing.hpp"
+#include "utils/Parallel.hpp"
+
+using namespace precice;
+using namespace precice::com;
+
+BOOST_AUTO_TEST_SUITE(CommunicationTests)
+
+BOOST_AUTO_TEST_SUITE(MPIRequest)
+
+BOOST_AUTO_TEST_CASE(WaitAnyHigherRankFirst,
+                     * testing::MinRanks(3)
+                     * boost::unit_test::fixture<testing::MPICommRestrictFixture>(std::vector<int>({0, 1, 2})))
+{
+  if (utils::Parallel::getCommunicatorSize() != 3) // only run test on ranks {0,1,2}, for other ranks return
+    return;
+
+  MPI_Comm comm = utils::Parallel::getGlobalCommunicator();
+  int      rank = utils::Parallel::getProcessRank();
+
+  if (rank == 0) {
+    std::vector<int>        values(2, -1);
+    std::vector<PtrRequest> requests;
+    for (int source = 1; source <= 2; source++) {
+      MPI_Request request;
+      MPI_Irecv(&values[source - 1], 1, MPI_INT, source, 0, comm, &request);
+      requests.push_back(std::make_shared<com::MPIRequest>(request));
+    }
+
+    // rank 1 only sends after rank 2 has been received, waiting for rank 1 first would deadlock
+    BOOST_TEST(Request::waitAny(requests) == 1);
+    BOOST_TEST(values[1] == 2);
+    BOOST_TEST(requests[1] == nullptr);
+    int go = 1;
+    MPI_Send(&go, 1, MPI_INT, 1, 1, comm);
+
+    BOOST_TEST(Request::waitAny(requests) == 0);
+    BOOST_TEST(values[0] == 1);
+    BOOST_TEST(Request::waitAny(requests) == requests.size());
+  } else if (rank == 1) {
+    int go = 0;
+    MPI_Recv(&go, 1, MPI_INT, 0, 1, comm, MPI_STATUS_IGNORE);
+    MPI_Send(&rank, 1, MPI_INT, 0, 0, comm);
+  } else {
+    MPI_Send(&rank, 1, MPI_INT, 0, 0, comm);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END() // MPIRequest
+
+BOOST_AUTO_TEST_SUITE_END() // CommunicationTests
+
+#endif // not PRECICE_NO_MPI
@@ -0,0 +1,137 @@
+#if !defined(PRECICE_NO_SOCKETS) && defined(__linux__)
+
+#include <unistd.h>
+#include <numeric>
+#include <thread>
+#include "com/SharedMemoryChannel.hpp"
+#include "com/SharedMemoryCommunication.hpp"
+#include "testing/Testing.hpp"
+#include "GenericTestFunctions.hpp"
+
+using namespace precice;
+using namespace precice::com;
+
+BOOST_AUTO_TEST_SUITE(CommunicationTests)
+
+BOOST_AUTO_TEST_SUITE(SharedMemory)
+
+BOOST_AUTO_TEST_CASE(Channel, * testing::OnMaster())
+{
+  std::string name    = "/precice-test-" + std::to_string(getpid());
+  auto        creator = SharedMemoryChannel::create(name, 256);
+  BOOST_REQUIRE(creator);
+  auto opener = SharedMemoryChannel::open(name);
+  BOOST_REQUIRE(opener);
+  opener->unlink();
+  BOOST_TEST(opener->getCapacity() == 256);
+
+  // Messages larger than the buffer wrap around several times
+  std::vector<int> sent(1000);
+  std::iota(sent.begin(), sent.end(), 0);
+  std::vector<int> received(sent.size(), -1);
+  std::thread      writer([&] { BOOST_TEST(creator->write(sent.data(), sent.size() * sizeof(int))); });
+  BOOST_TEST(opener->read(received.data(), received.size() * sizeof(int)));
+  writer.join();
+  BOOST_TEST(received == sent, boost::test_tools::per_element());
+
+  // Both directions are independent
+  double value = 1.5;
+  BOOST_TEST(opener->write(&value, sizeof(double)));
+  value = 0.0;
+  BOOST_TEST(creator->read(&value, sizeof(double)));
+  BOOST_TEST(value == 1.5);
+
+  // Data written before closing is still delivered, a blocked reader is woken up
+  BOOST_TEST(creator->write(&value, sizeof(double)));
+  std::thread closer([&] {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    creator->close();
+  });
+  double first = 0.0, second = 0.0;
+  BOOST_TEST(opener->read(&first, sizeof(double)));
+  BOOST_TEST(first == 1.5);
+  BOOST_TEST(not opener->read(&second, sizeof(double)));
+  closer.join();
+  BOOST_TEST(not opener->write(&value, sizeof(double)));
+}
+
+BOOST_AUTO_TEST_CASE(SendAndReceive,
+                     * testing::MinRanks(2))
+{
+  TestSendAndReceive<SharedMemoryCommunication>();
+}
+
+BOOST_AUTO_TEST_CASE(SendReceiveFourProcesses,
+                     * testing::MinRanks(4)
+                     * boost::unit_test::fixture<testing::SyncProcessesFixture>())
+{
+  TestSendReceiveFourProcesses<SharedMemoryCommunication>();
+}
+
+BOOST_AUTO_TEST_CASE(SendReceiveTwoProcessesServerClient,
+                     * testing::MinRanks(2)
+                     * boost::unit_test::fixture<testing::SyncProcessesFixture>())
+{
+  TestSendReceiveTwoProcessesServerClient<SharedMemoryCommunication>();
+}
+
+BOOST_AUTO_TEST_CASE(SendReceiveFourProcessesServerClient,
+                     * testing::MinRanks(4)
+                     * boost::unit_test::fixture<testing::SyncProcessesFixture>())
+{
+  TestSendReceiveFourProcessesServerClient<SharedMemoryCommunication>();
+}
+
+BOOST_AUTO_TEST_CASE(SendReceiveFourProcessesServerClientV2,
+                     * testing::MinRanks(4)
+                     * boost::unit_test::fixture<testing::SyncProcessesFixture>())
+{
+  TestSendReceiveFourProcessesServerClientV2<SharedMemoryCommunication>();
+}
+
+/// Both ranks send a message much larger than the buffer asynchronously before receiving.
+BOOST_AUTO_TEST_CASE(AsynchronousLargeMessages,
+                     * testing::MinRanks(2)
+                     * boost::unit_test::fixture<testing::SyncProcessesFixture>())
+{
+  const int rank = utils::Parallel::getProcessRank();
+  if (rank > 1)
+    return;
+
+  SharedMemoryCommunication com(1024);
+  if (rank == 0) {
+    com.acceptConnection("process0", "process1", rank);
+  } else {
+    com.requestConnection("process0", "process1", 0, 1);
+  }
+  BOOST_TEST(com.getNumberOfSharedMemoryPeers() == 1);
+
+  std::vector<double> sent(10000);
+  std::iota(sent.begin(), sent.end(), rank * sent.size());
+  std::vector<double> received(sent.size());
+  auto                sendRequest    = com.aSend(sent, 0);
+  auto                receiveRequest = com.aReceive(received, 0);
+  sendRequest->wait();
+  receiveRequest->wait();
+
+  std::vector<double> expected(sent.size());
+  std::iota(expected.begin(), expected.end(), (1 - rank) * sent.size());
+  BOOST_TEST(received == expected, boost::test_tools::per_element());
+
+  // A blocking operation is ordered after the pending asynchronous ones
+  int first = rank, second = rank + 10;
+  auto request = com.aSend(first, 0);
+  com.send(second, 0);
+  request->wait();
+  com.receive(first, 0);
+  com.receive(second, 0);
+  BOOST_TEST(first == 1 - rank);
+  BOOST_TEST(second == 11 - rank);
+
+  com.closeConnection();
+}
+
+BOOST_AUTO_TEST_SUITE_END() // SharedMemory
+BOOST_AUTO_TEST_SUITE_END() // CommunicationTests
+
+#endif // not PRECICE_NO_SOCKETS and __linux__
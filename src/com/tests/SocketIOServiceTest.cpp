@@ -0,0 +1,53 @@
+#ifndef PRECICE_NO_SOCKETS
+
+#include <atomic>
+#include "com/SocketIOService.hpp"
+#include "testing/Testing.hpp"
+
+using namespace precice;
+using namespace precice::com;
+
+BOOST_AUTO_TEST_SUITE(CommunicationTests)
+
+BOOST_AUTO_TEST_SUITE(Socket)
+
+BOOST_AUTO_TEST_CASE(SharedIOService, * testing::OnMaster())
+{
+  SocketIOService::setNumberOfThreads(3);
+  {
+    auto service      = SocketIOService::getInstance();
+    auto otherService = SocketIOService::getInstance();
+    BOOST_TEST(service == otherService);
+    BOOST_TEST(service->getNumberOfThreads() == 3);
+
+    // handlers of one strand are never run concurrently, but all are run
+    boost::asio::io_service::strand strand(service->getIOService());
+    std::atomic<int> running(0);
+    std::atomic<int> maxRunning(0);
+    std::atomic<int> done(0);
+    for (int i = 0; i < 100; i++) {
+      service->getIOService().post(strand.wrap([&]() {
+        int current = ++running;
+        if (current > maxRunning)
+          maxRunning = current;
+        running--;
+        done++;
+      }));
+    }
+    while (done < 100)
+      std::this_thread::yield();
+    BOOST_TEST(maxRunning == 1);
+
+    // the running service keeps its threads
+    SocketIOService::setNumberOfThreads(1);
+    BOOST_TEST(SocketIOService::getInstance()->getNumberOfThreads() == 3);
+  }
+
+  // the service is restarted with the configured number of threads after its release
+  BOOST_TEST(SocketIOService::getInstance()->getNumberOfThreads() == 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Socket
+BOOST_AUTO_TEST_SUITE_END() // CommunicationTests
+
+#endif // not PRECICE_NO_SOCKETS
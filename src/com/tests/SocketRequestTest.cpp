@@ -0,0 +1,92 @@
+#ifndef PRECICE_NO_SOCKETS
+
+#include <time.h>
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include "com/SocketRequest.hpp"
+#include "testing/Testing.hpp"
+
+using namespace precice;
+using namespace precice::com;
+
+BOOST_AUTO_TEST_SUITE(CommunicationTests)
+
+BOOST_AUTO_TEST_SUITE(Socket)
+
+BOOST_AUTO_TEST_CASE(RequestPoolReuse, * testing::OnMaster())
+{
+  auto pool = std::make_shared<SocketRequestPool>();
+
+  PtrRequest request = pool->acquire();
+  Request *  address = request.get();
+  BOOST_TEST(not request->test());
+  std::static_pointer_cast<SocketRequest>(request)->complete();
+  BOOST_TEST(request->test());
+  request->wait();
+
+  // released requests are handed out again, reset to not completed
+  request = nullptr;
+  request = pool->acquire();
+  BOOST_TEST(request.get() == address);
+  BOOST_TEST(not request->test());
+  std::static_pointer_cast<SocketRequest>(request)->complete();
+}
+
+BOOST_AUTO_TEST_CASE(RequestWaitAny, * testing::OnMaster())
+{
+  auto pool = std::make_shared<SocketRequestPool>();
+
+  std::vector<PtrRequest> requests{pool->acquire(), nullptr, pool->acquire(), pool->acquire()};
+  std::vector<PtrRequest> toComplete{requests[3], requests[0], requests[2]};
+
+  // complete the requests in reverse order from another thread
+  std::thread completer([&toComplete]() {
+    for (auto &request : toComplete) {
+      std::static_pointer_cast<SocketRequest>(request)->complete();
+    }
+  });
+
+  std::vector<size_t> completed;
+  for (size_t index = Request::waitAny(requests); index < requests.size(); index = Request::waitAny(requests)) {
+    completed.push_back(index);
+  }
+  completer.join();
+
+  std::sort(completed.begin(), completed.end());
+  BOOST_TEST(completed == std::vector<size_t>({0, 2, 3}), boost::test_tools::per_element());
+  for (auto &request : requests) {
+    BOOST_TEST(request == nullptr);
+  }
+}
+
+/// A thread waiting for any request parks instead of polling until completion.
+BOOST_AUTO_TEST_CASE(RequestWaitAnyParks, * testing::OnMaster())
+{
+  auto pool = std::make_shared<SocketRequestPool>();
+
+  std::vector<PtrRequest> requests{pool->acquire(), pool->acquire()};
+  PtrRequest              toComplete = requests[1];
+  std::thread             completer([&toComplete]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    std::static_pointer_cast<SocketRequest>(toComplete)->complete();
+  });
+
+  timespec start, end;
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &start);
+  BOOST_TEST(Request::waitAny(requests) == 1);
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &end);
+  completer.join();
+
+  double cpuSeconds = (end.tv_sec - start.tv_sec) + 1e-9 * (end.tv_nsec - start.tv_nsec);
+  BOOST_TEST(cpuSeconds < 0.1);
+  BOOST_TEST(requests[0] != nullptr);
+  BOOST_TEST(requests[1] == nullptr);
+  std::static_pointer_cast<SocketRequest>(requests[0])->complete();
+  BOOST_TEST(Request::waitAny(requests) == 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Socket
+BOOST_AUTO_TEST_SUITE_END() // CommunicationTests
+
+#endif // not PRECICE_NO_SOCKETS
@@ -1,11 +1,14 @@
 #include "BaseCouplingScheme.hpp"
 #include <Eigen/Core>
+#include <algorithm>
 #include <limits>
 #include <sstream>
 #include "com/Communication.hpp"
 #include "com/SharedPointer.hpp"
 #include "impl/ConvergenceMeasure.hpp"
 #include "impl/PostProcessing.hpp"
+#include "io/BinaryReader.hpp"
+#include "io/BinaryWriter.hpp"
 #include "io/TXTReader.hpp"
 #include "io/TXTWriter.hpp"
 #include "m2n/M2N.hpp"
@@ -237,7 +240,7 @@ std::vector<int> BaseCouplingScheme::sendData(m2n::PtrM2N m2n)
   for (const DataMap::value_type &pair : _sendData) {
     //std::cout<<"\nsend data id="<<pair.first<<": "<<*(pair.second->values)<<std::endl;
     int size = pair.second->values->size();
-    m2n->send(pair.second->values->data(), size, pair.second->mesh->getID(), pair.second->dimension);
+    m2n->send(pair.second->values->data(), size, pair.second->mesh->getID(), pair.second->dimension, pair.first);
     sentDataIDs.push_back(pair.first);
   }
   DEBUG("Number of sent data sets = " << sentDataIDs.size());
@@ -255,7 +258,7 @@ std::vector<int> BaseCouplingScheme::receiveData(
   for (DataMap::value_type &pair : _receiveData) {
     int size = pair.second->values->size();
     //std::cout<<"\nreceive data id="<<pair.first<<": "<<*(pair.second->values)<<std::endl;
-    m2n->receive(pair.second->values->data(), size, pair.second->mesh->getID(), pair.second->dimension);
+    m2n->receive(pair.second->values->data(), size, pair.second->mesh->getID(), pair.second->dimension, pair.first);
     receivedDataIDs.push_back(pair.first);
   }
   DEBUG("Number of received data sets = " << receivedDataIDs.size());
@@ -304,6 +307,78 @@ void BaseCouplingScheme::finalize()
   CHECK(isInitialized(), "Called finalize() before initialize()!");
 }
 
+namespace {
+/// Version of the checkpoint format written by BaseCouplingScheme::exportState()
+const int CHECKPOINT_FORMAT_VERSION = 1;
+
+std::string getCheckpointFilename(const std::string &filenamePrefix)
+{
+  std::ostringstream filename;
+  // the rank is -1 without master-slave communication
+  filename << filenamePrefix << "_cplscheme_rank" << std::max(0, utils::MasterSlave::_rank) << ".bin";
+  return filename.str();
+}
+} // namespace
+
+void BaseCouplingScheme::exportState(
+    const std::string &filenamePrefix) const
+{
+  TRACE(filenamePrefix);
+  io::BinaryWriter writer(getCheckpointFilename(filenamePrefix));
+  writer.write(CHECKPOINT_FORMAT_VERSION);
+  writer.write(_time);
+  writer.write(_timesteps);
+  writer.write(_totalIterations);
+  for (const DataMap *dataMap : {&_sendData, &_receiveData}) {
+    for (const DataMap::value_type &pair : *dataMap) {
+      writer.write(pair.first);
+      writer.write(pair.second->oldValues);
+    }
+  }
+  // the post-processing is only set up by the participant not doing the first step
+  bool hasPostProcessing = _postProcessing.get() != nullptr && not doesFirstStep();
+  writer.write(hasPostProcessing);
+  if (hasPostProcessing) {
+    _postProcessing->exportState(writer);
+  }
+}
+
+void BaseCouplingScheme::importState(
+    const std::string &filenamePrefix)
+{
+  TRACE(filenamePrefix);
+  CHECK(isInitialized(), "The state of a coupling scheme can only be imported after initialize()!");
+  std::string      filename = getCheckpointFilename(filenamePrefix);
+  io::BinaryReader reader(filename);
+  int              version = 0;
+  reader.read(version);
+  CHECK(version == CHECKPOINT_FORMAT_VERSION,
+        "Checkpoint \"" << filename << "\" has format version " << version
+                        << ", but version " << CHECKPOINT_FORMAT_VERSION << " is required!");
+  reader.read(_time);
+  reader.read(_timesteps);
+  reader.read(_totalIterations);
+  for (DataMap *dataMap : {&_sendData, &_receiveData}) {
+    for (DataMap::value_type &pair : *dataMap) {
+      int             dataID = -1;
+      Eigen::MatrixXd oldValues;
+      reader.read(dataID);
+      reader.read(oldValues);
+      CHECK(dataID == pair.first && oldValues.rows() == pair.second->oldValues.rows() &&
+                oldValues.cols() == pair.second->oldValues.cols(),
+            "Checkpoint \"" << filename << "\" does not match the configured coupling data!");
+      pair.second->oldValues = oldValues;
+    }
+  }
+  bool hasPostProcessing = false;
+  reader.read(hasPostProcessing);
+  CHECK(hasPostProcessing == (_postProcessing.get() != nullptr && not doesFirstStep()),
+        "Checkpoint \"" << filename << "\" does not match the configured post-processing!");
+  if (hasPostProcessing) {
+    _postProcessing->importState(reader);
+  }
+}
+
 void BaseCouplingScheme::setExtrapolationOrder(
     int order)
 {
@@ -526,6 +601,8 @@ std::string BaseCouplingScheme::printActionsState() const
 void BaseCouplingScheme::checkCompletenessRequiredActions()
 {
   TRACE();
+  // Writing a simulation checkpoint is offered to the solver, but not required
+  _actions.erase(constants::actionWriteSimulationCheckpoint());
   if (not _actions.empty()) {
     std::ostringstream stream;
     for (const std::string &action : _actions) {
@@ -629,7 +706,7 @@ void BaseCouplingScheme::addConvergenceMeasure(
 }
 
 bool BaseCouplingScheme::measureConvergence(
-    std::map<int, Eigen::VectorXd> &designSpecifications)
+    const std::map<int, Eigen::VectorXd> &designSpecifications)
 {
   TRACE();
   assertion(not doesFirstStep());
@@ -640,6 +717,7 @@ bool BaseCouplingScheme::measureConvergence(
     _convergenceWriter->writeData("Timestep", _timesteps);
     _convergenceWriter->writeData("Iteration", _iterations);
   }
+  performConvergenceMeasurements(designSpecifications, false);
   for (size_t i = 0; i < _convergenceMeasures.size(); i++) {
     ConvergenceMeasure &convMeasure = _convergenceMeasures[i];
 
@@ -647,15 +725,6 @@ bool BaseCouplingScheme::measureConvergence(
     if (convMeasure.level > 0)
       continue;
 
-    assertion(convMeasure.data != nullptr);
-    assertion(convMeasure.measure.get() != nullptr);
-    const auto &    oldValues = convMeasure.data->oldValues.col(0);
-    Eigen::VectorXd q         = Eigen::VectorXd::Zero(convMeasure.data->values->size());
-    if (designSpecifications.find(convMeasure.dataID) != designSpecifications.end())
-      q = designSpecifications.at(convMeasure.dataID);
-
-    convMeasure.measure->measure(oldValues, *convMeasure.data->values, q);
-
     if (not utils::MasterSlave::_slaveMode) {
       std::stringstream sstm;
       sstm << "resNorm(" << i << ")";
@@ -685,12 +754,13 @@ bool BaseCouplingScheme::measureConvergence(
 /// @todo: ugly hack with design specifications, however, getting them here is not possible as
 // parallel coupling scheme and multi-coupling scheme  need allData and not only getSendData()
 bool BaseCouplingScheme::measureConvergenceCoarseModelOptimization(
-    std::map<int, Eigen::VectorXd> &designSpecifications)
+    const std::map<int, Eigen::VectorXd> &designSpecifications)
 {
   TRACE();
   bool allConverged = true;
   bool oneSuffices  = false;
   assertion(_convergenceMeasures.size() > 0);
+  performConvergenceMeasurements(designSpecifications, true);
   for (ConvergenceMeasure &convMeasure : _convergenceMeasures) {
 
     // only apply convergence measures for coarse model optimization
@@ -698,15 +768,6 @@ bool BaseCouplingScheme::measureConvergenceCoarseModelOptimization(
       continue;
 
     std::cout << "  measure convergence coarse measure, id:" << convMeasure.dataID << std::endl;
-    assertion(convMeasure.data != nullptr);
-    assertion(convMeasure.measure.get() != nullptr);
-    const auto &    oldValues = convMeasure.data->oldValues.col(0);
-    Eigen::VectorXd q         = Eigen::VectorXd::Zero(convMeasure.data->values->size());
-    if (designSpecifications.find(convMeasure.dataID) != designSpecifications.end())
-      q = designSpecifications.at(convMeasure.dataID);
-
-    convMeasure.measure->measure(oldValues, *convMeasure.data->values, q);
-
     if (not convMeasure.measure->isConvergence()) {
       allConverged = false;
     } else if (convMeasure.suffices == true) {
@@ -724,13 +785,57 @@ bool BaseCouplingScheme::measureConvergenceCoarseModelOptimization(
   return allConverged || oneSuffices;
 }
 
+void BaseCouplingScheme::performConvergenceMeasurements(
+    const std::map<int, Eigen::VectorXd> &designSpecifications,
+    bool                                  coarseModel)
+{
+  TRACE(coarseModel);
+  static const Eigen::VectorXd noDesignSpecification;
+
+  // Compute the local partial sums of all measures
+  _localConvergenceSums.clear();
+  for (ConvergenceMeasure &convMeasure : _convergenceMeasures) {
+    if ((convMeasure.level > 0) != coarseModel)
+      continue;
+
+    assertion(convMeasure.data != nullptr);
+    assertion(convMeasure.measure.get() != nullptr);
+    auto   q      = designSpecifications.find(convMeasure.dataID);
+    size_t offset = _localConvergenceSums.size();
+    _localConvergenceSums.resize(offset + convMeasure.measure->getNumberOfPartialSums(), 0.0);
+    convMeasure.measure->computePartialSums(convMeasure.data->oldValues.col(0),
+                                            *convMeasure.data->values,
+                                            q != designSpecifications.end() ? q->second : noDesignSpecification,
+                                            _localConvergenceSums.data() + offset);
+  }
+
+  // A single reduction for all measures, allreduceSum modifies the local sums
+  _globalConvergenceSums = _localConvergenceSums;
+  if (not _localConvergenceSums.empty()) {
+    utils::MasterSlave::allreduceSum(_localConvergenceSums.data(), _globalConvergenceSums.data(),
+                                     _localConvergenceSums.size());
+  }
+
+  size_t offset = 0;
+  for (ConvergenceMeasure &convMeasure : _convergenceMeasures) {
+    if ((convMeasure.level > 0) != coarseModel)
+      continue;
+
+    convMeasure.measure->measure(_globalConvergenceSums.data() + offset);
+    offset += convMeasure.measure->getNumberOfPartialSums();
+  }
+}
+
 void BaseCouplingScheme::initializeTXTWriters()
 {
   if (not utils::MasterSlave::_slaveMode) {
 
-    _iterationsWriter = std::make_shared<io::TXTTableWriter>("precice-" + _localParticipant + "-iterations.log");
+    std::string suffix = _logFormat == io::TXTTableWriter::BINARY ? ".bin" : ".log";
+    _iterationsWriter  = std::make_shared<io::TXTTableWriter>("precice-" + _localParticipant + "-iterations" + suffix,
+                                                             _logFormat, _logFlushInterval);
     if (not doesFirstStep()) {
-      _convergenceWriter = std::make_shared<io::TXTTableWriter>("precice-" + _localParticipant + "-convergence.log");
+      _convergenceWriter = std::make_shared<io::TXTTableWriter>("precice-" + _localParticipant + "-convergence" + suffix,
+                                                                _logFormat, _logFlushInterval);
     }
 
     // check if coarse model optimization exists
@@ -212,6 +212,21 @@ public:
       com::PtrCommunication communication,
       int                   rankSender);
 
+  /// Returns the interval of timesteps in which checkpoints are written, -1 if none are written.
+  virtual int getCheckpointTimestepInterval() const
+  {
+    return _checkpointTimestepInterval;
+  }
+
+  /**
+   * @brief Exports time, timesteps, old values of the coupling data and the
+   *        state of the post-processing to a binary file of this rank.
+   */
+  virtual void exportState(const std::string &filenamePrefix) const;
+
+  /// Imports the state written by exportState() from the binary file of this rank.
+  virtual void importState(const std::string &filenamePrefix);
+
   /// Finalizes the coupling scheme.
   virtual void finalize();
 
@@ -246,6 +261,19 @@ public:
    */
   void setExtrapolationOrder(int order);
 
+  /// Sets the interval of timesteps in which checkpoints are written, -1 for none.
+  void setCheckpointTimestepInterval(int timestepInterval)
+  {
+    _checkpointTimestepInterval = timestepInterval;
+  }
+
+  /// Sets the file format and the number of rows buffered before writing of the iteration and convergence logs.
+  void setLogWriterOptions(io::TXTTableWriter::Format format, int flushInterval)
+  {
+    _logFormat        = format;
+    _logFlushInterval = flushInterval;
+  }
+
   typedef std::map<int, PtrCouplingData> DataMap; // move that back to protected
 
   void extrapolateData(DataMap &data);
@@ -455,10 +483,25 @@ protected:
   void newConvergenceMeasurements();
 
   bool measureConvergence(
-      std::map<int, Eigen::VectorXd> &designSpecification);
+      const std::map<int, Eigen::VectorXd> &designSpecification);
 
   bool measureConvergenceCoarseModelOptimization(
-      std::map<int, Eigen::VectorXd> &designSpecification);
+      const std::map<int, Eigen::VectorXd> &designSpecification);
+
+  /**
+   * @brief Performs the measurements of all convergence measures of fine (level 0) or coarse model optimization.
+   *
+   * The partial sums of all measures are reduced over all ranks at once.
+   */
+  void performConvergenceMeasurements(
+      const std::map<int, Eigen::VectorXd> &designSpecifications,
+      bool                                  coarseModel);
+
+  /// Local partial sums of all convergence measures, see performConvergenceMeasurements()
+  std::vector<double> _localConvergenceSums;
+
+  /// Partial sums of all convergence measures, reduced over all ranks
+  std::vector<double> _globalConvergenceSums;
 
   /**
    * @brief Sets up _dataStorage to store data values of last timestep.
@@ -542,6 +585,15 @@ private:
   /// Extrapolation order of coupling data for first iteration of every dt.
   int _extrapolationOrder = 0;
 
+  /// Interval of timesteps in which checkpoints are written, -1 if none are written.
+  int _checkpointTimestepInterval = -1;
+
+  /// File format of the iteration and convergence logs.
+  io::TXTTableWriter::Format _logFormat = io::TXTTableWriter::TEXT;
+
+  /// Number of rows of the iteration and convergence logs buffered before writing.
+  int _logFlushInterval = 1;
+
   int _validDigits;
 
   /// True, if local participant is the one starting the explicit scheme.
@@ -1,6 +1,7 @@
 #include "CompositionalCouplingScheme.hpp"
 #include "Constants.hpp"
 #include <limits>
+#include <sstream>
 #include "utils/assertion.hpp"
 
 namespace precice {
@@ -345,6 +346,48 @@ std::string CompositionalCouplingScheme:: printCouplingState() const
   return state;
 }
 
+int CompositionalCouplingScheme:: getCheckpointTimestepInterval() const
+{
+  TRACE();
+  int interval = -1;
+  for (const Scheme& scheme : _couplingSchemes) {
+    int schemeInterval = scheme.scheme->getCheckpointTimestepInterval();
+    if (schemeInterval > 0 && (interval == -1 || schemeInterval < interval)) {
+      interval = schemeInterval;
+    }
+  }
+  DEBUG("return " << interval);
+  return interval;
+}
+
+void CompositionalCouplingScheme:: exportState
+(
+  const std::string& filenamePrefix ) const
+{
+  TRACE(filenamePrefix);
+  int enumerator = 0;
+  for (const Scheme& scheme : _couplingSchemes) {
+    std::ostringstream stream;
+    stream << filenamePrefix << "_" << enumerator;
+    scheme.scheme->exportState(stream.str());
+    enumerator++;
+  }
+}
+
+void CompositionalCouplingScheme:: importState
+(
+  const std::string& filenamePrefix )
+{
+  TRACE(filenamePrefix);
+  int enumerator = 0;
+  for (Scheme& scheme : _couplingSchemes) {
+    std::ostringstream stream;
+    stream << filenamePrefix << "_" << enumerator;
+    scheme.scheme->importState(stream.str());
+    enumerator++;
+  }
+}
+
 void CompositionalCouplingScheme:: sendState
 (
   com::PtrCommunication communication,
@@ -802,19 +845,6 @@ void CompositionalCouplingScheme:: advanceActiveCouplingSchemes()
 //  }
 //}
 //
-//int CompositionalCouplingScheme:: getCheckpointTimestepInterval() const
-//{
-//  TRACE();
-//  int interval = std::numeric_limits<int>::max();
-//  for (PtrCouplingScheme couplingScheme : _couplingSchemes){
-//    if (couplingScheme->getCheckpointTimestepInterval() < interval){
-//      interval = couplingScheme->getCheckpointTimestepInterval();
-//    }
-//  }
-//  DEBUG("return " << interval);
-//  return interval;
-//}
-//
 //void CompositionalCouplingScheme:: requireAction
 //(
 //  const std::string& actionName )
@@ -843,34 +873,6 @@ void CompositionalCouplingScheme:: advanceActiveCouplingSchemes()
 //  return state;
 //}
 //
-//void CompositionalCouplingScheme:: exportState
-//(
-//  const std::string& filenamePrefix ) const
-//{
-//  TRACE();
-//  int enumerator = 0;
-//  for (PtrCouplingScheme couplingScheme : _couplingSchemes){
-//    std::ostringstream stream;
-//    stream << filenamePrefix << "_" << enumerator;
-//    couplingScheme->exportState(stream.str());
-//    enumerator++;
-//  }
-//}
-//
-//void CompositionalCouplingScheme:: importState
-//(
-//  const std::string& filenamePrefix )
-//{
-//  TRACE();
-//  int enumerator = 0;
-//  for (PtrCouplingScheme couplingScheme : _couplingSchemes){
-//    std::ostringstream stream;
-//    stream << filenamePrefix << "_" << enumerator;
-//    couplingScheme->importState(stream.str());
-//    enumerator++;
-//  }
-//}
-//
 //void CompositionalCouplingScheme:: sendState
 //(
 //  com::Communication::SharedPointer communication,
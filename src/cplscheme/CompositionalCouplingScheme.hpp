@@ -224,6 +224,15 @@ public:
   /// Returns a string representation of the current coupling state.
   virtual std::string printCouplingState() const;
 
+  /// Returns the smallest checkpoint interval of all coupling schemes, -1 if none writes checkpoints.
+  virtual int getCheckpointTimestepInterval() const;
+
+  /// Exports the states of all coupling schemes, enumerated in the order they were added.
+  virtual void exportState(const std::string& filenamePrefix) const;
+
+  /// Imports the states of all coupling schemes, enumerated in the order they were added.
+  virtual void importState(const std::string& filenamePrefix);
+
   /**
    * @brief Send the state of the coupling scheme to another remote scheme.
    *
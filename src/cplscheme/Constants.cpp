@@ -22,6 +22,12 @@ const std::string& actionWriteInitialData ()
   return actionWriteInitialData;
 }
 
+const std::string& actionWriteSimulationCheckpoint ()
+{
+  static std::string actionWriteSimulationCheckpoint ( "write-simulation-checkpoint" );
+  return actionWriteSimulationCheckpoint;
+}
+
 //const std::string WRITE_ITERATION_CHECKPOINT ( "write-iteration-checkpoint" );
 //
 //const std::string READ_ITERATION_CHECKPOINT ( "read-iteration-checkpoint" );
@@ -12,6 +12,8 @@ const std::string& actionReadIterationCheckpoint();
 
 const std::string& actionWriteInitialData();
 
+const std::string& actionWriteSimulationCheckpoint();
+
 enum TimesteppingMethod
 {
   FIXED_DT,
@@ -190,6 +190,23 @@ public:
   /// Returns a string representation of the current coupling state.
   virtual std::string printCouplingState() const =0;
 
+  /// Returns the interval of timesteps in which checkpoints are written, -1 if none are written.
+  virtual int getCheckpointTimestepInterval() const =0;
+
+  /**
+   * @brief Exports the state of the coupling scheme and its post-processing to files.
+   *
+   * Every rank writes its own file, with the given prefix and the rank in its name.
+   */
+  virtual void exportState(const std::string& filenamePrefix) const =0;
+
+  /**
+   * @brief Imports the state written by exportState().
+   *
+   * Has to be called after initialize(), as the post-processing has to be set up already.
+   */
+  virtual void importState(const std::string& filenamePrefix) =0;
+
   /**
    * @brief Send the state of the coupling scheme to another remote scheme.
    *
@@ -152,7 +152,7 @@ void MultiCouplingScheme::advance()
 
     receiveData();
 
-    auto designSpecifications = getPostProcessing()->getDesignSpecification(_allData);
+    const auto &designSpecifications = getPostProcessing()->getDesignSpecification(_allData);
     convergence = measureConvergence(designSpecifications);
 
     // Stop, when maximal iteration count (given in config) is reached
@@ -267,7 +267,7 @@ void MultiCouplingScheme:: sendData()
     for (DataMap::value_type& pair : _sendDataVector[i]) {
       int size = pair.second->values->size();
       if (size > 0) {
-        _communications[i]->send(pair.second->values->data(), size, pair.second->mesh->getID(), pair.second->dimension);
+        _communications[i]->send(pair.second->values->data(), size, pair.second->mesh->getID(), pair.second->dimension, pair.first);
       }
     }
   }
@@ -284,7 +284,7 @@ void MultiCouplingScheme:: receiveData()
     for (DataMap::value_type& pair : _receiveDataVector[i]) {
       int size = pair.second->values->size();
       if (size > 0) {
-        _communications[i]->receive(pair.second->values->data(), size, pair.second->mesh->getID(), pair.second->dimension);
+        _communications[i]->receive(pair.second->values->data(), size, pair.second->mesh->getID(), pair.second->dimension, pair.first);
       }
     }
   }
@@ -219,10 +219,9 @@ void ParallelCouplingScheme::implicitAdvance()
       receiveData(getM2N());
 
       // get the current design specifications from the post processing (for convergence measure)
-      std::map<int, Eigen::VectorXd> designSpecifications;
-      if (getPostProcessing().get() != nullptr) {
-        designSpecifications = getPostProcessing()->getDesignSpecification(getAllData());
-      }
+      static const std::map<int, Eigen::VectorXd> noDesignSpecifications;
+      const std::map<int, Eigen::VectorXd> &designSpecifications =
+          getPostProcessing().get() != nullptr ? getPostProcessing()->getDesignSpecification(getAllData()) : noDesignSpecifications;
 
       // measure convergence for coarse model optimization
       if(_isCoarseModelOptimizationActive){
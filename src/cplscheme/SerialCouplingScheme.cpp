@@ -210,10 +210,9 @@ void SerialCouplingScheme::advance()
       else {
 
         // get the current design specifications from the post processing (for convergence measure)
-        std::map<int, Eigen::VectorXd> designSpecifications;
-        if (getPostProcessing().get() != nullptr) {
-          designSpecifications = getPostProcessing()->getDesignSpecification(getSendData());
-        }
+        static const std::map<int, Eigen::VectorXd> noDesignSpecifications;
+        const std::map<int, Eigen::VectorXd> &designSpecifications =
+            getPostProcessing().get() != nullptr ? getPostProcessing()->getDesignSpecification(getSendData()) : noDesignSpecifications;
         // measure convergence of coupling iteration
         // measure convergence for coarse model optimization
         if(_isCoarseModelOptimizationActive){
@@ -47,6 +47,8 @@ CouplingSchemeConfiguration::CouplingSchemeConfiguration(
       TAG_MIN_ITER_CONV_MEASURE("min-iteration-convergence-measure"),
       TAG_MAX_ITERATIONS("max-iterations"),
       TAG_EXTRAPOLATION("extrapolation-order"),
+      TAG_CHECKPOINT("checkpoint"),
+      TAG_LOG_WRITER("log-writer"),
       ATTR_DATA("data"),
       ATTR_MESH("mesh"),
       ATTR_PARTICIPANT("participant"),
@@ -66,6 +68,8 @@ CouplingSchemeConfiguration::CouplingSchemeConfiguration(
       ATTR_SUFFICES("suffices"),
       ATTR_CONTROL("control"),
       ATTR_LEVEL("level"),
+      ATTR_FORMAT("format"),
+      ATTR_FLUSH_INTERVAL("flush-interval"),
       VALUE_SERIAL_EXPLICIT("serial-explicit"),
       VALUE_PARALLEL_EXPLICIT("parallel-explicit"),
       VALUE_SERIAL_IMPLICIT("serial-implicit"),
@@ -73,6 +77,8 @@ CouplingSchemeConfiguration::CouplingSchemeConfiguration(
       VALUE_MULTI("multi"),
       VALUE_FIXED("fixed"),
       VALUE_FIRST_PARTICIPANT("first-participant"),
+      VALUE_TEXT("text"),
+      VALUE_BINARY("binary"),
       _config(),
       _meshConfig(meshConfig),
       _m2nConfig(m2nConfig),
@@ -247,6 +253,17 @@ void CouplingSchemeConfiguration::xmlTagCallback(
   } else if (tag.getName() == TAG_EXTRAPOLATION) {
     assertion(_config.type == VALUE_SERIAL_IMPLICIT || _config.type == VALUE_PARALLEL_IMPLICIT || _config.type == VALUE_MULTI);
     _config.extrapolationOrder = tag.getIntAttributeValue(ATTR_VALUE);
+  } else if (tag.getName() == TAG_CHECKPOINT) {
+    _config.checkpointTimestepInterval = tag.getIntAttributeValue(ATTR_TIMESTEP_INTERVAL);
+    CHECK(_config.checkpointTimestepInterval > 0,
+          "Timestep interval of checkpoints has to be larger than zero!");
+  } else if (tag.getName() == TAG_LOG_WRITER) {
+    _config.logFormat = tag.getStringAttributeValue(ATTR_FORMAT) == VALUE_BINARY
+                            ? io::TXTTableWriter::BINARY
+                            : io::TXTTableWriter::TEXT;
+    _config.logFlushInterval = tag.getIntAttributeValue(ATTR_FLUSH_INTERVAL);
+    CHECK(_config.logFlushInterval > 0,
+          "Flush interval of the log writer has to be larger than zero!");
   }
 }
 
@@ -345,6 +362,8 @@ void CouplingSchemeConfiguration::addTypespecifcSubtags(
 {
   TRACE(type);
   addTransientLimitTags(tag);
+  addTagCheckpoint(tag);
+  addTagLogWriter(tag);
   _config.type = type;
   //_config.name = name;
 
@@ -549,6 +568,42 @@ void CouplingSchemeConfiguration::addTagExtrapolation(
   tag.addSubtag(tagExtrapolation);
 }
 
+void CouplingSchemeConfiguration::addTagCheckpoint(
+    xml::XMLTag &tag)
+{
+  using namespace xml;
+  XMLTag            tagCheckpoint(*this, TAG_CHECKPOINT, XMLTag::OCCUR_NOT_OR_ONCE);
+  XMLAttribute<int> attrTimestepInterval(ATTR_TIMESTEP_INTERVAL);
+  tagCheckpoint.addAttribute(attrTimestepInterval);
+  tagCheckpoint.setDocumentation("Writes the state of the coupling scheme and its post-processing "
+                                 "every timestep-interval timesteps. The state is read back at "
+                                 "initialization if restart-mode of the solver interface is set. "
+                                 "The action write-simulation-checkpoint tells the solver when "
+                                 "to write its own state. Fulfilling the action is optional.");
+  tag.addSubtag(tagCheckpoint);
+}
+
+void CouplingSchemeConfiguration::addTagLogWriter(
+    xml::XMLTag &tag)
+{
+  using namespace xml;
+  XMLTag                    tagLogWriter(*this, TAG_LOG_WRITER, XMLTag::OCCUR_NOT_OR_ONCE);
+  XMLAttribute<std::string> attrFormat(ATTR_FORMAT);
+  attrFormat.setDefaultValue(VALUE_TEXT);
+  ValidatorEquals<std::string> validText(VALUE_TEXT);
+  ValidatorEquals<std::string> validBinary(VALUE_BINARY);
+  attrFormat.setValidator(validText || validBinary);
+  attrFormat.setDocumentation("Format of the iteration and convergence logs. Binary logs (*.bin) have a fixed "
+                              "layout and are converted to text by \"binprecice txt <binary log> <text log>\".");
+  tagLogWriter.addAttribute(attrFormat);
+  XMLAttribute<int> attrFlushInterval(ATTR_FLUSH_INTERVAL);
+  attrFlushInterval.setDefaultValue(1);
+  attrFlushInterval.setDocumentation("Number of rows buffered before they are written in the background.");
+  tagLogWriter.addAttribute(attrFlushInterval);
+  tagLogWriter.setDocumentation("Configures the writers of the iteration and convergence logs of the coupling scheme.");
+  tag.addSubtag(tagLogWriter);
+}
+
 void CouplingSchemeConfiguration::addTagPostProcessing(
     xml::XMLTag &tag)
 {
@@ -643,6 +698,8 @@ PtrCouplingScheme CouplingSchemeConfiguration::createSerialExplicitCouplingSchem
       _config.maxTime, _config.maxTimesteps, _config.timestepLength,
       _config.validDigits, _config.participants[0], _config.participants[1],
       accessor, m2n, _config.dtMethod, BaseCouplingScheme::Explicit);
+  scheme->setCheckpointTimestepInterval(_config.checkpointTimestepInterval);
+  scheme->setLogWriterOptions(_config.logFormat, _config.logFlushInterval);
 
   addDataToBeExchanged(*scheme, accessor);
 
@@ -659,6 +716,8 @@ PtrCouplingScheme CouplingSchemeConfiguration::createParallelExplicitCouplingSch
       _config.maxTime, _config.maxTimesteps, _config.timestepLength,
       _config.validDigits, _config.participants[0], _config.participants[1],
       accessor, m2n, _config.dtMethod, BaseCouplingScheme::Explicit);
+  scheme->setCheckpointTimestepInterval(_config.checkpointTimestepInterval);
+  scheme->setLogWriterOptions(_config.logFormat, _config.logFlushInterval);
 
   addDataToBeExchanged(*scheme, accessor);
 
@@ -676,6 +735,8 @@ PtrCouplingScheme CouplingSchemeConfiguration::createSerialImplicitCouplingSchem
       _config.maxTime, _config.maxTimesteps, _config.timestepLength,
       _config.validDigits, _config.participants[0], _config.participants[1],
       accessor, m2n, _config.dtMethod, BaseCouplingScheme::Implicit, _config.maxIterations);
+  scheme->setCheckpointTimestepInterval(_config.checkpointTimestepInterval);
+  scheme->setLogWriterOptions(_config.logFormat, _config.logFlushInterval);
   scheme->setExtrapolationOrder(_config.extrapolationOrder);
 
   addDataToBeExchanged(*scheme, accessor);
@@ -717,6 +778,8 @@ PtrCouplingScheme CouplingSchemeConfiguration::createParallelImplicitCouplingSch
       _config.maxTime, _config.maxTimesteps, _config.timestepLength,
       _config.validDigits, _config.participants[0], _config.participants[1],
       accessor, m2n, _config.dtMethod, BaseCouplingScheme::Implicit, _config.maxIterations);
+  scheme->setCheckpointTimestepInterval(_config.checkpointTimestepInterval);
+  scheme->setLogWriterOptions(_config.logFormat, _config.logFlushInterval);
   scheme->setExtrapolationOrder(_config.extrapolationOrder);
 
   addDataToBeExchanged(*scheme, accessor);
@@ -766,6 +829,8 @@ PtrCouplingScheme CouplingSchemeConfiguration::createMultiCouplingScheme(
         _config.maxTime, _config.maxTimesteps, _config.timestepLength,
         _config.validDigits, accessor, m2ns, _config.dtMethod,
         _config.maxIterations);
+    scheme->setCheckpointTimestepInterval(_config.checkpointTimestepInterval);
+    scheme->setLogWriterOptions(_config.logFormat, _config.logFlushInterval);
     scheme->setExtrapolationOrder(_config.extrapolationOrder);
 
     MultiCouplingScheme *castedScheme = dynamic_cast<MultiCouplingScheme *>(scheme);
@@ -777,6 +842,8 @@ PtrCouplingScheme CouplingSchemeConfiguration::createMultiCouplingScheme(
         _config.maxTime, _config.maxTimesteps, _config.timestepLength,
         _config.validDigits, accessor, _config.controller,
         accessor, m2n, _config.dtMethod, BaseCouplingScheme::Implicit, _config.maxIterations);
+    scheme->setCheckpointTimestepInterval(_config.checkpointTimestepInterval);
+    scheme->setLogWriterOptions(_config.logFormat, _config.logFlushInterval);
     scheme->setExtrapolationOrder(_config.extrapolationOrder);
 
     addDataToBeExchanged(*scheme, accessor);
@@ -8,6 +8,7 @@
 #include "cplscheme/MultiCouplingScheme.hpp"
 #include "cplscheme/SharedPointer.hpp"
 #include "cplscheme/impl/SharedPointer.hpp"
+#include "io/TXTTableWriter.hpp"
 #include "logging/Logger.hpp"
 #include "m2n/config/M2NConfiguration.hpp"
 #include "mesh/SharedPointer.hpp"
@@ -96,6 +97,8 @@ private:
   const std::string TAG_MIN_ITER_CONV_MEASURE;
   const std::string TAG_MAX_ITERATIONS;
   const std::string TAG_EXTRAPOLATION;
+  const std::string TAG_CHECKPOINT;
+  const std::string TAG_LOG_WRITER;
 
   const std::string ATTR_DATA;
   const std::string ATTR_MESH;
@@ -116,6 +119,8 @@ private:
   const std::string ATTR_SUFFICES;
   const std::string ATTR_CONTROL;
   const std::string ATTR_LEVEL;
+  const std::string ATTR_FORMAT;
+  const std::string ATTR_FLUSH_INTERVAL;
 
   const std::string VALUE_SERIAL_EXPLICIT;
   const std::string VALUE_PARALLEL_EXPLICIT;
@@ -124,6 +129,8 @@ private:
   const std::string VALUE_MULTI;
   const std::string VALUE_FIXED;
   const std::string VALUE_FIRST_PARTICIPANT;
+  const std::string VALUE_TEXT;
+  const std::string VALUE_BINARY;
 
   struct Config {
     std::string                   type;
@@ -143,6 +150,9 @@ private:
     std::vector<std::tuple<int, bool, std::string, int, impl::PtrConvergenceMeasure>> convMeasures;
     int                                                                               maxIterations = -1;
     int                                                                               extrapolationOrder = 0;
+    int                                                                               checkpointTimestepInterval = -1;
+    io::TXTTableWriter::Format                                                        logFormat = io::TXTTableWriter::TEXT;
+    int                                                                               logFlushInterval = 1;
 
   } _config;
 
@@ -182,6 +192,10 @@ private:
 
   void addTagExtrapolation(xml::XMLTag &tag);
 
+  void addTagCheckpoint(xml::XMLTag &tag);
+
+  void addTagLogWriter(xml::XMLTag &tag);
+
   void addTagPostProcessing(xml::XMLTag &tag);
 
   void addAbsoluteConvergenceMeasure(
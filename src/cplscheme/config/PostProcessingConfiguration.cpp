@@ -37,6 +37,7 @@ PostProcessingConfiguration::PostProcessingConfiguration(
       TAG_ESTIMATEJACOBIAN("estimate-jacobian"),
       TAG_PRECONDITIONER("preconditioner"),
       TAG_IMVJRESTART("imvj-restart-mode"),
+      TAG_HISTORY_COMPRESSION("history-compression"),
       ATTR_NAME("name"),
       ATTR_MESH("mesh"),
       ATTR_SCALING("scaling"),
@@ -45,6 +46,7 @@ PostProcessingConfiguration::PostProcessingConfiguration(
       ATTR_SINGULARITYLIMIT("limit"),
       ATTR_TYPE("type"),
       ATTR_BUILDJACOBIAN("always-build-jacobian"),
+      ATTR_MAX_CYCLIC_RANKS("max-cyclic-ranks"),
       ATTR_IMVJCHUNKSIZE("chunk-size"),
       ATTR_RSLS_REUSEDTSTEPS("reused-timesteps-at-restart"),
       ATTR_RSSVD_TRUNCATIONEPS("truncation-threshold"),
@@ -118,6 +120,13 @@ void PostProcessingConfiguration::connectTags(xml::XMLTag &parent)
     alwaybuildJacobian.setDefaultValue(false);
     tag.addAttribute(alwaybuildJacobian);
 
+    XMLAttribute<int> maxCyclicRanks(ATTR_MAX_CYCLIC_RANKS);
+    maxCyclicRanks.setDocumentation("Above this number of ranks, the IMVJ computes the product W_til * Z by gathering W_til"
+                                    " on the master and broadcasting it, instead of passing its blocks around a ring of all ranks."
+                                    " A value of 0 (default) always uses the ring.");
+    maxCyclicRanks.setDefaultValue(0);
+    tag.addAttribute(maxCyclicRanks);
+
     addTypeSpecificSubtags(tag);
     tags.push_back(tag);
   }
@@ -159,8 +168,10 @@ void PostProcessingConfiguration::xmlTagCallback(
   if (callingTag.getNamespace() == TAG) {
     _config.type = callingTag.getName();
 
-    if (_config.type == VALUE_MVQN)
+    if (_config.type == VALUE_MVQN) {
       _config.alwaysBuildJacobian = callingTag.getBooleanAttributeValue(ATTR_BUILDJACOBIAN);
+      _config.maxCyclicRanks      = callingTag.getIntAttributeValue(ATTR_MAX_CYCLIC_RANKS);
+    }
   }
 
   if (callingTag.getName() == TAG_RELAX) {
@@ -217,6 +228,8 @@ void PostProcessingConfiguration::xmlTagCallback(
   } else if (callingTag.getName() == TAG_PRECONDITIONER) {
     _config.preconditionerType       = callingTag.getStringAttributeValue(ATTR_TYPE);
     _config.precond_nbNonConstTSteps = callingTag.getIntAttributeValue(ATTR_PRECOND_NONCONST_TIMESTEPS);
+  } else if (callingTag.getName() == TAG_HISTORY_COMPRESSION) {
+    _config.historyTruncationEps = callingTag.getDoubleAttributeValue(ATTR_RSSVD_TRUNCATIONEPS);
   } else if (callingTag.getName() == TAG_IMVJRESTART) {
 
     if (_config.alwaysBuildJacobian)
@@ -304,23 +317,25 @@ void PostProcessingConfiguration::xmlEndTagCallback(
               _config.timestepsReused,
               _config.filter, _config.singularityLimit,
               _config.dataIDs,
-              _preconditioner));
+              _preconditioner,
+              _config.historyTruncationEps));
     } else if (callingTag.getName() == VALUE_MVQN) {
 #ifndef PRECICE_NO_MPI
-      _postProcessing = impl::PtrPostProcessing(
-          new impl::MVQNPostProcessing(
-              _config.relaxationFactor,
-              _config.forceInitialRelaxation,
-              _config.maxIterationsUsed,
-              _config.timestepsReused,
-              _config.filter, _config.singularityLimit,
-              _config.dataIDs,
-              _preconditioner,
-              _config.alwaysBuildJacobian,
-              _config.imvjRestartType,
-              _config.imvjChunkSize,
-              _config.imvjRSLS_reustedTimesteps,
-              _config.imvjRSSVD_truncationEps));
+      auto postProcessing = std::make_shared<impl::MVQNPostProcessing>(
+          _config.relaxationFactor,
+          _config.forceInitialRelaxation,
+          _config.maxIterationsUsed,
+          _config.timestepsReused,
+          _config.filter, _config.singularityLimit,
+          _config.dataIDs,
+          _preconditioner,
+          _config.alwaysBuildJacobian,
+          _config.imvjRestartType,
+          _config.imvjChunkSize,
+          _config.imvjRSLS_reustedTimesteps,
+          _config.imvjRSSVD_truncationEps);
+      postProcessing->setMaxCyclicRanks(_config.maxCyclicRanks);
+      _postProcessing = postProcessing;
 #else
       ERROR("Post processing IQN-IMVJ only works if preCICE is compiled with MPI");
 #endif
@@ -473,6 +488,18 @@ void PostProcessingConfiguration::addTypeSpecificSubtags(
     tagPreconditioner.addAttribute(nonconstTSteps);
     tag.addSubtag(tagPreconditioner);
 
+    XMLTag               tagHistoryCompression(*this, TAG_HISTORY_COMPRESSION, XMLTag::OCCUR_NOT_OR_ONCE);
+    XMLAttribute<double> attrTruncationEps(ATTR_RSSVD_TRUNCATIONEPS);
+    attrTruncationEps.setDefaultValue(1e-3);
+    attrTruncationEps.setDocumentation("Modes whose singular value is smaller than this threshold times the largest "
+                                       "singular value are dropped from the history.");
+    tagHistoryCompression.addAttribute(attrTruncationEps);
+    tagHistoryCompression.setDocumentation("If present, the history of the least-squares system is compressed after every "
+                                           "time step to its dominant modes by a truncated SVD of the (preconditioned) matrix V, "
+                                           "instead of dropping whole time steps. The number of columns is then bounded by the "
+                                           "truncation threshold and max-used-iterations, timesteps-reused only needs to be larger than zero.");
+    tag.addSubtag(tagHistoryCompression);
+
   } else if (tag.getName() == VALUE_MVQN) {
     XMLTag               tagInitRelax(*this, TAG_INIT_RELAX, XMLTag::OCCUR_ONCE);
     XMLAttribute<double> attrDoubleValue(ATTR_VALUE);
@@ -61,6 +61,7 @@ private:
   const std::string TAG_ESTIMATEJACOBIAN;
   const std::string TAG_PRECONDITIONER;
   const std::string TAG_IMVJRESTART;
+  const std::string TAG_HISTORY_COMPRESSION;
 
   const std::string ATTR_NAME;
   const std::string ATTR_MESH;
@@ -70,6 +71,7 @@ private:
   const std::string ATTR_SINGULARITYLIMIT;
   const std::string ATTR_TYPE;
   const std::string ATTR_BUILDJACOBIAN;
+  const std::string ATTR_MAX_CYCLIC_RANKS;
   const std::string ATTR_IMVJCHUNKSIZE;
   const std::string ATTR_RSLS_REUSEDTSTEPS;
   const std::string ATTR_RSSVD_TRUNCATIONEPS;
@@ -124,8 +126,10 @@ private:
     int                   precond_nbNonConstTSteps = -1;
     double                singularityLimit= 0;
     double                imvjRSSVD_truncationEps = 0;
+    double                historyTruncationEps = 0;
     bool                  estimateJacobian = false;
     bool                  alwaysBuildJacobian = false;
+    int                   maxCyclicRanks = 0;
     std::string           preconditionerType;
   } _config;
 
@@ -2,7 +2,7 @@
 
 #include "ConvergenceMeasure.hpp"
 #include "logging/Logger.hpp"
-#include "utils/MasterSlave.hpp"
+#include <cmath>
 
 namespace precice
 {
@@ -44,12 +44,25 @@ public:
     _isConvergence = false;
   }
 
-  virtual void measure(
-      const Eigen::VectorXd &oldValues,
-      const Eigen::VectorXd &newValues,
-      const Eigen::VectorXd &designSpecification)
+  virtual int getNumberOfPartialSums() const
   {
-    _normDiff      = utils::MasterSlave::l2norm((newValues - oldValues) - designSpecification);
+    return 1;
+  }
+
+  virtual void computePartialSums(
+      const Eigen::Ref<const Eigen::VectorXd> &oldValues,
+      const Eigen::Ref<const Eigen::VectorXd> &newValues,
+      const Eigen::Ref<const Eigen::VectorXd> &designSpecification,
+      double *                                 sums) const
+  {
+    sums[0] = squaredResidualNorm(oldValues, newValues, designSpecification);
+  }
+
+  using ConvergenceMeasure::measure;
+
+  virtual void measure(const double *globalSums)
+  {
+    _normDiff      = std::sqrt(globalSums[0]);
     _isConvergence = _normDiff <= _convergenceLimit;
     //      INFO("Absolute convergence measure: "
     //                     << "two-norm differences = " << normDiff
@@ -64,30 +64,36 @@ void AitkenPostProcessing::performPostProcessing(
   // Compute aitken relaxation factor
   assertion(utils::contained(*_dataIDs.begin(), cplData));
 
-  Eigen::VectorXd values;
-  Eigen::VectorXd oldValues;
+  // Single pass over the local entries of all data: compute the current residuals, the local
+  // parts of both inner products with the residual deltas and store the residuals for the next
+  // iteration in place
+  double sums[2] = {0.0, 0.0}; // nominator, denominator
+  int    offset  = 0;
+  bool   isFirst = _iterationCounter == 0;
   for (int id : _dataIDs) {
-    utils::append(values, *(cplData[id]->values));
-    utils::append(oldValues, (Eigen::VectorXd) cplData[id]->oldValues.col(0));
+    const auto &values    = *cplData[id]->values;
+    const auto &oldValues = cplData[id]->oldValues.col(0);
+    for (int i = 0; i < values.size(); i++) {
+      double residual = values(i) - oldValues(i);
+      if (not isFirst) {
+        double residualDelta = residual - _residuals(offset + i);
+        sums[0] += _residuals(offset + i) * residualDelta;
+        sums[1] += residualDelta * residualDelta;
+      }
+      _residuals(offset + i) = residual;
+    }
+    offset += values.size();
   }
-
-  // Compute current residuals
-  Eigen::VectorXd residuals = values;
-  residuals -= oldValues;
-
-  // Compute residual deltas and temporarily store it in _residuals
-  Eigen::VectorXd residualDeltas = _residuals;
-  residualDeltas *= -1.0;
-  residualDeltas += residuals;
+  assertion(offset == _residuals.size(), offset, _residuals.size());
 
   // Select/compute aitken factor depending on current iteration count
-  if (_iterationCounter == 0) {
+  if (isFirst) {
     _aitkenFactor = math::sign(_aitkenFactor) * std::min(_initialRelaxation, std::abs(_aitkenFactor));
   } else {
-    // compute fraction of aitken factor with residuals and residual deltas
-    double nominator   = utils::MasterSlave::dot(_residuals, residualDeltas);
-    double denominator = utils::MasterSlave::dot(residualDeltas, residualDeltas);
-    _aitkenFactor      = -_aitkenFactor * (nominator / denominator);
+    // compute fraction of aitken factor with residuals and residual deltas, both sums in one reduction
+    double globalSums[2] = {sums[0], sums[1]};
+    utils::MasterSlave::allreduceSum(sums, globalSums, 2);
+    _aitkenFactor = -_aitkenFactor * (globalSums[0] / globalSums[1]);
   }
 
   DEBUG("AitkenFactor: " << _aitkenFactor);
@@ -98,15 +104,9 @@ void AitkenPostProcessing::performPostProcessing(
   for (DataMap::value_type &pair : cplData) {
     auto &      values    = *pair.second->values;
     const auto &oldValues = pair.second->oldValues.col(0);
-    values *= omega;
-    for (int i = 0; i < values.size(); i++) {
-      values(i) += oldValues(i) * oneMinusOmega;
-    }
+    values                = values * omega + oldValues * oneMinusOmega;
   }
 
-  // Store residuals for next iteration
-  _residuals = residuals;
-
   _iterationCounter++;
 }
 
@@ -114,7 +114,7 @@ void AitkenPostProcessing::iterationsConverged(
     DataMap &cplData)
 {
   _iterationCounter = 0;
-  _residuals        = Eigen::VectorXd::Constant(_residuals.size(), std::numeric_limits<double>::max());
+  _residuals.setConstant(std::numeric_limits<double>::max());
 }
 
 /** ---------------------------------------------------------------------------------------------
@@ -124,22 +124,17 @@ void AitkenPostProcessing::iterationsConverged(
  *         This information is needed for convergence measurements in the coupling scheme.
  *  ---------------------------------------------------------------------------------------------
  */
-std::map<int, Eigen::VectorXd> AitkenPostProcessing::getDesignSpecification(
+const std::map<int, Eigen::VectorXd> &AitkenPostProcessing::getDesignSpecification(
     DataMap &cplData)
 {
-  std::map<int, Eigen::VectorXd> designSpecifications;
-  int                            off = 0;
+  int off = 0;
   for (int id : _dataIDs) {
-    int             size = cplData[id]->values->size();
-    Eigen::VectorXd q    = Eigen::VectorXd::Zero(size);
-    for (int i = 0; i < size; i++) {
-      q(i) = _designSpecification(i + off);
-    }
+    int size = cplData[id]->values->size();
+    // the cached vector keeps its storage, as long as the size does not change
+    _designSpecifications[id] = _designSpecification.segment(off, size);
     off += size;
-    std::map<int, Eigen::VectorXd>::value_type pair = std::make_pair(id, q);
-    designSpecifications.insert(pair);
   }
-  return designSpecifications;
+  return _designSpecifications;
 }
 
 void AitkenPostProcessing::setDesignSpecification(
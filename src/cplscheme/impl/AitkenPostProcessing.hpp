@@ -30,7 +30,7 @@ public:
   virtual void setDesignSpecification(
       Eigen::VectorXd &q);
 
-  virtual std::map<int, Eigen::VectorXd> getDesignSpecification(DataMap &cplData);
+  virtual const std::map<int, Eigen::VectorXd> &getDesignSpecification(DataMap &cplData);
 
   virtual void initialize(
       DataMap &cpldata);
@@ -55,6 +55,9 @@ private:
   Eigen::VectorXd _residuals;
 
   Eigen::VectorXd _designSpecification;
+
+  /// Design specification per data ID, returned by getDesignSpecification()
+  std::map<int, Eigen::VectorXd> _designSpecifications;
 };
 }
 }
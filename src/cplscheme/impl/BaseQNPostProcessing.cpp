@@ -1,8 +1,12 @@
 #include "BaseQNPostProcessing.hpp"
+#include <Eigen/Eigenvalues>
+#include <algorithm>
 #include <sstream>
 #include "QRFactorization.hpp"
 #include "com/Communication.hpp"
 #include "cplscheme/CouplingData.hpp"
+#include "io/BinaryReader.hpp"
+#include "io/BinaryWriter.hpp"
 #include "mesh/Mesh.hpp"
 #include "mesh/Vertex.hpp"
 #include "utils/EigenHelperFunctions.hpp"
@@ -196,23 +200,18 @@ void BaseQNPostProcessing::setDesignSpecification(
  *         This information is needed for convergence measurements in the coupling scheme.
  *  ---------------------------------------------------------------------------------------------
  */
-std::map<int, Eigen::VectorXd> BaseQNPostProcessing::getDesignSpecification(
+const std::map<int, Eigen::VectorXd> &BaseQNPostProcessing::getDesignSpecification(
     DataMap &cplData)
 {
   TRACE();
-  std::map<int, Eigen::VectorXd> designSpecifications;
-  int                            off = 0;
+  int off = 0;
   for (int id : _dataIDs) {
-    int             size = cplData[id]->values->size();
-    Eigen::VectorXd q    = Eigen::VectorXd::Zero(size);
-    for (int i = 0; i < size; i++) {
-      q(i) = _designSpecification(i + off);
-    }
+    int size = cplData[id]->values->size();
+    // the cached vector keeps its storage, as long as the size does not change
+    _designSpecifications[id] = _designSpecification.segment(off, size);
     off += size;
-    std::map<int, Eigen::VectorXd>::value_type pair = std::make_pair(id, q);
-    designSpecifications.insert(pair);
   }
-  return designSpecifications;
+  return _designSpecifications;
 }
 
 /** ---------------------------------------------------------------------------------------------
@@ -589,6 +588,8 @@ void BaseQNPostProcessing::iterationsConverged(
        * is better than doing underrelaxation as first iteration of every time step
        */
     }
+  } else if (_historyTruncationEps > 0.0) {
+    compressHistory();
   } else if ((int) _matrixCols.size() > _timestepsReused) {
     int toRemove = _matrixCols.back();
     assertion(toRemove > 0, toRemove);
@@ -645,14 +646,124 @@ void BaseQNPostProcessing::removeMatrixColumn(
   }
 }
 
+void BaseQNPostProcessing::transformMatrixColumns(
+    const Eigen::MatrixXd &transform)
+{
+  TRACE(transform.rows(), transform.cols());
+  assertion(transform.rows() == _matrixV.cols(), transform.rows(), _matrixV.cols());
+
+  _matrixV = _matrixV * transform;
+  _matrixW = _matrixW * transform;
+}
+
+/** ---------------------------------------------------------------------------------------------
+ *         compressHistory()
+ *
+ * @brief: replaces the columns of the matrices V and W by the dominant modes of the history,
+ *         such that the number of columns is bounded by the truncation threshold
+ *  ---------------------------------------------------------------------------------------------
+ */
+void BaseQNPostProcessing::compressHistory()
+{
+  TRACE(getLSSystemCols());
+
+  int cols = getLSSystemCols();
+  if (cols == 0) {
+    return;
+  }
+
+  // Gram matrix of the scaled V, summed up over all ranks in master-slave mode
+  Eigen::MatrixXd scaledV = _matrixV;
+  _preconditioner->apply(scaledV);
+  Eigen::MatrixXd localGram = scaledV.transpose() * scaledV;
+  Eigen::MatrixXd gram      = localGram;
+  utils::MasterSlave::allreduceSum(localGram.data(), gram.data(), gram.size());
+
+  // eigenvalues of the Gram matrix are the squared singular values in ascending order,
+  // the eigenvectors are the right singular vectors of the scaled V
+  Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> solver(gram);
+  const Eigen::VectorXd &squaredSigmas = solver.eigenvalues();
+
+  double threshold = _historyTruncationEps * _historyTruncationEps * squaredSigmas(cols - 1);
+  int    maxRank   = std::min(cols, getLSSystemRows());
+  int    rank      = 0;
+  while (rank < maxRank && squaredSigmas(cols - 1 - rank) > threshold) {
+    rank++;
+  }
+  DEBUG("Compressing least-squares system with " << cols << " cols to " << rank << " modes");
+
+  // dominant modes first, i.e., the least significant mode is dropped first if the column limit is reached
+  Eigen::MatrixXd transform = solver.eigenvectors().rightCols(rank).rowwise().reverse();
+  transformMatrixColumns(transform);
+
+  _matrixCols.clear();
+  if (rank > 0) {
+    _matrixCols.push_back(rank);
+  }
+
+  _preconditioner->apply(_matrixV);
+  _qrV.reset(_matrixV, getLSSystemRows());
+  _preconditioner->revert(_matrixV);
+  _resetLS = true; // need to recompute _Wtil, Q, R (only for IMVJ efficient update)
+}
+
 void BaseQNPostProcessing::exportState(
-    io::TXTWriter &writer)
+    io::BinaryWriter &writer)
 {
+  TRACE();
+  writer.write(_firstIteration);
+  writer.write(_firstTimeStep);
+  writer.write(_oldXTilde);
+  writer.write(_oldResiduals);
+  writer.write(_matrixV);
+  writer.write(_matrixW);
+  writer.write(_matrixCols);
+  writer.write(_matrixVBackup);
+  writer.write(_matrixWBackup);
+  writer.write(_matrixColsBackup);
+  writer.write(_qrV.matrixQ());
+  writer.write(_qrV.matrixR());
+  writer.write(_qrV.rows());
+  writer.write(_qrV.cols());
+  _preconditioner->exportState(writer);
+  writer.write(its);
+  writer.write(tSteps);
 }
 
 void BaseQNPostProcessing::importState(
-    io::TXTReader &reader)
+    io::BinaryReader &reader)
 {
+  TRACE();
+  reader.read(_firstIteration);
+  reader.read(_firstTimeStep);
+  reader.read(_oldXTilde);
+  reader.read(_oldResiduals);
+  assertion(_oldXTilde.size() == _values.size(), _oldXTilde.size(), _values.size());
+  reader.read(_matrixV);
+  reader.read(_matrixW);
+  reader.read(_matrixCols);
+  reader.read(_matrixVBackup);
+  reader.read(_matrixWBackup);
+  reader.read(_matrixColsBackup);
+
+  Eigen::MatrixXd Q, R;
+  int             rows = 0, cols = 0;
+  reader.read(Q);
+  reader.read(R);
+  reader.read(rows);
+  reader.read(cols);
+  if (cols > 0) {
+    _qrV.reset(Q, R, rows, cols);
+  } else {
+    _qrV.reset();
+  }
+  // set the number of global rows in the QRFactorization. This is essential for the correctness in master-slave mode!
+  _qrV.setGlobalRows(getLSSystemRows());
+
+  _preconditioner->importState(reader);
+  reader.read(its);
+  reader.read(tSteps);
+  _resetLS = true; // need to recompute _Wtil, Q, R (only for IMVJ efficient update)
 }
 
 int BaseQNPostProcessing::getDeletedColumns()
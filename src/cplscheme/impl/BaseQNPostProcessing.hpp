@@ -124,19 +124,20 @@ public:
     *        In case of manifold mapping it also returns the design specification
     *        for the surrogate model which is updated in every iteration.
     */
-  virtual std::map<int, Eigen::VectorXd> getDesignSpecification(DataMap &cplData);
+  virtual const std::map<int, Eigen::VectorXd> &getDesignSpecification(DataMap &cplData);
 
   /**
     * @brief Exports the current state of the post-processing to a file.
+    *
+    * Writes the LS system, i.e., V, W, the QR decomposition of V and the preconditioner weights,
+    * such that a restarted run can perform quasi-Newton steps right away.
     */
-  virtual void exportState(io::TXTWriter &writer);
+  virtual void exportState(io::BinaryWriter &writer);
 
   /**
     * @brief Imports the last exported state of the post-processing from file.
-    *
-    * Is empty at the moment!!!
     */
-  virtual void importState(io::TXTReader &reader);
+  virtual void importState(io::BinaryReader &reader);
 
   // delete this:
   virtual int getDeletedColumns();
@@ -218,6 +219,13 @@ protected:
     */
   double _singularityLimit;
 
+  /** @brief Relative threshold for the truncation of singular values, if the history is compressed.
+    *
+    * If larger than zero, the columns of V and W are replaced by the dominant modes of the
+    * history after every converged time step, see compressHistory(). Zero disables the compression.
+    */
+  double _historyTruncationEps = 0.0;
+
   /** @brief Indices (of columns in W, V matrices) of 1st iterations of timesteps.
     *
     * When old timesteps are reused (_timestepsReused > 0), the indices of the
@@ -275,6 +283,19 @@ protected:
   /// Removes one iteration from V,W matrices and adapts _matrixCols.
   virtual void removeMatrixColumn(int columnIndex);
 
+  /// Replaces the columns of the V,W matrices by linear combinations, i.e., V := V * transform.
+  virtual void transformMatrixColumns(const Eigen::MatrixXd &transform);
+
+  /**
+    * @brief Compresses the history of the LS system to its dominant modes.
+    *
+    * Computes the SVD V' = U S Z^T of the scaled matrix V' = P * V from the eigen decomposition of
+    * the (globally reduced) Gram matrix V'^T V' and replaces V, W by V * Z_k, W * Z_k, where Z_k holds the
+    * right singular vectors with singular values larger than _historyTruncationEps times the largest one.
+    * All modes are kept in one block of columns, the QR decomposition of V is recomputed.
+    */
+  void compressHistory();
+
   /// Wwrites info to the _infostream (also in parallel)
   void writeInfo(std::string s, bool allProcs = false);
 
@@ -298,6 +319,9 @@ private:
     */
   Eigen::VectorXd _designSpecification;
 
+  /// Design specification per data ID, returned by getDesignSpecification()
+  std::map<int, Eigen::VectorXd> _designSpecifications;
+
   /** @brief backup of the V,W and matrixCols data structures. Needed for the skipping of
    *  initial relaxation, if previous time step converged within one iteration i.e., V and W
    *  are empty -- in this case restore V and W with time step t-2.
@@ -65,23 +65,18 @@ void ConstantRelaxationPostProcessing::performPostProcessing(DataMap &cplData)
  * 
  * This information is needed for convergence measurements in the coupling scheme.
  */
-std::map<int, Eigen::VectorXd> ConstantRelaxationPostProcessing::getDesignSpecification(
+const std::map<int, Eigen::VectorXd> &ConstantRelaxationPostProcessing::getDesignSpecification(
     DataMap &cplData)
 {
 
-  std::map<int, Eigen::VectorXd> designSpecifications;
-  int                            off = 0;
+  int off = 0;
   for (int id : _dataIDs) {
-    int             size = cplData[id]->values->size();
-    Eigen::VectorXd q    = Eigen::VectorXd::Zero(size);
-    for (int i = 0; i < size; i++) {
-      q(i) = _designSpecification(i + off);
-    }
+    int size = cplData[id]->values->size();
+    // the cached vector keeps its storage, as long as the size does not change
+    _designSpecifications[id] = _designSpecification.segment(off, size);
     off += size;
-    std::map<int, Eigen::VectorXd>::value_type pair = std::make_pair(id, q);
-    designSpecifications.insert(pair);
   }
-  return designSpecifications;
+  return _designSpecifications;
 }
 
 void ConstantRelaxationPostProcessing::setDesignSpecification(Eigen::VectorXd &q)
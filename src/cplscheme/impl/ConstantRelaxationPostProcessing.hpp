@@ -28,7 +28,7 @@ public:
   virtual void setDesignSpecification(
       Eigen::VectorXd &q);
 
-  virtual std::map<int, Eigen::VectorXd> getDesignSpecification(DataMap &cplData);
+  virtual const std::map<int, Eigen::VectorXd> &getDesignSpecification(DataMap &cplData);
 
   virtual void initialize(DataMap &cplData);
 
@@ -46,6 +46,9 @@ private:
   std::vector<int> _dataIDs;
 
   Eigen::VectorXd _designSpecification;
+
+  /// Design specification per data ID, returned by getDesignSpecification()
+  std::map<int, Eigen::VectorXd> _designSpecifications;
 };
 }
 }
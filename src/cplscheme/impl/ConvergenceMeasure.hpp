@@ -1,6 +1,8 @@
 #pragma once
 
 #include <Eigen/Core>
+#include <vector>
+#include "utils/MasterSlave.hpp"
 
 namespace precice
 {
@@ -21,6 +23,11 @@ namespace impl
  * -# call newMeasurementSeries() for one set of iterations
  * -# call measure() for convergence measurement
  * -# retrieve the convergence status via isConvergence()
+ *
+ * A measurement is split into computing local partial sums, e.g. squared norms of the
+ * local values, and evaluating the sums of all ranks. This allows to measure several
+ * data sets with a single reduction, see BaseCouplingScheme::measureConvergence().
+ * An empty design specification is treated as zero.
  */
 class ConvergenceMeasure
 {
@@ -34,13 +41,51 @@ public:
   /**
    * @brief Performs convergence measurement.
    *
+   * Reduces the partial sums over all ranks on its own.
+   *
    * @param[in] oldValues Old iterate values.
    * @param[in] newValues New iterate values.
    */
-  virtual void measure(
+  void measure(
       const Eigen::VectorXd &oldValues,
       const Eigen::VectorXd &newValues,
-      const Eigen::VectorXd &designSpecification) = 0;
+      const Eigen::VectorXd &designSpecification)
+  {
+    std::vector<double> localSums(getNumberOfPartialSums(), 0.0);
+    computePartialSums(oldValues, newValues, designSpecification, localSums.data());
+    std::vector<double> globalSums(localSums);
+    if (not localSums.empty()) {
+      utils::MasterSlave::allreduceSum(localSums.data(), globalSums.data(), localSums.size());
+    }
+    measure(globalSums.data());
+  }
+
+  /// Returns the number of partial sums computed by computePartialSums().
+  virtual int getNumberOfPartialSums() const
+  {
+    return 0;
+  }
+
+  /**
+   * @brief Computes the partial sums of the local values needed for the measurement.
+   *
+   * @param[in] oldValues Old iterate values.
+   * @param[in] newValues New iterate values.
+   * @param[out] sums Partial sums, getNumberOfPartialSums() many.
+   */
+  virtual void computePartialSums(
+      const Eigen::Ref<const Eigen::VectorXd> &oldValues,
+      const Eigen::Ref<const Eigen::VectorXd> &newValues,
+      const Eigen::Ref<const Eigen::VectorXd> &designSpecification,
+      double *                                 sums) const
+  {}
+
+  /**
+   * @brief Performs convergence measurement from the partial sums of all ranks.
+   *
+   * @param[in] globalSums Partial sums reduced over all ranks.
+   */
+  virtual void measure(const double *globalSums) = 0;
 
   /// Returns true, if the last measurement indicates convergence.
   virtual bool isConvergence() const = 0;
@@ -53,6 +98,19 @@ public:
   {
     return 0;
   }
+
+protected:
+  /// Returns the squared norm of the local residual newValues - oldValues - designSpecification.
+  static double squaredResidualNorm(
+      const Eigen::Ref<const Eigen::VectorXd> &oldValues,
+      const Eigen::Ref<const Eigen::VectorXd> &newValues,
+      const Eigen::Ref<const Eigen::VectorXd> &designSpecification)
+  {
+    if (designSpecification.size() == 0) {
+      return (newValues - oldValues).squaredNorm();
+    }
+    return (newValues - oldValues - designSpecification).squaredNorm();
+  }
 };
 }
 }
@@ -11,6 +11,14 @@ namespace cplscheme
 {
 namespace impl
 {
+namespace
+{
+/// Returns the hierarchical surplus of the entry index, whose neighbors on its level are half entries away.
+inline double surplus(const Eigen::VectorXd &nodal, size_t index, size_t half)
+{
+  return nodal(index) - (nodal(index - half) + nodal(index + half)) / 2.0;
+}
+} // namespace
 
 HierarchicalAitkenPostProcessing::HierarchicalAitkenPostProcessing(
     double           initialRelaxation,
@@ -33,6 +41,7 @@ void HierarchicalAitkenPostProcessing::initialize(DataMap &cplData)
   double          initializer = std::numeric_limits<double>::max();
   Eigen::VectorXd toAppend    = Eigen::VectorXd::Constant(entries, initializer);
   utils::append(_residual, toAppend);
+  _newResidual = Eigen::VectorXd::Zero(_residual.size());
 
   size_t entriesCurrentLevel = 1;
   size_t totalEntries        = 2;               // Boundary entries
@@ -58,73 +67,45 @@ void HierarchicalAitkenPostProcessing::performPostProcessing(
     DataMap &cplData)
 {
   TRACE();
-  typedef Eigen::VectorXd DataValues;
 
   // Compute aitken relaxation factor
   assertion(utils::contained(*_dataIDs.begin(), cplData));
-  auto &values = *cplData[*_dataIDs.begin()]->values;
-
-  // Attention: no passing by ref any more --> needs to be written back at the end of the function!
-  Eigen::VectorXd oldValues = cplData[*_dataIDs.begin()]->oldValues.col(0);
-
-  // Compute current residuals
-  DataValues residual = values;
-  residual -= oldValues;
-
-  // Compute residual deltas and temporarily store it in _residuals
-  DataValues residualDelta = _residual;
-  residualDelta *= -1.0;
-  residualDelta += residual;
-
-  std::vector<double> nominators(_aitkenFactors.size(), 0.0);
-  std::vector<double> denominators(_aitkenFactors.size(), 0.0);
-
-  //  INFO ( "" );
-  //  INFO ( "values = " << values );
-  //  INFO ( "oldValues = " << oldValues );
-  //  INFO ( "residual = " << residual );
-  //  INFO ( "_residual = " << _residual );
-  //  INFO ( "residualDelta = " << residualDelta );
-
-  // Hierarchize entries
-  size_t entries             = residual.size();
-  size_t treatedEntries      = 2;
-  size_t entriesCurrentLevel = std::pow(2.0, (int) (_aitkenFactors.size() - 2));
-  for (size_t level = _aitkenFactors.size() - 1; level > 0; level--) {
-    size_t stepsize = (entries - 1) / std::pow(2.0, (int) (level - 1));
-    assertion(stepsize % 2 == 0);
-    size_t index = stepsize / 2;
-
-    for (size_t i = 0; i < entriesCurrentLevel; i++) {
-      _residual(index) -= (_residual(index - stepsize / 2) +
-                           _residual(index + stepsize / 2)) /
-                          2.0;
-      residualDelta(index) -= (residualDelta(index - stepsize / 2) +
-                               residualDelta(index + stepsize / 2)) /
-                              2.0;
-      values(index) -= (values(index - stepsize / 2) +
-                        values(index + stepsize / 2)) /
-                       2.0;
-      oldValues(index) -= (oldValues(index - stepsize / 2) +
-                           oldValues(index + stepsize / 2)) /
-                          2.0;
-      index += stepsize;
+  auto &      values    = *cplData[*_dataIDs.begin()]->values;
+  const auto &oldValues = cplData[*_dataIDs.begin()]->oldValues.col(0);
+  size_t      entries   = values.size();
+  assertion(entries == static_cast<size_t>(_residual.size()), entries, _residual.size());
+
+  // Compute current residual
+  _newResidual = values - oldValues;
+
+  // Hierarchization is linear, hence the hierarchical surpluses of the residual deltas are the
+  // differences of the residual surpluses. They are computed from the nodal values of both
+  // residuals in one pass per level, without hierarchizing any vector.
+  size_t              levels = _aitkenFactors.size();
+  std::vector<double> nominators(levels, 0.0);
+  std::vector<double> denominators(levels, 0.0);
+  if (_iterationCounter > 0) {
+    for (size_t index : {size_t(0), entries - 1}) {
+      double residualDelta = _newResidual(index) - _residual(index);
+      nominators[0] += _residual(index) * residualDelta;
+      denominators[0] += residualDelta * residualDelta;
+    }
+    for (size_t level = 1; level < levels; level++) {
+      size_t stepsize = (entries - 1) >> (level - 1);
+      assertion(stepsize % 2 == 0);
+      for (size_t index = stepsize / 2; index < entries; index += stepsize) {
+        double oldSurplus    = surplus(_residual, index, stepsize / 2);
+        double residualDelta = surplus(_newResidual, index, stepsize / 2) - oldSurplus;
+        nominators[level] += oldSurplus * residualDelta;
+        denominators[level] += residualDelta * residualDelta;
+      }
     }
-    treatedEntries += entriesCurrentLevel;
-    entriesCurrentLevel /= 2;
   }
-  assertion(treatedEntries == entries);
-  //  INFO ( "hierarchized values = " << values );
-  //  INFO ( "hierarchized oldValues = " << oldValues );
-  //  INFO ( "hierarchized _residual = " << _residual );
-  //  INFO ( "hierarchized residualDelta = " << residualDelta );
+  for (size_t level = 0; level < levels; level++) {
+    computeAitkenFactor(level, nominators[level], denominators[level]);
+  }
 
-  // Compute and perform relaxation with aitken factor
-  nominators[0] = _residual(0) * residualDelta(0) +
-                  _residual(entries - 1) * residualDelta(entries - 1);
-  denominators[0] = residualDelta(0) * residualDelta(0) +
-                    residualDelta(entries - 1) * residualDelta(entries - 1);
-  computeAitkenFactor(0, nominators[0], denominators[0]);
+  // Perform relaxation with aitken factor on the boundary entries
   double omega         = _aitkenFactors[0];
   double oneMinusOmega = 1.0 - omega;
   for (DataMap::value_type &pair : cplData) {
@@ -133,77 +114,23 @@ void HierarchicalAitkenPostProcessing::performPostProcessing(
     values(0)             = values(0) * omega + oldValues(0) * oneMinusOmega;
     values(entries - 1)   = values(entries - 1) * omega + oldValues(entries - 1) * oneMinusOmega;
   }
-  treatedEntries      = 2;
-  entriesCurrentLevel = 1;
-  for (size_t level = 1; level < _aitkenFactors.size(); level++) {
-    size_t stepsize = (entries - 1) / std::pow(2.0, (int) (level - 1));
-    size_t index    = stepsize / 2;
-    for (size_t i = 0; i < entriesCurrentLevel; i++) {
-      nominators[level] += _residual(index) * residualDelta(index);
-      denominators[level] += residualDelta(index) * residualDelta(index);
-      index += stepsize;
-    }
-    computeAitkenFactor(level, nominators[level], denominators[level]);
-    omega         = _aitkenFactors[level];
-    oneMinusOmega = 1.0 - omega;
-    //for ( DataMap::value_type & pair : cplData ) {
-    //  DataValues & values = *pair.second.values;
-    //  DataValues & oldValues = pair.second.oldValues.getColumn(0);
-    index = stepsize / 2;
-    for (size_t i = 0; i < entriesCurrentLevel; i++) {
-      values(index) = values(index) * omega + oldValues(index) * oneMinusOmega;
-      index += stepsize;
-    }
-    //}
-    treatedEntries += entriesCurrentLevel;
-    entriesCurrentLevel *= 2;
-  }
-  assertion(treatedEntries == entries);
 
-  _residual = residual; // Overwrite old residual by current one
-
-  //  double nom = 0.0;
-  //  double denom = 0.0;
-  //  for ( size_t i=0; i < entries; i++ ) {
-  //    nom += _residual[i] * residualDelta[i];
-  //    denom += residualDelta[i] * residualDelta[i];
-  //  }
-  //  computeAitkenFactor ( 0, nom, denom );
-  //  double omega = _aitkenFactors[0];
-  //  double oneMinusOmega = 1.0 - omega;
-  //  for ( DataMap::value_type & pair : cplData ) {
-  //    DataValues & values = *pair.second.values;
-  //    DataValues & oldValues = pair.second.oldValues.getColumn(0);
-  //    for ( size_t i=0; i < entries; i++ ) {
-  //      values[i] = values[i] * omega + oldValues[i] * oneMinusOmega;
-  //    }
-  //  }
-  //  _residual = residual; // Overwrite old residual by current one
-
-  //  INFO ( "relaxed hierarchized values = " << values );
-
-  // Dehierarchization
-  treatedEntries      = 2;
-  entriesCurrentLevel = 1;
-  for (size_t level = 1; level < _aitkenFactors.size(); level++) {
-    size_t stepsize = (entries - 1) / std::pow(2.0, (int) (level - 1));
-    size_t index    = stepsize / 2;
-    for (size_t i = 0; i < entriesCurrentLevel; i++) {
-      values(index) +=
-          (values(index - stepsize / 2) + values(index + stepsize / 2)) / 2.0;
-      oldValues(index) +=
-          (oldValues(index - stepsize / 2) + oldValues(index + stepsize / 2)) / 2.0;
-      index += stepsize;
+  // Relaxing the surpluses and dehierarchizing equals adding the dehierarchized relaxed residual
+  // surpluses to the old values. Going from coarse to fine levels, the correction of the
+  // neighbors is the difference of their already relaxed values to the old values.
+  for (size_t level = 1; level < levels; level++) {
+    size_t stepsize = (entries - 1) >> (level - 1);
+    size_t half     = stepsize / 2;
+    omega           = _aitkenFactors[level];
+    for (size_t index = half; index < entries; index += stepsize) {
+      double neighborCorrection = (values(index - half) - oldValues(index - half) +
+                                   values(index + half) - oldValues(index + half)) /
+                                  2.0;
+      values(index) = oldValues(index) + omega * surplus(_newResidual, index, half) + neighborCorrection;
     }
-    treatedEntries += entriesCurrentLevel;
-    entriesCurrentLevel *= 2;
   }
-  assertion(treatedEntries == entries);
-  //  INFO ( "relaxed values = " << values );
-  //  INFO ( "oldValues = " << oldValues );
 
-  // save back oldValues in cplData. Eigen does not allow call by ref for blocks (cols, rows), thus explicitly write back
-  cplData[*_dataIDs.begin()]->oldValues.col(0) = oldValues;
+  _residual.swap(_newResidual); // Overwrite old residual by current one
 
   _iterationCounter++;
 }
@@ -212,7 +139,7 @@ void HierarchicalAitkenPostProcessing::iterationsConverged(
     DataMap &cplData)
 {
   _iterationCounter = 0;
-  _residual         = Eigen::VectorXd::Constant(_residual.size(), std::numeric_limits<double>::max());
+  _residual.setConstant(std::numeric_limits<double>::max());
 }
 
 void HierarchicalAitkenPostProcessing::computeAitkenFactor(
@@ -244,24 +171,19 @@ void HierarchicalAitkenPostProcessing::computeAitkenFactor(
  *         This information is needed for convergence measurements in the coupling scheme.
  *  ---------------------------------------------------------------------------------------------
  */
-std::map<int, Eigen::VectorXd> HierarchicalAitkenPostProcessing::getDesignSpecification(
+const std::map<int, Eigen::VectorXd> &HierarchicalAitkenPostProcessing::getDesignSpecification(
     DataMap &cplData)
 {
   ERROR("Design specification for Aitken relaxation is not supported yet.");
 
-  std::map<int, Eigen::VectorXd> designSpecifications;
-  int                            off = 0;
+  int off = 0;
   for (int id : _dataIDs) {
-    int             size = cplData[id]->values->size();
-    Eigen::VectorXd q    = Eigen::VectorXd::Zero(size);
-    for (int i = 0; i < size; i++) {
-      q(i) = _designSpecification(i + off);
-    }
+    int size = cplData[id]->values->size();
+    // the cached vector keeps its storage, as long as the size does not change
+    _designSpecifications[id] = _designSpecification.segment(off, size);
     off += size;
-    std::map<int, Eigen::VectorXd>::value_type pair = std::make_pair(id, q);
-    designSpecifications.insert(pair);
   }
-  return designSpecifications;
+  return _designSpecifications;
 }
 
 void HierarchicalAitkenPostProcessing::setDesignSpecification(
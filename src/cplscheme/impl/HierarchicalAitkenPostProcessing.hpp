@@ -29,7 +29,7 @@ public:
   virtual void setDesignSpecification(
       Eigen::VectorXd &q);
 
-  virtual std::map<int, Eigen::VectorXd> getDesignSpecification(DataMap &cplData);
+  virtual const std::map<int, Eigen::VectorXd> &getDesignSpecification(DataMap &cplData);
 
   virtual void initialize(DataMap &cplData);
 
@@ -50,8 +50,14 @@ private:
 
   Eigen::VectorXd _residual;
 
+  /// Buffer for the current residual, swapped with _residual after each iteration.
+  Eigen::VectorXd _newResidual;
+
   Eigen::VectorXd _designSpecification;
 
+  /// Design specification per data ID, returned by getDesignSpecification()
+  std::map<int, Eigen::VectorXd> _designSpecifications;
+
   void computeAitkenFactor(
       size_t level,
       double nominator,
@@ -3,8 +3,8 @@
 #include "QRFactorization.hpp"
 #include "com/Communication.hpp"
 #include "cplscheme/CouplingData.hpp"
-#include "io/TXTReader.hpp"
-#include "io/TXTWriter.hpp"
+#include "io/BinaryReader.hpp"
+#include "io/BinaryWriter.hpp"
 #include "mesh/Mesh.hpp"
 #include "mesh/Vertex.hpp"
 #include "utils/EigenHelperFunctions.hpp"
@@ -32,10 +32,18 @@ IQNILSPostProcessing::IQNILSPostProcessing(
     int               filter,
     double            singularityLimit,
     std::vector<int>  dataIDs,
-    PtrPreconditioner preconditioner)
+    PtrPreconditioner preconditioner,
+    double            historyTruncationEps)
     : BaseQNPostProcessing(initialRelaxation, forceInitialRelaxation, maxIterationsUsed, timestepsReused,
                            filter, singularityLimit, dataIDs, preconditioner)
-{}
+{
+  CHECK((historyTruncationEps >= 0.0) && (historyTruncationEps < 1.0),
+        "Truncation threshold for the history compression of IQN-ILS post-processing has to be "
+            << "larger or equal than zero and smaller than one!");
+  CHECK(historyTruncationEps == 0.0 || _timestepsReused > 0,
+        "History compression of IQN-ILS post-processing requires timesteps-reused to be larger than zero!");
+  _historyTruncationEps = historyTruncationEps;
+}
 
 void IQNILSPostProcessing::initialize(
     DataMap &cplData)
@@ -250,6 +258,8 @@ void IQNILSPostProcessing::specializedIterationsConverged(
        * is better than doing underrelaxation as first iteration of every time step
        */
     }
+  } else if (_historyTruncationEps > 0.0) {
+    // secondary data matrices are compressed along with V, W in transformMatrixColumns()
   } else if ((int) _matrixCols.size() > _timestepsReused) {
     int toRemove = _matrixCols.back();
     for (int id : _secondaryDataIDs) {
@@ -273,6 +283,45 @@ void IQNILSPostProcessing::removeMatrixColumn(
 
   BaseQNPostProcessing::removeMatrixColumn(columnIndex);
 }
+
+void IQNILSPostProcessing::transformMatrixColumns(
+    const Eigen::MatrixXd &transform)
+{
+  for (int id : _secondaryDataIDs) {
+    Eigen::MatrixXd &secW = _secondaryMatricesW[id];
+    secW                  = secW * transform;
+  }
+
+  BaseQNPostProcessing::transformMatrixColumns(transform);
+}
+
+void IQNILSPostProcessing::exportState(
+    io::BinaryWriter &writer)
+{
+  TRACE();
+  BaseQNPostProcessing::exportState(writer);
+  for (int id : _secondaryDataIDs) {
+    writer.write(id);
+    writer.write(_secondaryOldXTildes[id]);
+    writer.write(_secondaryMatricesW[id]);
+    writer.write(_secondaryMatricesWBackup[id]);
+  }
+}
+
+void IQNILSPostProcessing::importState(
+    io::BinaryReader &reader)
+{
+  TRACE();
+  BaseQNPostProcessing::importState(reader);
+  for (int id : _secondaryDataIDs) {
+    int storedID = -1;
+    reader.read(storedID);
+    CHECK(storedID == id, "Checkpoint of IQN-ILS post-processing does not match the configured secondary data!");
+    reader.read(_secondaryOldXTildes[id]);
+    reader.read(_secondaryMatricesW[id]);
+    reader.read(_secondaryMatricesWBackup[id]);
+  }
+}
 }
 }
 } // namespace precice, cplscheme, impl
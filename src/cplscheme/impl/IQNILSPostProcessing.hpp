@@ -21,6 +21,10 @@ namespace impl
  * this data is relaxed using the same linear combination as computed for the
  * IQN-related data. The data is called "secondary" henceforth and additional
  * old value and data matrices are needed for it.
+ *
+ * With a history truncation threshold larger than zero, the history is not
+ * limited by the number of reused time steps, but compressed to its dominant
+ * modes after every time step, see BaseQNPostProcessing::compressHistory().
  */
 class IQNILSPostProcessing : public BaseQNPostProcessing
 {
@@ -33,7 +37,8 @@ public:
       int               filter,
       double            singularityLimit,
       std::vector<int>  dataIDs,
-      PtrPreconditioner preconditioner);
+      PtrPreconditioner preconditioner,
+      double            historyTruncationEps = 0.0);
 
   virtual ~IQNILSPostProcessing() {}
 
@@ -48,6 +53,12 @@ public:
     */
   virtual void specializedIterationsConverged(DataMap &cplData);
 
+  /// Exports the state of the post-processing including the secondary data matrices.
+  virtual void exportState(io::BinaryWriter &writer);
+
+  /// Imports the state of the post-processing including the secondary data matrices.
+  virtual void importState(io::BinaryReader &reader);
+
 private:
   /// Secondary data solver output from last iteration.
   std::map<int, Eigen::VectorXd> _secondaryOldXTildes;
@@ -69,6 +80,9 @@ private:
 
   /// Removes one iteration from V,W matrices and adapts _matrixCols.
   virtual void removeMatrixColumn(int columnIndex);
+
+  /// Transforms the columns of the V,W matrices and of the secondary data matrices.
+  virtual void transformMatrixColumns(const Eigen::MatrixXd &transform);
 };
 }
 }
@@ -3,6 +3,8 @@
 #include "QRFactorization.hpp"
 #include "com/Communication.hpp"
 #include "cplscheme/CouplingData.hpp"
+#include "io/BinaryReader.hpp"
+#include "io/BinaryWriter.hpp"
 #include "mesh/Mesh.hpp"
 #include "mesh/Vertex.hpp"
 #include "utils/EigenHelperFunctions.hpp"
@@ -251,33 +253,23 @@ void MMPostProcessing::setDesignSpecification(
  *         coupling scheme.
  *  ---------------------------------------------------------------------------------------------
  */
-std::map<int, Eigen::VectorXd> MMPostProcessing::getDesignSpecification(
+const std::map<int, Eigen::VectorXd> &MMPostProcessing::getDesignSpecification(
     DataMap &cplData)
 {
-  std::map<int, Eigen::VectorXd> designSpecifications;
-  int                            off = 0;
+  int off = 0;
   for (int id : _fineDataIDs) {
-    int             size = cplData[id]->values->size();
-    Eigen::VectorXd q    = Eigen::VectorXd::Zero(size);
-    for (int i = 0; i < size; i++) {
-      q(i) = _designSpecification(i + off);
-    }
+    int size = cplData[id]->values->size();
+    // the cached vector keeps its storage, as long as the size does not change
+    _designSpecifications[id] = _designSpecification.segment(off, size);
     off += size;
-    std::map<int, Eigen::VectorXd>::value_type pair = std::make_pair(id, q);
-    designSpecifications.insert(pair);
   }
   off = 0;
   for (int id : _coarseDataIDs) {
-    int             size = cplData[id]->values->size();
-    Eigen::VectorXd q    = Eigen::VectorXd::Zero(size);
-    for (int i = 0; i < size; i++) {
-      q(i) = _coarseModel_designSpecification(i + off);
-    }
+    int size = cplData[id]->values->size();
+    _designSpecifications[id] = _coarseModel_designSpecification.segment(off, size);
     off += size;
-    std::map<int, Eigen::VectorXd>::value_type pair = std::make_pair(id, q);
-    designSpecifications.insert(pair);
   }
-  return designSpecifications;
+  return _designSpecifications;
 }
 
 /** ---------------------------------------------------------------------------------------------
@@ -784,13 +776,37 @@ void MMPostProcessing::removeMatrixColumn(
 }
 
 void MMPostProcessing::exportState(
-    io::TXTWriter &writer)
+    io::BinaryWriter &writer)
 {
+  TRACE();
+  writer.write(_firstIteration);
+  writer.write(_firstTimeStep);
+  writer.write(_fineOldResiduals);
+  writer.write(_coarseOldResiduals);
+  writer.write(_matrixF);
+  writer.write(_matrixC);
+  writer.write(_matrixCols);
+  writer.write(_MMMappingMatrix);
+  writer.write(_MMMappingMatrix_prev);
+  _preconditioner->exportState(writer);
+  _coarseModelOptimization->exportState(writer);
 }
 
 void MMPostProcessing::importState(
-    io::TXTReader &reader)
+    io::BinaryReader &reader)
 {
+  TRACE();
+  reader.read(_firstIteration);
+  reader.read(_firstTimeStep);
+  reader.read(_fineOldResiduals);
+  reader.read(_coarseOldResiduals);
+  reader.read(_matrixF);
+  reader.read(_matrixC);
+  reader.read(_matrixCols);
+  reader.read(_MMMappingMatrix);
+  reader.read(_MMMappingMatrix_prev);
+  _preconditioner->importState(reader);
+  _coarseModelOptimization->importState(reader);
 }
 
 int MMPostProcessing::getDeletedColumns()
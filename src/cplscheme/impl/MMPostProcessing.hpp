@@ -77,7 +77,7 @@ public:
    *        In case of manifold mapping it also returns the design specification
    *        for the surrogate model which is updated in every iteration.
    */
-  virtual std::map<int, Eigen::VectorXd> getDesignSpecification(DataMap &cplData);
+  virtual const std::map<int, Eigen::VectorXd> &getDesignSpecification(DataMap &cplData);
 
   /**
    * @brief Sets whether the solver has to evaluate the coarse or the fine model representation
@@ -88,15 +88,11 @@ public:
     _isCoarseModelOptimizationActive = coarseOptActive;
   }
 
-  /// Exports the current state of the post-processing to a file.
-  virtual void exportState(io::TXTWriter &writer);
+  /// Exports the current state of the post-processing and its coarse model optimization to a file.
+  virtual void exportState(io::BinaryWriter &writer);
 
-  /**
-   * @brief Imports the last exported state of the post-processing from file.
-   *
-   * Is empty at the moment!!!
-   */
-  virtual void importState(io::TXTReader &reader);
+  /// Imports the last exported state of the post-processing from file.
+  virtual void importState(io::BinaryReader &reader);
 
   // delete this:
   virtual int getDeletedColumns();
@@ -138,6 +134,9 @@ private:
   Eigen::VectorXd _designSpecification;
   Eigen::VectorXd _coarseModel_designSpecification;
 
+  /// Design specification per data ID, returned by getDesignSpecification()
+  std::map<int, Eigen::VectorXd> _designSpecifications;
+
   /**
    * @brief Sets whether the solver has to evaluate the coarse or the fine model representation
    * steers the coupling scheme and the post processing.
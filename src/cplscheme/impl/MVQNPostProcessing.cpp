@@ -6,6 +6,8 @@
 #include "com/MPIPortsCommunication.hpp"
 #include "com/SocketCommunication.hpp"
 #include "cplscheme/CouplingData.hpp"
+#include "io/BinaryReader.hpp"
+#include "io/BinaryWriter.hpp"
 #include "mesh/Mesh.hpp"
 #include "mesh/Vertex.hpp"
 #include "utils/EigenHelperFunctions.hpp"
@@ -154,6 +156,7 @@ void MVQNPostProcessing::initialize(
   // initialize parallel matrix-matrix operation module
   _parMatrixOps = impl::PtrParMatrixOps(new impl::ParallelMatrixOperations());
   _parMatrixOps->initialize(_cyclicCommLeft, _cyclicCommRight, not _imvjRestart);
+  _parMatrixOps->setMaxCyclicRanks(_maxCyclicRanks);
   _svdJ.initialize(_parMatrixOps, getLSSystemRows());
 
   int entries  = _residuals.size();
@@ -890,6 +893,44 @@ void MVQNPostProcessing::removeMatrixColumnRSLS(
     iter++;
   }
 }
+
+void MVQNPostProcessing::exportState(
+    io::BinaryWriter &writer)
+{
+  TRACE();
+  BaseQNPostProcessing::exportState(writer);
+  writer.write(_oldInvJacobian);
+  writer.write(_invJacobian);
+  writer.write(_Wtil);
+  writer.write(_WtilChunk);
+  writer.write(_pseudoInverseChunk);
+  writer.write(_matrixV_RSLS);
+  writer.write(_matrixW_RSLS);
+  writer.write(_matrixCols_RSLS);
+  writer.write(_nbRestarts);
+  if (_imvjRestartType == RS_SVD) {
+    _svdJ.exportState(writer);
+  }
+}
+
+void MVQNPostProcessing::importState(
+    io::BinaryReader &reader)
+{
+  TRACE();
+  BaseQNPostProcessing::importState(reader);
+  reader.read(_oldInvJacobian);
+  reader.read(_invJacobian);
+  reader.read(_Wtil);
+  reader.read(_WtilChunk);
+  reader.read(_pseudoInverseChunk);
+  reader.read(_matrixV_RSLS);
+  reader.read(_matrixW_RSLS);
+  reader.read(_matrixCols_RSLS);
+  reader.read(_nbRestarts);
+  if (_imvjRestartType == RS_SVD) {
+    _svdJ.importState(reader);
+  }
+}
 }
 }
 } // namespace precice, cplscheme, impl
@@ -62,6 +62,12 @@ public:
     */
   virtual ~MVQNPostProcessing();
 
+  /// Sets the number of ranks up to which W_til * Z uses the cyclic communication, see ParallelMatrixOperations.
+  void setMaxCyclicRanks(int maxCyclicRanks)
+  {
+    _maxCyclicRanks = maxCyclicRanks;
+  }
+
   /**
     * @brief Initializes the post-processing.
     */
@@ -75,6 +81,12 @@ public:
     */
   virtual void specializedIterationsConverged(DataMap &cplData);
 
+  /// Exports the state of the post-processing including the Jacobian or its chunks in restart mode.
+  virtual void exportState(io::BinaryWriter &writer);
+
+  /// Imports the state of the post-processing including the Jacobian or its chunks in restart mode.
+  virtual void importState(io::BinaryReader &reader);
+
 private:
   /// @brief stores the approximation of the inverse Jacobian of the system at current time step.
   Eigen::MatrixXd _invJacobian;
@@ -138,6 +150,9 @@ private:
   /// @brief: Number of reused time steps at restart if restart-mode = RS-LS
   int _RSLSreusedTimesteps;
 
+  /// @brief: Above this number of ranks, W_til is gathered instead of passed around the ring, off if <= 0
+  int _maxCyclicRanks = 0;
+
   /// @brief: Number of used columns per time step. Always the first _usedColumnsPerTstep are used.
   int _usedColumnsPerTstep;
 
@@ -20,10 +20,9 @@ public:
 
   virtual void newMeasurementSeries();
 
-  virtual void measure(
-      const Eigen::VectorXd &oldValues,
-      const Eigen::VectorXd &newValues,
-      const Eigen::VectorXd &designSpecification)
+  using ConvergenceMeasure::measure;
+
+  virtual void measure(const double *globalSums)
   {
     TRACE();
     _currentIteration++;
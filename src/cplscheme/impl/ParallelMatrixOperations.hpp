@@ -8,6 +8,8 @@
 #include "utils/MasterSlave.hpp"
 #include "utils/assertion.hpp"
 #include <Eigen/Core>
+#include <algorithm>
+#include <vector>
 
 namespace precice
 {
@@ -27,6 +29,17 @@ public:
                   com::PtrCommunication rightComm,
                   bool                  needcyclicComm);
 
+  /**
+   * @brief Sets the number of ranks up to which quadratic products use the cyclic communication.
+   *
+   * For more ranks, the left matrix is gathered on the master and broadcast instead. A value <= 0,
+   * the default, always uses the cyclic communication.
+   */
+  void setMaxCyclicRanks(int maxCyclicRanks)
+  {
+    _maxCyclicRanks = maxCyclicRanks;
+  }
+
   template <typename Derived1, typename Derived2>
   void multiply(
       Eigen::PlainObjectBase<Derived1> &leftMatrix,
@@ -136,83 +149,142 @@ private:
     assertion(leftMatrix.cols() == q, leftMatrix.cols(), q);
     assertion(leftMatrix.rows() == rightMatrix.cols(), leftMatrix.rows(), rightMatrix.cols());
     assertion(result.rows() == p, result.rows(), p);
+    assertion(result.cols() == rightMatrix.cols(), result.cols(), rightMatrix.cols());
 
-    //int nextProc = (utils::MasterSlave::_rank + 1) % utils::MasterSlave::_size;
-    int prevProc = (utils::MasterSlave::_rank - 1 < 0) ? utils::MasterSlave::_size - 1 : utils::MasterSlave::_rank - 1;
-    int rows_rcv = (prevProc > 0) ? offsets[prevProc + 1] - offsets[prevProc] : offsets[1];
-    //Eigen::MatrixXd leftMatrix_rcv = Eigen::MatrixXd::Zero(rows_rcv, q);
-    Eigen::MatrixXd leftMatrix_rcv(rows_rcv, q);
+    int size = utils::MasterSlave::_size;
+    int rank = utils::MasterSlave::_rank;
+
+    // for many ranks, the ring needs size-1 steps with small blocks, gather and broadcast instead
+    if (_maxCyclicRanks > 0 && size > _maxCyclicRanks) {
+      _multiplyNN_broadcast(leftMatrix, rightMatrix, result, offsets, p, q, r);
+      return;
+    }
+
+    // the blocks of the left matrix are passed around the ring in two alternating buffers,
+    // which are only reallocated if the largest block does not fit anymore
+    int maxRows = 0;
+    for (int proc = 0; proc < size; proc++)
+      maxRows = std::max(maxRows, offsets[proc + 1] - offsets[proc]);
+    for (Eigen::VectorXd &buffer : _cyclicBuffers) {
+      if (buffer.size() < maxRows * q)
+        buffer.resize(maxRows * q);
+    }
 
     com::PtrRequest requestSend;
     com::PtrRequest requestRcv;
 
     // initiate asynchronous send operation of leftMatrix (W_til) --> nextProc (this data is needed in cycle 1)    dim: n_local x cols
-    if (leftMatrix.size() > 0)
+    if (size > 1 && leftMatrix.size() > 0)
       requestSend = _cyclicCommRight->aSend(leftMatrix.data(), leftMatrix.size(), 0);
 
     // initiate asynchronous receive operation for leftMatrix (W_til) from previous processor --> W_til      dim: rows_rcv x cols
-    if (leftMatrix_rcv.size() > 0)
-      requestRcv = _cyclicCommLeft->aReceive(leftMatrix_rcv.data(), leftMatrix_rcv.size(), 0);
+    int prevProc = (rank - 1 < 0) ? size - 1 : rank - 1;
+    int rows_rcv = offsets[prevProc + 1] - offsets[prevProc];
+    if (size > 1 && rows_rcv > 0)
+      requestRcv = _cyclicCommLeft->aReceive(_cyclicBuffers[0].data(), rows_rcv * q, 0);
 
     // compute diagonal blocks where all data is local and no communication is needed
     // compute block matrices of J_inv of size (n_til x n_til), n_til = local n
-    Eigen::MatrixXd diagBlock(leftMatrix.rows(), leftMatrix.rows());
-    diagBlock.noalias() = leftMatrix * rightMatrix;
-
-    // set block at corresponding row-index on proc
-    int off = offsets[utils::MasterSlave::_rank];
-    assertion(result.cols() == diagBlock.cols(), result.cols(), diagBlock.cols());
-    result.block(off, 0, diagBlock.rows(), diagBlock.cols()) = diagBlock;
+    result.block(offsets[rank], 0, leftMatrix.rows(), rightMatrix.cols()).noalias() = leftMatrix * rightMatrix;
 
     /**
 		 * cyclic send-receive operation
 		 */
-    for (int cycle = 1; cycle < utils::MasterSlave::_size; cycle++) {
+    for (int cycle = 1; cycle < size; cycle++) {
+
+      // compute proc that owned the received block of W_til at the very beginning, for this and the next cycle
+      int sourceProc           = (rank - cycle < 0) ? size + (rank - cycle) : rank - cycle;
+      int sourceProc_nextCycle = (rank - (cycle + 1) < 0) ? size + (rank - (cycle + 1)) : rank - (cycle + 1);
+      rows_rcv                 = offsets[sourceProc + 1] - offsets[sourceProc];
+      int rows_rcv_nextCycle   = offsets[sourceProc_nextCycle + 1] - offsets[sourceProc_nextCycle];
+
+      Eigen::VectorXd &current = _cyclicBuffers[(cycle - 1) % 2];
+      Eigen::VectorXd &next    = _cyclicBuffers[cycle % 2];
 
       // wait until W_til from previous processor is fully received
-      if (requestSend != NULL)
-        requestSend->wait();
-      if (requestRcv != NULL)
+      if (requestRcv != NULL) {
         requestRcv->wait();
+        requestRcv = NULL;
+      }
 
-      // leftMatrix (leftMatrix_rcv) is available - needed for local multiplication and hand over to next proc
-      Eigen::MatrixXd leftMatrix_copy(leftMatrix_rcv);
+      // the next buffer has been sent in the previous cycle, it can only be reused after completion
+      if (requestSend != NULL) {
+        requestSend->wait();
+        requestSend = NULL;
+      }
 
-      // initiate async send to hand over leftMatrix (W_til) to the next proc (this data will be needed in the next cycle)    dim: n_local x cols
-      if (cycle < utils::MasterSlave::_size - 1) {
-        if (leftMatrix_copy.size() > 0)
-          requestSend = _cyclicCommRight->aSend(leftMatrix_copy.data(), leftMatrix_copy.size(), 0);
+      if (cycle < size - 1) {
+        // hand over the received block to the next proc (this data will be needed in the next cycle)
+        if (rows_rcv > 0)
+          requestSend = _cyclicCommRight->aSend(current.data(), rows_rcv * q, 0);
+        // receive the block for the next cycle from the previous proc
+        if (rows_rcv_nextCycle > 0) // only receive data, if data has been sent
+          requestRcv = _cyclicCommLeft->aReceive(next.data(), rows_rcv_nextCycle * q, 0);
       }
 
-      // compute proc that owned leftMatrix_rcv (Wtil_rcv) at the very beginning for each cylce
-      int sourceProc_nextCycle = (utils::MasterSlave::_rank - (cycle + 1) < 0) ? utils::MasterSlave::_size + (utils::MasterSlave::_rank - (cycle + 1)) : utils::MasterSlave::_rank - (cycle + 1);
+      // compute block with the received data while the transfers of the next cycle proceed
+      // the row-offset of the current block is determined by the proc that sends the part of the W_til matrix
+      // note: the direction and ordering of the cyclic sending operation is chosen s.t. the computed block is
+      //       local on the current processor (in J_inv).
+      if (rows_rcv > 0) {
+        Eigen::Map<const Eigen::MatrixXd> block(current.data(), rows_rcv, q);
+        result.block(offsets[sourceProc], 0, rows_rcv, rightMatrix.cols()).noalias() = block * rightMatrix;
+      }
+    }
 
-      int sourceProc = (utils::MasterSlave::_rank - cycle < 0) ? utils::MasterSlave::_size + (utils::MasterSlave::_rank - cycle) : utils::MasterSlave::_rank - cycle;
+    if (requestSend != NULL)
+      requestSend->wait();
+  }
 
-      int rows_rcv_nextCycle = (sourceProc_nextCycle > 0) ? offsets[sourceProc_nextCycle + 1] - offsets[sourceProc_nextCycle] : offsets[1];
-      rows_rcv               = (sourceProc > 0) ? offsets[sourceProc + 1] - offsets[sourceProc] : offsets[1];
-      leftMatrix_rcv         = Eigen::MatrixXd::Zero(rows_rcv_nextCycle, q);
+  /** @brief Multiplies matrices with a quadratic result matrix by gathering the left matrix on all procs.
+   *
+   *  SUMMA-like alternative to the cyclic multiplication: As the left matrix is distributed row-wise,
+   *  the right matrix column-wise and the inner dimension (number of columns m) is small, the 2D process
+   *  grid degenerates to a single process row. Each panel of the left matrix is gathered on the master
+   *  and the assembled matrix is broadcast, such that every proc computes its result columns with a single
+   *  multiplication. This needs two collective steps instead of size-1 ring steps with small blocks.
+   */
+  template <typename Derived1, typename Derived2>
+  void _multiplyNN_broadcast(
+      Eigen::PlainObjectBase<Derived1> &leftMatrix,
+      Eigen::PlainObjectBase<Derived2> &rightMatrix,
+      Eigen::PlainObjectBase<Derived2> &result,
+      const std::vector<int> &          offsets,
+      int p, int q, int r)
+  {
+    TRACE();
+    assertion(leftMatrix.cols() == q, leftMatrix.cols(), q);
+    assertion(result.rows() == p, result.rows(), p);
 
-      // initiate asynchronous receive operation for leftMatrix (W_til) from previous processor --> W_til (this data is needed in the next cycle)
-      if (cycle < utils::MasterSlave::_size - 1) {
-        if (leftMatrix_rcv.size() > 0) // only receive data, if data has been sent
-          requestRcv = _cyclicCommLeft->aReceive(leftMatrix_rcv.data(), leftMatrix_rcv.size(), 0);
-      }
+    if (_gatheredMatrix.rows() != p || _gatheredMatrix.cols() != q)
+      _gatheredMatrix.resize(p, q);
 
-      if (requestSend != NULL)
-        requestSend->wait();
-      // compute block with new local data
-      Eigen::MatrixXd block(rows_rcv, rightMatrix.cols());
-      block.noalias() = leftMatrix_copy * rightMatrix;
+    if (utils::MasterSlave::_slaveMode) {
+      if (leftMatrix.size() > 0)
+        utils::MasterSlave::_communication->send(leftMatrix.data(), leftMatrix.size(), 0);
+    } else {
+      assertion(utils::MasterSlave::_masterMode);
+      _gatheredMatrix.topRows(offsets[1]) = leftMatrix;
 
-      // set block at corresponding index in J_inv
-      // the row-offset of the current block is determined by the proc that sends the part of the W_til matrix
-      // note: the direction and ordering of the cyclic sending operation is chosen s.t. the computed block is
-      //       local on the current processor (in J_inv).
-      off = offsets[sourceProc];
-      assertion(result.cols() == block.cols(), result.cols(), block.cols());
-      result.block(off, 0, block.rows(), block.cols()) = block;
+      int maxRows = 0;
+      for (int rankSlave = 1; rankSlave < utils::MasterSlave::_size; rankSlave++)
+        maxRows = std::max(maxRows, offsets[rankSlave + 1] - offsets[rankSlave]);
+      if (_cyclicBuffers[0].size() < maxRows * q)
+        _cyclicBuffers[0].resize(maxRows * q);
+
+      for (int rankSlave = 1; rankSlave < utils::MasterSlave::_size; rankSlave++) {
+        int rows = offsets[rankSlave + 1] - offsets[rankSlave];
+        if (rows > 0) {
+          utils::MasterSlave::_communication->receive(_cyclicBuffers[0].data(), rows * q, rankSlave);
+          _gatheredMatrix.middleRows(offsets[rankSlave], rows) = Eigen::Map<const Eigen::MatrixXd>(_cyclicBuffers[0].data(), rows, q);
+        }
+      }
     }
+
+    if (_gatheredMatrix.size() > 0)
+      utils::MasterSlave::broadcast(_gatheredMatrix.data(), _gatheredMatrix.size());
+
+    result.noalias() = _gatheredMatrix * rightMatrix;
   }
 
   // @brief multiplies matrices based on a dot-product computation with a rectangular result matrix
@@ -269,16 +341,18 @@ private:
 
     // multiply local block (saxpy-based approach)
     // dimension: (n_global x n_local) * (n_local x m) = (n_global x m)
-    Eigen::MatrixXd block = Eigen::MatrixXd::Zero(p, r);
-    block.noalias()       = leftMatrix * rightMatrix;
-
-    // all blocks have size (n_global x m)
-    // Note: if procs have no vertices, the block size remains (n_global x m), however,
-    // 	     it must be initialized with zeros, so zeros are added for those procs)
+    // Note: if procs have no vertices, the product is a zero matrix of size (n_global x m),
+    // 	     such that zeros are added for those procs
+    if (_localBlock.rows() != p || _localBlock.cols() != r)
+      _localBlock.resize(p, r);
+    _localBlock.noalias() = leftMatrix * rightMatrix;
 
-    // sum up blocks in master, reduce
-    Eigen::MatrixXd summarizedBlocks = Eigen::MatrixXd::Zero(p, r); /// @todo: only master should allocate memory.
-    utils::MasterSlave::reduceSum(block.data(), summarizedBlocks.data(), block.size());
+    // sum up blocks in master, reduce. Only the master needs memory for the sum.
+    if (utils::MasterSlave::_masterMode) {
+      if (_summedBlocks.rows() != p || _summedBlocks.cols() != r)
+        _summedBlocks.resize(p, r);
+    }
+    utils::MasterSlave::reduceSum(_localBlock.data(), _summedBlocks.data(), _localBlock.size());
 
     // slaves wait to receive their local result
     if (utils::MasterSlave::_slaveMode) {
@@ -288,17 +362,18 @@ private:
 
     // master distributes the sub blocks of the results
     if (utils::MasterSlave::_masterMode) {
-      // distribute blocks of summarizedBlocks (result of multiplication) to corresponding slaves
-      result = summarizedBlocks.block(0, 0, offsets[1], r);
+      // distribute blocks of _summedBlocks (result of multiplication) to corresponding slaves
+      result = _summedBlocks.block(0, 0, offsets[1], r);
 
       for (int rankSlave = 1; rankSlave < utils::MasterSlave::_size; rankSlave++) {
         int off       = offsets[rankSlave];
         int send_rows = offsets[rankSlave + 1] - offsets[rankSlave];
 
-        if (summarizedBlocks.block(off, 0, send_rows, r).size() > 0) {
-          // necessary to save the matrix-block that is to be sent in a temporary matrix-object
-          // otherwise, the send routine walks over the bounds of the block (matrix structure is still from the entire matrix)
-          Eigen::MatrixXd sendBlock = summarizedBlocks.block(off, 0, send_rows, r);
+        if (send_rows > 0 && r > 0) {
+          // the block has to be stored contiguously before sending, as the send routine would walk over the
+          // bounds of the block (matrix structure is still from the entire matrix). The local block is reused.
+          Eigen::Map<Eigen::MatrixXd> sendBlock(_localBlock.data(), send_rows, r);
+          sendBlock = _summedBlocks.block(off, 0, send_rows, r);
           utils::MasterSlave::_communication->send(sendBlock.data(), sendBlock.size(), rankSlave);
         }
       }
@@ -312,6 +387,19 @@ private:
   com::PtrCommunication _cyclicCommRight = nullptr;
 
   bool _needCycliclComm = true;
+
+  /// Above this number of ranks, quadratic products are computed by gathering instead of cyclic communication, off if <= 0.
+  int _maxCyclicRanks = 0;
+
+  /// Alternating receive buffers of the cyclic multiplication, reused over calls.
+  Eigen::VectorXd _cyclicBuffers[2];
+
+  /// Left matrix gathered on all procs for the broadcast-based multiplication.
+  Eigen::MatrixXd _gatheredMatrix;
+
+  /// Local contribution and sum on master for the block-wise multiplication.
+  Eigen::MatrixXd _localBlock;
+  Eigen::MatrixXd _summedBlocks;
 };
 }
 }
@@ -10,8 +10,8 @@ namespace precice
 {
 namespace io
 {
-class TXTWriter;
-class TXTReader;
+class BinaryWriter;
+class BinaryReader;
 }
 }
 
@@ -58,8 +58,9 @@ public:
    *        Information needed to measure the convergence.
    *        In case of manifold mapping it also returns the design specification
    *        for the surrogate model which is updated in every iteration.
+   *        The returned map is owned by the post processing and reused in every iteration.
    */
-  virtual ValuesMap getDesignSpecification(DataMap &cplData) = 0;
+  virtual const ValuesMap &getDesignSpecification(DataMap &cplData) = 0;
 
   /**
    * @brief Sets whether the solver has to evaluate the coarse or the fine model representation
@@ -67,9 +68,11 @@ public:
    */
   virtual void setCoarseModelOptimizationActive(bool *coarseOptimizationActive){};
 
-  virtual void exportState(io::TXTWriter &writer) {}
+  /// Exports the state of the post-processing needed for a restart, empty if there is none.
+  virtual void exportState(io::BinaryWriter &writer) {}
 
-  virtual void importState(io::TXTReader &reader) {}
+  /// Imports the state written by exportState(), called after initialize().
+  virtual void importState(io::BinaryReader &reader) {}
 
   /**
    * @brief performs one optimization step of the optimization problem
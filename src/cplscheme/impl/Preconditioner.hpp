@@ -3,6 +3,8 @@
 #include <Eigen/Core>
 #include <vector>
 #include "../SharedPointer.hpp"
+#include "io/BinaryReader.hpp"
+#include "io/BinaryWriter.hpp"
 #include "utils/assertion.hpp"
 
 namespace precice
@@ -202,6 +204,29 @@ public:
     return _freezed;
   }
 
+  /// Exports the current weights and the freezing state, needed for a restart.
+  void exportState(io::BinaryWriter &writer) const
+  {
+    writer.write(_weights);
+    writer.write(_invWeights);
+    writer.write(_nbNonConstTimesteps);
+    writer.write(_freezed);
+    writer.write(_requireNewQR);
+  }
+
+  /// Imports the weights and the freezing state written by exportState().
+  void importState(io::BinaryReader &reader)
+  {
+    std::vector<double> weights;
+    reader.read(weights);
+    assertion(weights.size() == _weights.size(), weights.size(), _weights.size());
+    _weights = std::move(weights);
+    reader.read(_invWeights);
+    reader.read(_nbNonConstTimesteps);
+    reader.read(_freezed);
+    reader.read(_requireNewQR);
+  }
+
 protected:
   /// Weights used to scale the matrix V and the residual
   std::vector<double> _weights;
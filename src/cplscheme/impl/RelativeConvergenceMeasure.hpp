@@ -4,7 +4,7 @@
 #include "ConvergenceMeasure.hpp"
 #include "logging/Logger.hpp"
 #include "math/math.hpp"
-#include "utils/MasterSlave.hpp"
+#include <cmath>
 
 namespace precice
 {
@@ -56,21 +56,38 @@ public:
     _isConvergence = false;
   }
 
-  virtual void measure(
-      const Eigen::VectorXd &oldValues,
-      const Eigen::VectorXd &newValues,
-      const Eigen::VectorXd &designSpecification)
+  virtual int getNumberOfPartialSums() const
   {
-    /*
-     std::cout<<"\n-------"<<std::endl;
-     std::cout<<"   old val: \n"<<oldValues<<std::endl;
-     std::cout<<"   new val: \n"<<newValues<<"\n"<<std::endl;
-     std::cout<<"   design spec: \n"<<designSpecification<<"\n"<<std::endl;
-     std::cout<<"-------\n"<<std::endl;
-*/
-
-    _normDiff      = utils::MasterSlave::l2norm((newValues - oldValues) - designSpecification);
-    _norm          = utils::MasterSlave::l2norm(newValues + designSpecification);
+    return 2;
+  }
+
+  virtual void computePartialSums(
+      const Eigen::Ref<const Eigen::VectorXd> &oldValues,
+      const Eigen::Ref<const Eigen::VectorXd> &newValues,
+      const Eigen::Ref<const Eigen::VectorXd> &designSpecification,
+      double *                                 sums) const
+  {
+    // Computes both norms in one pass over the values
+    bool   hasDesignSpecification = designSpecification.size() > 0;
+    double sumDiff                = 0.0;
+    double sum                    = 0.0;
+    for (int i = 0; i < newValues.size(); i++) {
+      double q     = hasDesignSpecification ? designSpecification(i) : 0.0;
+      double diff  = newValues(i) - oldValues(i) - q;
+      double value = newValues(i) + q;
+      sumDiff += diff * diff;
+      sum += value * value;
+    }
+    sums[0] = sumDiff;
+    sums[1] = sum;
+  }
+
+  using ConvergenceMeasure::measure;
+
+  virtual void measure(const double *globalSums)
+  {
+    _normDiff      = std::sqrt(globalSums[0]);
+    _norm          = std::sqrt(globalSums[1]);
     _isConvergence = _normDiff <= _norm * _convergenceLimitPercent;
     //      INFO("Relative convergence measure: "
     //                    << "two-norm differences = " << normDiff
@@ -1,10 +1,10 @@
 #pragma once
 
+#include <cmath>
 #include <limits>
 #include "../CouplingData.hpp"
 #include "ConvergenceMeasure.hpp"
 #include "logging/Logger.hpp"
-#include "utils/MasterSlave.hpp"
 
 namespace precice
 {
@@ -45,12 +45,25 @@ public:
     _normFirstResidual = std::numeric_limits<double>::max();
   }
 
-  virtual void measure(
-      const Eigen::VectorXd &oldValues,
-      const Eigen::VectorXd &newValues,
-      const Eigen::VectorXd &designSpecification)
+  virtual int getNumberOfPartialSums() const
   {
-    _normDiff = utils::MasterSlave::l2norm((newValues - oldValues) - designSpecification);
+    return 1;
+  }
+
+  virtual void computePartialSums(
+      const Eigen::Ref<const Eigen::VectorXd> &oldValues,
+      const Eigen::Ref<const Eigen::VectorXd> &newValues,
+      const Eigen::Ref<const Eigen::VectorXd> &designSpecification,
+      double *                                 sums) const
+  {
+    sums[0] = squaredResidualNorm(oldValues, newValues, designSpecification);
+  }
+
+  using ConvergenceMeasure::measure;
+
+  virtual void measure(const double *globalSums)
+  {
+    _normDiff = std::sqrt(globalSums[0]);
     if (_isFirstIteration) {
       _normFirstResidual = _normDiff;
       _isFirstIteration  = false;
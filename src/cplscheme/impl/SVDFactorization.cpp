@@ -268,6 +268,29 @@ bool SVDFactorization::isSVDinitialized()
   return _initialSVD;
 }
 
+void SVDFactorization::exportState(io::BinaryWriter &writer) const
+{
+  writer.write(_psi);
+  writer.write(_sigma);
+  writer.write(_phi);
+  writer.write(_rows);
+  writer.write(_cols);
+  writer.write(_initialSVD);
+  writer.write(_preconditionerApplied);
+}
+
+void SVDFactorization::importState(io::BinaryReader &reader)
+{
+  TRACE();
+  reader.read(_psi);
+  reader.read(_sigma);
+  reader.read(_phi);
+  reader.read(_rows);
+  reader.read(_cols);
+  reader.read(_initialSVD);
+  reader.read(_preconditionerApplied);
+}
+
 void SVDFactorization::setThreshold(double eps)
 {
   _truncationEps = eps;
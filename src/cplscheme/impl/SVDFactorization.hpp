@@ -14,6 +14,8 @@
 #include "Preconditioner.hpp"
 #include "QRFactorization.hpp"
 #include "SharedPointer.hpp"
+#include "io/BinaryReader.hpp"
+#include "io/BinaryWriter.hpp"
 #include "logging/Logger.hpp"
 
 // ------- CLASS DEFINITION
@@ -233,6 +235,12 @@ public:
 
   bool isSVDinitialized();
 
+  /// @brief: exports the truncated SVD factorization, needed for a restart
+  void exportState(io::BinaryWriter &writer) const;
+
+  /// @brief: imports the truncated SVD factorization written by exportState()
+  void importState(io::BinaryReader &reader);
+
   /// Optional file-stream for logging output
   void setfstream(std::fstream *stream);
 
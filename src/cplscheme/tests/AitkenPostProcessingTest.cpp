@@ -0,0 +1,48 @@
+#include <Eigen/Core>
+#include "../CouplingData.hpp"
+#include "../impl/AitkenPostProcessing.hpp"
+#include "../impl/PostProcessing.hpp"
+#include "mesh/Mesh.hpp"
+#include "mesh/SharedPointer.hpp"
+#include "testing/Testing.hpp"
+
+BOOST_AUTO_TEST_SUITE(CplSchemeTests)
+
+using namespace precice;
+using namespace cplscheme;
+
+BOOST_AUTO_TEST_CASE(AitkenPostProcessingTest, *testing::OnMaster())
+{
+  mesh::PtrMesh   dummyMesh(new mesh::Mesh("DummyMesh", 3, false));
+  Eigen::VectorXd valuesA(2), valuesB(1);
+  valuesA << 2.0, 4.0;
+  valuesB << 2.0;
+
+  impl::PostProcessing::DataMap dataMap;
+  dataMap.insert(std::make_pair(0, PtrCouplingData(new CouplingData(&valuesA, dummyMesh, false, 1))));
+  dataMap.insert(std::make_pair(1, PtrCouplingData(new CouplingData(&valuesB, dummyMesh, false, 1))));
+
+  impl::AitkenPostProcessing aitken(0.5, {0, 1});
+  aitken.initialize(dataMap);
+
+  // First iteration uses the initial relaxation, old values are zero
+  aitken.performPostProcessing(dataMap);
+  Eigen::VectorXd expectedA(2), expectedB(1);
+  expectedA << 1.0, 2.0;
+  expectedB << 1.0;
+  BOOST_TEST(testing::equals(valuesA, expectedA));
+  BOOST_TEST(testing::equals(valuesB, expectedB));
+
+  // Residuals (2, 4, 2) and (1, 0, 2) give the factor -0.5 * (-18 / 17) over both data
+  dataMap[0]->oldValues.col(0) = valuesA;
+  dataMap[1]->oldValues.col(0) = valuesB;
+  valuesA << 2.0, 2.0;
+  valuesB << 3.0;
+  aitken.performPostProcessing(dataMap);
+  expectedA << 26.0 / 17.0, 2.0;
+  expectedB << 35.0 / 17.0;
+  BOOST_TEST(testing::equals(valuesA, expectedA));
+  BOOST_TEST(testing::equals(valuesB, expectedB));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,329 @@
+#include <Eigen/Core>
+#include <cmath>
+#include <fstream>
+#include <memory>
+#include <vector>
+#include "../BaseCouplingScheme.hpp"
+#include "../CouplingData.hpp"
+#include "../impl/ConstantPreconditioner.hpp"
+#include "../impl/IQNILSPostProcessing.hpp"
+#include "../impl/MMPostProcessing.hpp"
+#include "../impl/MVQNPostProcessing.hpp"
+#include "../impl/PostProcessing.hpp"
+#include "../impl/ResidualSumPreconditioner.hpp"
+#include "io/BinaryReader.hpp"
+#include "io/BinaryWriter.hpp"
+#include "mesh/Data.hpp"
+#include "mesh/Mesh.hpp"
+#include "mesh/SharedPointer.hpp"
+#include "testing/Testing.hpp"
+
+BOOST_AUTO_TEST_SUITE(CplSchemeTests)
+BOOST_AUTO_TEST_SUITE(CheckpointTests)
+
+using namespace precice;
+using namespace cplscheme;
+
+namespace
+{
+using DataMap = impl::PostProcessing::DataMap;
+
+const int SIZE = 20;
+
+/// Iteration matrix of a fixed-point problem, which needs the post-processing to converge.
+Eigen::MatrixXd createIterationMatrix(double scaling)
+{
+  Eigen::MatrixXd U(SIZE, 2);
+  for (int i = 0; i < SIZE; i++) {
+    U(i, 0) = std::cos(1.0 + i) / std::sqrt(SIZE);
+    U(i, 1) = std::sin(2.0 + 3.0 * i) / std::sqrt(SIZE);
+  }
+  return -0.5 * Eigen::MatrixXd::Identity(SIZE, SIZE) + scaling * U * U.transpose();
+}
+
+Eigen::VectorXd createRightHandSide(int timestep)
+{
+  Eigen::VectorXd b(SIZE);
+  for (int i = 0; i < SIZE; i++) {
+    b(i) = std::sin(timestep + 0.5 * i);
+  }
+  return b;
+}
+
+/// Coupling data of a fixed-point problem, the values are owned by the problem.
+struct Problem {
+  explicit Problem(int numberOfData)
+      : values(numberOfData, Eigen::VectorXd::Zero(SIZE)),
+        mesh(new mesh::Mesh("DummyMesh", 3, false))
+  {
+    for (int id = 0; id < numberOfData; id++) {
+      data.insert(std::make_pair(id, PtrCouplingData(new CouplingData(&values[id], mesh, false, 1))));
+    }
+  }
+
+  std::vector<Eigen::VectorXd> values;
+  mesh::PtrMesh                mesh;
+  DataMap                      data;
+};
+
+/**
+ * @brief Solves one time step of x = G x + b(t) on all data of the problem.
+ *
+ * The input of the solver is the first column of the old values, as in the coupling schemes.
+ * Returns the values after every post-processing step.
+ */
+std::vector<Eigen::VectorXd> solveTimestep(impl::PostProcessing &pp, DataMap &data, const Eigen::MatrixXd &G, int timestep)
+{
+  std::vector<Eigen::VectorXd> results;
+  Eigen::VectorXd              b = createRightHandSide(timestep);
+  for (int iteration = 0; iteration < 30; iteration++) {
+    bool converged = true;
+    for (auto &pair : data) {
+      Eigen::VectorXd input  = pair.second->oldValues.col(0);
+      *pair.second->values   = G * input + b;
+      converged &= (*pair.second->values - input).norm() < 1e-8 * b.norm();
+    }
+    if (converged) {
+      pp.iterationsConverged(data);
+      break;
+    }
+    pp.performPostProcessing(data);
+    for (auto &pair : data) {
+      results.push_back(*pair.second->values);
+      pair.second->oldValues.col(0) = *pair.second->values;
+    }
+  }
+  return results;
+}
+
+/**
+ * @brief Solves one time step with manifold mapping, data 0 is the fine and data 1 the coarse model.
+ *
+ * Mimics the steering of the coarse model optimization by the parallel coupling scheme.
+ */
+std::vector<Eigen::VectorXd> solveTimestepMM(impl::MMPostProcessing &pp, DataMap &data, bool &coarseActive, int timestep)
+{
+  static const Eigen::MatrixXd fineModel   = createIterationMatrix(1.5);
+  static const Eigen::MatrixXd coarseModel = createIterationMatrix(1.4);
+
+  std::vector<Eigen::VectorXd> results;
+  Eigen::VectorXd              b = createRightHandSide(timestep);
+  for (int iteration = 0; iteration < 60; iteration++) {
+    for (int id : {0, 1}) {
+      const Eigen::MatrixXd &G = id == 0 ? fineModel : coarseModel;
+      *data[id]->values        = G * data[id]->oldValues.col(0) + b;
+    }
+    const auto &designSpecifications = pp.getDesignSpecification(data);
+    int         measuredID           = coarseActive ? 1 : 0;
+    double      residual             = (*data[measuredID]->values - data[measuredID]->oldValues.col(0) -
+                          designSpecifications.at(measuredID))
+                             .norm();
+    bool converged = residual < 1e-8 * b.norm() || iteration == 59;
+    if (coarseActive && converged) {
+      // only the fine model is evaluated for the new input
+      coarseActive = false;
+      continue;
+    }
+    if (converged) {
+      pp.iterationsConverged(data);
+      break;
+    }
+    pp.performPostProcessing(data);
+    for (int id : {0, 1}) {
+      results.push_back(*data[id]->values);
+      data[id]->oldValues.col(0) = *data[id]->values;
+    }
+  }
+  return results;
+}
+
+void checkEqualResults(const std::vector<Eigen::VectorXd> &expected, const std::vector<Eigen::VectorXd> &restored)
+{
+  BOOST_TEST_REQUIRE(expected.size() == restored.size());
+  BOOST_TEST(expected.size() > 0);
+  for (size_t i = 0; i < expected.size(); i++) {
+    BOOST_TEST(testing::equals(expected[i], restored[i]));
+  }
+}
+
+/// Coupling scheme solving a local fixed-point problem, without communication.
+class LocalCouplingScheme : public BaseCouplingScheme
+{
+public:
+  LocalCouplingScheme()
+      : BaseCouplingScheme(UNDEFINED_TIME, 100, 0.1, 10)
+  {
+  }
+
+  using BaseCouplingScheme::getPostProcessing;
+
+  /// Returns the only coupling data of the scheme.
+  CouplingData &getData()
+  {
+    return *getSendData().begin()->second;
+  }
+
+  virtual void initialize(double startTime, int startTimestep)
+  {
+    setTime(startTime);
+    setTimesteps(startTimestep);
+    setupDataMatrices(getSendData());
+    getPostProcessing()->initialize(getSendData());
+    setIsInitialized(true);
+  }
+
+  virtual void initializeData() {}
+
+  /// Solves the next time step, returns the values after every post-processing step.
+  std::vector<Eigen::VectorXd> solveNextTimestep(const Eigen::MatrixXd &G)
+  {
+    std::vector<Eigen::VectorXd> results = solveTimestep(*getPostProcessing(), getSendData(), G, getTimesteps());
+    setTime(getTime() + getTimestepLength());
+    setTimesteps(getTimesteps() + 1);
+    return results;
+  }
+
+  virtual void advance() {}
+};
+
+/// Creates a mesh with coupling data, which has the same ID for all meshes as in a restarted simulation.
+mesh::PtrMesh createMesh()
+{
+  mesh::Data::resetDataCount();
+  mesh::PtrMesh mesh(new mesh::Mesh("Mesh", 3, false));
+  for (int i = 0; i < SIZE; i++) {
+    mesh->createVertex(Eigen::Vector3d(i, 0.0, 0.0));
+  }
+  mesh->createData("Data", 1);
+  mesh->allocateDataValues();
+  return mesh;
+}
+
+std::unique_ptr<LocalCouplingScheme> createLocalCouplingScheme(mesh::PtrMesh mesh)
+{
+  std::unique_ptr<LocalCouplingScheme> scheme(new LocalCouplingScheme);
+  mesh::PtrData                        data = mesh->data()[0];
+  scheme->addDataToSend(data, mesh, false);
+  impl::PtrPreconditioner prec(new impl::ResidualSumPreconditioner(-1));
+  scheme->setIterationPostProcessing(impl::PtrPostProcessing(new impl::IQNILSPostProcessing(
+      0.1, false, 50, 3, impl::PostProcessing::QR1FILTER, 1e-12, {data->getID()}, prec)));
+  scheme->initialize(0.0, 1);
+  return scheme;
+}
+} // namespace
+
+BOOST_AUTO_TEST_CASE(BaseCouplingSchemeRoundTrip, *testing::OnMaster())
+{
+  Eigen::MatrixXd G = createIterationMatrix(1.5);
+
+  mesh::PtrMesh mesh   = createMesh();
+  auto          scheme = createLocalCouplingScheme(mesh);
+  for (int t = 0; t < 3; t++) {
+    scheme->solveNextTimestep(G);
+  }
+  scheme->exportState("cplscheme-CheckpointTest");
+  // without master-slave communication, rank 0 is used in the file name
+  BOOST_TEST(std::ifstream("cplscheme-CheckpointTest_cplscheme_rank0.bin").good());
+
+  // a restored scheme works on a copy of the data
+  mesh::PtrMesh restoredMesh = createMesh();
+  auto          restored     = createLocalCouplingScheme(restoredMesh);
+  restored->importState("cplscheme-CheckpointTest");
+
+  BOOST_TEST(restored->getTime() == scheme->getTime());
+  BOOST_TEST(restored->getTimesteps() == scheme->getTimesteps());
+  BOOST_TEST(testing::equals(restored->getData().oldValues, scheme->getData().oldValues));
+  *restored->getData().values = *scheme->getData().values;
+
+  for (int t = 0; t < 2; t++) {
+    std::vector<Eigen::VectorXd> expected = scheme->solveNextTimestep(G);
+    checkEqualResults(expected, restored->solveNextTimestep(G));
+  }
+}
+
+#ifndef PRECICE_NO_MPI
+
+BOOST_AUTO_TEST_CASE(MVQNRoundTrip, *testing::OnMaster())
+{
+  Eigen::MatrixXd G = createIterationMatrix(1.5);
+
+  auto createPP = []() {
+    impl::PtrPreconditioner prec(new impl::ResidualSumPreconditioner(-1));
+    return std::make_shared<impl::MVQNPostProcessing>(
+        0.1, false, 50, 3, impl::PostProcessing::QR1FILTER, 1e-12, std::vector<int>{0}, prec,
+        false, impl::MVQNPostProcessing::NO_RESTART, 0, 0, 0.0);
+  };
+
+  Problem original(1);
+  auto    pp = createPP();
+  pp->initialize(original.data);
+  for (int t = 0; t < 3; t++) {
+    solveTimestep(*pp, original.data, G, t);
+  }
+  {
+    io::BinaryWriter writer("cplscheme-CheckpointTest-MVQN.bin");
+    pp->exportState(writer);
+  }
+
+  Problem restored(1);
+  auto    restoredPP = createPP();
+  restoredPP->initialize(restored.data);
+  {
+    io::BinaryReader reader("cplscheme-CheckpointTest-MVQN.bin");
+    restoredPP->importState(reader);
+  }
+  restored.data[0]->oldValues = original.data[0]->oldValues;
+
+  for (int t = 3; t < 5; t++) {
+    std::vector<Eigen::VectorXd> expected = solveTimestep(*pp, original.data, G, t);
+    checkEqualResults(expected, solveTimestep(*restoredPP, restored.data, G, t));
+  }
+}
+
+#endif // not PRECICE_NO_MPI
+
+BOOST_AUTO_TEST_CASE(MMRoundTrip, *testing::OnMaster())
+{
+  auto createPP = []() {
+    impl::PtrPreconditioner coarsePrec(new impl::ConstantPreconditioner({1.0}));
+    impl::PtrPostProcessing coarse(new impl::IQNILSPostProcessing(
+        0.1, false, 50, 3, impl::PostProcessing::QR1FILTER, 1e-12, {1}, coarsePrec));
+    impl::PtrPreconditioner prec(new impl::ResidualSumPreconditioner(-1));
+    return std::make_shared<impl::MMPostProcessing>(
+        coarse, 50, 3, impl::PostProcessing::QR1FILTER, 1e-12, false, std::vector<int>{0}, std::vector<int>{1}, prec);
+  };
+
+  Problem original(2);
+  bool    coarseActive = true;
+  auto    pp           = createPP();
+  pp->setCoarseModelOptimizationActive(&coarseActive);
+  pp->initialize(original.data);
+  for (int t = 0; t < 3; t++) {
+    solveTimestepMM(*pp, original.data, coarseActive, t);
+  }
+  {
+    io::BinaryWriter writer("cplscheme-CheckpointTest-MM.bin");
+    pp->exportState(writer);
+  }
+
+  Problem restored(2);
+  bool    restoredCoarseActive = coarseActive;
+  auto    restoredPP           = createPP();
+  restoredPP->setCoarseModelOptimizationActive(&restoredCoarseActive);
+  restoredPP->initialize(restored.data);
+  {
+    io::BinaryReader reader("cplscheme-CheckpointTest-MM.bin");
+    restoredPP->importState(reader);
+  }
+  for (int id : {0, 1}) {
+    restored.data[id]->oldValues = original.data[id]->oldValues;
+  }
+
+  for (int t = 3; t < 5; t++) {
+    std::vector<Eigen::VectorXd> expected = solveTimestepMM(*pp, original.data, coarseActive, t);
+    checkEqualResults(expected, solveTimestepMM(*restoredPP, restored.data, restoredCoarseActive, t));
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END() // CheckpointTests
+BOOST_AUTO_TEST_SUITE_END() // CplSchemeTests
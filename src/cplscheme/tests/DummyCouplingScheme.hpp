@@ -142,11 +142,6 @@ public:
    */
   virtual void performedAction(const std::string& actionName) { assertion(false); }
 
-  /**
-   * @brief Not implemented.
-   */
-  virtual int getCheckpointTimestepInterval() const { assertion(false); return 0; }
-
   /**
    * @brief Not implemented.
    */
@@ -157,6 +152,11 @@ public:
    */
   virtual std::string printCouplingState() const { return std::string(); }
 
+  /**
+   * @brief Returns -1, no checkpoints are written.
+   */
+  virtual int getCheckpointTimestepInterval() const { return -1; }
+
   /**
    * @brief Empty.
    */
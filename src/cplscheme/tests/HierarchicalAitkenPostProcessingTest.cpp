@@ -44,6 +44,9 @@ BOOST_AUTO_TEST_CASE(HierarchicalAitkenPostProcessingTest)
   impl::HierarchicalAitkenPostProcessing hierarchAitken(initRelaxation, dataIDs);
   hierarchAitken.initialize(dataMap);
   hierarchAitken.performPostProcessing(dataMap);
+  Eigen::VectorXd expected(5);
+  expected << 6.0, 5.0, 4.0, 3.0, 2.0;
+  BOOST_TEST(testing::equals(*dataMap[dataID]->values, expected));
 
   dataMap[dataID]->oldValues.col(0) = *dataMap[dataID]->values;
   temp                              = highF;
@@ -56,7 +59,10 @@ BOOST_AUTO_TEST_CASE(HierarchicalAitkenPostProcessingTest)
   temp *= 1.5;
   *dataMap[dataID]->values -= temp;
   hierarchAitken.performPostProcessing(dataMap);
-  //TODO BOOST_TEST missing. -> https://github.com/precice/precice/issues/88
+  expected << 3.760649087221096, 2.8306288032454368, 1.9006085192697775, 0.97058823529411808, 0.040567951318458695;
+  BOOST_TEST(testing::equals(*dataMap[dataID]->values, expected));
+  expected << 6.0, 5.0, 4.0, 3.0, 2.0;
+  BOOST_TEST(testing::equals(dataMap[dataID]->oldValues.col(0), expected));
 }
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,102 @@
+#include <Eigen/Core>
+#include <algorithm>
+#include <cmath>
+#include "../CouplingData.hpp"
+#include "../impl/ConstantPreconditioner.hpp"
+#include "../impl/IQNILSPostProcessing.hpp"
+#include "../impl/PostProcessing.hpp"
+#include "mesh/Mesh.hpp"
+#include "mesh/SharedPointer.hpp"
+#include "testing/Testing.hpp"
+
+BOOST_AUTO_TEST_SUITE(CplSchemeTests)
+
+using namespace precice;
+using namespace cplscheme;
+
+namespace
+{
+/// Exposes the number of columns of the least-squares system.
+class TestIQNILSPostProcessing : public impl::IQNILSPostProcessing
+{
+public:
+  using impl::IQNILSPostProcessing::IQNILSPostProcessing;
+  using impl::BaseQNPostProcessing::getLSSystemCols;
+};
+
+struct IQNILSRun {
+  int iterations     = 0;
+  int lastIterations = 0;
+  int maxCols        = 0;
+};
+
+/// Solves the fixed-point problem x = G x + b(t) for several time steps.
+IQNILSRun runIQNILS(int timestepsReused, double historyTruncationEps)
+{
+  // Contraction plus a divergent low-rank part, which the quasi-Newton update has to capture
+  const int       n = 100;
+  Eigen::MatrixXd U(n, 4);
+  for (int i = 0; i < n; i++) {
+    for (int j = 0; j < 4; j++) {
+      U(i, j) = std::cos(1.0 + i * (j + 1)) / std::sqrt(n);
+    }
+  }
+  Eigen::MatrixXd G = -0.5 * Eigen::MatrixXd::Identity(n, n) + 3.0 * U * U.transpose();
+
+  mesh::PtrMesh   dummyMesh(new mesh::Mesh("DummyMesh", 3, false));
+  Eigen::VectorXd values = Eigen::VectorXd::Zero(n);
+  Eigen::VectorXd x      = Eigen::VectorXd::Zero(n);
+
+  impl::PostProcessing::DataMap dataMap;
+  dataMap.insert(std::make_pair(0, PtrCouplingData(new CouplingData(&values, dummyMesh, false, 1))));
+
+  impl::PtrPreconditioner      prec(new impl::ConstantPreconditioner({1.0}));
+  TestIQNILSPostProcessing pp(0.1, false, 100, timestepsReused, impl::PostProcessing::QR1FILTER,
+                              1e-12, {0}, prec, historyTruncationEps);
+  pp.initialize(dataMap);
+
+  IQNILSRun run;
+  for (int t = 0; t < 10; t++) {
+    Eigen::VectorXd b(n);
+    for (int i = 0; i < n; i++) {
+      b(i) = std::sin(t + i);
+    }
+    int iterations = 0;
+    while (true) {
+      dataMap[0]->oldValues.col(0) = x;
+      values                       = G * x + b;
+      iterations++;
+      if ((values - x).norm() < 1e-10 * b.norm()) {
+        pp.iterationsConverged(dataMap);
+        x = values;
+        break;
+      }
+      BOOST_REQUIRE(iterations < 100);
+      pp.performPostProcessing(dataMap);
+      x = values;
+    }
+    run.iterations += iterations;
+    run.lastIterations = iterations;
+    run.maxCols        = std::max(run.maxCols, pp.getLSSystemCols());
+  }
+  return run;
+}
+} // namespace
+
+BOOST_AUTO_TEST_CASE(IQNILSHistoryCompression, *testing::OnMaster())
+{
+  IQNILSRun reference = runIQNILS(1, 0.0);
+  IQNILSRun truncated = runIQNILS(1, 1e-3);
+
+  // The compressed history keeps the information of all previous time steps,
+  // but only a few columns for the low-rank part of the problem
+  BOOST_TEST(truncated.maxCols <= 8);
+  BOOST_TEST(truncated.iterations < reference.iterations);
+  BOOST_TEST(truncated.lastIterations <= 3);
+
+  // A coarse threshold bounds the number of columns further
+  IQNILSRun coarse = runIQNILS(1, 0.5);
+  BOOST_TEST(coarse.maxCols < truncated.maxCols);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,87 @@
+#ifndef PRECICE_NO_MPI
+
+#include <Eigen/Core>
+#include <chrono>
+#include "../impl/ParallelMatrixOperations.hpp"
+#include "com/MPIPortsCommunication.hpp"
+#include "testing/Fixtures.hpp"
+#include "testing/Testing.hpp"
+#include "utils/MasterSlave.hpp"
+#include "utils/Parallel.hpp"
+
+BOOST_AUTO_TEST_SUITE(CplSchemeTests)
+
+using namespace precice;
+
+/// Compares the cyclic and the gathering multiplication W_til * Z of the IMVJ post-processing.
+/**
+ * Disabled by default as it only reports timings, run it explicitly with
+ * --run_test=CplSchemeTests/ParallelMatrixOperationsBenchmark on 4 ranks.
+ */
+BOOST_AUTO_TEST_CASE(ParallelMatrixOperationsBenchmark,
+                     * testing::OnSize(4)
+                     * boost::unit_test::fixture<testing::MasterComFixture>()
+                     * boost::unit_test::disabled())
+{
+  com::PtrCommunication cyclicCommLeft  = com::PtrCommunication(new com::MPIPortsCommunication("."));
+  com::PtrCommunication cyclicCommRight = com::PtrCommunication(new com::MPIPortsCommunication("."));
+
+  int rank     = utils::Parallel::getProcessRank();
+  int size     = utils::Parallel::getCommunicatorSize();
+  int prevProc = (rank - 1 < 0) ? size - 1 : rank - 1;
+  if ((rank % 2) == 0) {
+    cyclicCommLeft->acceptConnection("cyclicComm-" + std::to_string(prevProc), "", rank);
+    cyclicCommRight->requestConnection("cyclicComm-" + std::to_string(rank), "", 0, 1);
+  } else {
+    cyclicCommRight->requestConnection("cyclicComm-" + std::to_string(rank), "", 0, 1);
+    cyclicCommLeft->acceptConnection("cyclicComm-" + std::to_string(prevProc), "", rank);
+  }
+
+  const int n_local     = 2000;
+  const int n_global    = n_local * size;
+  const int m           = 50;
+  const int repetitions = 10;
+
+  std::vector<int> offsets(size + 1);
+  for (int proc = 0; proc <= size; proc++)
+    offsets[proc] = proc * n_local;
+
+  Eigen::MatrixXd W_local = Eigen::MatrixXd::Random(n_local, m);
+  Eigen::MatrixXd Z_local = Eigen::MatrixXd::Random(m, n_local);
+  Eigen::MatrixXd J_cyclic(n_global, n_local);
+  Eigen::MatrixXd J_gathered(n_global, n_local);
+
+  cplscheme::impl::ParallelMatrixOperations parMatrixOps;
+  parMatrixOps.initialize(cyclicCommLeft, cyclicCommRight, true);
+
+  auto measure = [&](int maxCyclicRanks, Eigen::MatrixXd &result) {
+    parMatrixOps.setMaxCyclicRanks(maxCyclicRanks);
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < repetitions; i++)
+      parMatrixOps.multiply(W_local, Z_local, result, offsets, n_global, m, n_global);
+    std::chrono::duration<double, std::milli> duration = std::chrono::steady_clock::now() - start;
+    return duration.count() / repetitions;
+  };
+
+  double cyclicTime   = measure(0, J_cyclic);
+  double gatheredTime = measure(1, J_gathered);
+
+  BOOST_TEST(testing::equals(J_cyclic, J_gathered));
+  if (utils::MasterSlave::_masterMode) {
+    BOOST_TEST_MESSAGE("W_til * Z with n = " << n_global << ", m = " << m << " on " << size << " ranks");
+    BOOST_TEST_MESSAGE("  cyclic:   " << cyclicTime << " ms");
+    BOOST_TEST_MESSAGE("  gathered: " << gatheredTime << " ms");
+  }
+
+  if ((rank % 2) == 0) {
+    cyclicCommLeft->closeConnection();
+    cyclicCommRight->closeConnection();
+  } else {
+    cyclicCommRight->closeConnection();
+    cyclicCommLeft->closeConnection();
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif // PRECICE_NO_MPI
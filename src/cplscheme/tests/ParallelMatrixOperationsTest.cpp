@@ -328,6 +328,17 @@ BOOST_AUTO_TEST_CASE(ParallelMatrixMatrixOp,  * boost::unit_test::fixture<testin
   Eigen::MatrixXd matrix_cast = resJres_local2;
   validate_result_equals_reference(matrix_cast, Jres_global, vertexOffsets, true);
 
+  // 6.) multiply WZ = W * Z (n x n), parallel: (n_global x n_local), gathered instead of cyclic communication
+  parMatrixOps.setMaxCyclicRanks(1);
+  Eigen::MatrixXd resWZ_local2(n_global, n_local);
+  parMatrixOps.multiply(W_local, Z_local, resWZ_local2, vertexOffsets, n_global, m_global, n_global);
+  validate_result_equals_reference(resWZ_local2, WZ_global, vertexOffsets, false);
+
+  // 7.) repeat the cyclic multiplication to check that the reused buffers are valid
+  parMatrixOps.setMaxCyclicRanks(0);
+  parMatrixOps.multiply(W_local, Z_local, resWZ_local, vertexOffsets, n_global, m_global, n_global);
+  validate_result_equals_reference(resWZ_local, WZ_global, vertexOffsets, false);
+
   // close and shut down cyclic communication connections
   if (_cyclicCommRight != nullptr || _cyclicCommLeft != nullptr) {
     if ((utils::Parallel::getProcessRank() % 2) == 0) {
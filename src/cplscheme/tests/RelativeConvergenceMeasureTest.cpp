@@ -26,4 +26,24 @@ BOOST_AUTO_TEST_CASE(RelativeConvergenceMeasureTest)
   BOOST_TEST(measure.isConvergence());
 }
 
+BOOST_AUTO_TEST_CASE(RelativeConvergenceMeasurePartialSumsTest)
+{
+  using Eigen::VectorXd;
+  precice::cplscheme::impl::RelativeConvergenceMeasure measure(0.1);
+  BOOST_TEST(measure.getNumberOfPartialSums() == 2);
+
+  VectorXd oldValues = VectorXd::Constant(3, 2.9);
+  VectorXd newValues = VectorXd::Constant(3, 3.0);
+  VectorXd designSpec(0);
+
+  // An empty design specification is treated as zero
+  double sums[2];
+  measure.computePartialSums(oldValues, newValues, designSpec, sums);
+  BOOST_TEST(sums[0] == 3 * 0.1 * 0.1, boost::test_tools::tolerance(1e-12));
+  BOOST_TEST(sums[1] == 27.0, boost::test_tools::tolerance(1e-12));
+
+  measure.measure(sums);
+  BOOST_TEST(measure.isConvergence());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
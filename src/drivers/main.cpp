@@ -2,6 +2,7 @@
 #include "utils/Petsc.hpp"
 #include "precice/impl/SolverInterfaceImpl.hpp"
 #include "precice/config/Configuration.hpp"
+#include "io/TXTTableWriter.hpp"
 #include <iostream>
 #include "logging/Logger.hpp"
 
@@ -11,6 +12,7 @@ void printUsage()
   std::cout << "Run server (deprecated)  :  binprecice server ParticipantName ConfigurationName [LogConfFile]" << std::endl;
   std::cout << "Print XML reference      :  binprecice xml" << std::endl;
   std::cout << "Print DTD for XML config :  binprecice dtd" << std::endl;
+  std::cout << "Convert binary log       :  binprecice txt BinaryLogFile TXTLogFile" << std::endl;
 }
 
 int main ( int argc, char** argv )
@@ -18,6 +20,7 @@ int main ( int argc, char** argv )
   bool runServer = false;
   bool runHelp = false;
   bool runDtd = false;
+  bool runConvert = false;
   bool hasLogConfFile = false;
 
   bool wrongParameters = true;
@@ -32,6 +35,10 @@ int main ( int argc, char** argv )
       wrongParameters = false;
       runHelp = true;
     }
+    if ( action == "txt" and argc >= 4 ) {
+      wrongParameters = false;
+      runConvert = true;
+    }
     if ( action == "server" and argc >= 4 ) {
       wrongParameters = false;
       runServer = true;
@@ -78,6 +85,9 @@ int main ( int argc, char** argv )
     precice::config::Configuration config;
     std::cout << config.getXMLTag().printDocumentation(0) << std::endl << std::endl;
   }
+  else if (runConvert) {
+    precice::io::TXTTableWriter::convertBinaryToText(argv[2], argv[3]);
+  }
   else if (runDtd) {
 	assertion(not runServer);
     precice::config::Configuration config;
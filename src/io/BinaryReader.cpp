@@ -0,0 +1,26 @@
+#include "BinaryReader.hpp"
+
+namespace precice {
+namespace io {
+
+BinaryReader:: BinaryReader
+(
+  const std::string& filename )
+:
+  _filename(filename),
+  _file()
+{
+  _file.open(filename.c_str(), std::ios::in | std::ios::binary);
+  if (not _file){
+    ERROR("Could not open file \"" << filename << "\" for binary reading!");
+  }
+}
+
+BinaryReader:: ~BinaryReader()
+{
+  if (_file){
+    _file.close();
+  }
+}
+
+}} // namespace precice, io
@@ -0,0 +1,113 @@
+#pragma once
+
+#include "logging/Logger.hpp"
+#include <Eigen/Core>
+#include <deque>
+#include <fstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace precice {
+namespace io {
+
+/**
+ * @brief File reader for scalars, vectors and matrices written by BinaryWriter.
+ *
+ * Values have to be read in the same order as they were written. Dynamic-size
+ * matrices and containers are resized to the stored dimensions.
+ */
+class BinaryReader
+{
+public:
+
+  /// Constructor, opens file.
+  explicit BinaryReader(const std::string& filename);
+
+  /// Destructor, closes file.
+  ~BinaryReader();
+
+  /// Reads an integer from the file.
+  void read(int& value)
+  {
+    readRaw(&value, 1);
+  }
+
+  /// Reads a boolean from the file.
+  void read(bool& value)
+  {
+    int intValue = 0;
+    readRaw(&intValue, 1);
+    value = intValue != 0;
+  }
+
+  /// Reads a double from the file.
+  void read(double& value)
+  {
+    readRaw(&value, 1);
+  }
+
+  /// Reads the Eigen::Matrix from the file, resizes it if it is of dynamic size.
+  template<typename Scalar, int Rows, int Cols>
+  void read(Eigen::Matrix<Scalar, Rows, Cols>& matrix)
+  {
+    int rows = 0;
+    int cols = 0;
+    read(rows);
+    read(cols);
+    matrix.resize(rows, cols);
+    readRaw(matrix.data(), matrix.size());
+  }
+
+  /// Reads the vector of scalars from the file and resizes it.
+  template<typename T>
+  void read(std::vector<T>& values)
+  {
+    static_assert(std::is_arithmetic<T>::value, "Only vectors of scalars can be read raw.");
+    int size = 0;
+    read(size);
+    values.resize(size);
+    readRaw(values.data(), values.size());
+  }
+
+  /// Reads the matrices from the file and resizes them.
+  void read(std::vector<Eigen::MatrixXd>& matrices)
+  {
+    int size = 0;
+    read(size);
+    matrices.resize(size);
+    for (Eigen::MatrixXd& matrix : matrices) {
+      read(matrix);
+    }
+  }
+
+  /// Reads the deque from the file and resizes it.
+  void read(std::deque<int>& values)
+  {
+    int size = 0;
+    read(size);
+    values.resize(size);
+    for (int& value : values) {
+      read(value);
+    }
+  }
+
+private:
+
+  logging::Logger _log{"io::BinaryReader"};
+
+  /// Name of the file, for error messages.
+  std::string _filename;
+
+  /// @brief Filestream.
+  std::ifstream _file;
+
+  template<typename T>
+  void readRaw(T* data, size_t size)
+  {
+    _file.read(reinterpret_cast<char*>(data), sizeof(T) * size);
+    CHECK(_file, "Unexpected end of file \"" << _filename << "\" in binary reading!");
+  }
+};
+
+}} // namespace precice, io
@@ -0,0 +1,25 @@
+#include "BinaryWriter.hpp"
+
+namespace precice {
+namespace io {
+
+BinaryWriter:: BinaryWriter
+(
+  const std::string& filename )
+:
+  _file()
+{
+  _file.open(filename.c_str(), std::ios::out | std::ios::binary);
+  if (not _file){
+    ERROR("Could not open file \"" << filename << "\" for binary writing!");
+  }
+}
+
+BinaryWriter:: ~BinaryWriter()
+{
+  if (_file){
+    _file.close();
+  }
+}
+
+}} // namespace precice, io
@@ -0,0 +1,99 @@
+#pragma once
+
+#include "logging/Logger.hpp"
+#include <Eigen/Core>
+#include <deque>
+#include <fstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace precice {
+namespace io {
+
+/**
+ * @brief File writer for scalars, vectors and matrices in raw binary format.
+ *
+ * Matrices and containers are written with their dimensions in front, such that
+ * BinaryReader can restore them without knowing their sizes. The format is not
+ * portable between platforms, it is meant for checkpoints of a running setup.
+ */
+class BinaryWriter
+{
+public:
+
+  /// Constructor, opens file.
+  explicit BinaryWriter(const std::string& filename);
+
+  /// Destructor, closes file.
+  ~BinaryWriter();
+
+  /// Writes (appends) an integer to the file.
+  void write(int value)
+  {
+    writeRaw(&value, 1);
+  }
+
+  /// Writes (appends) a boolean to the file.
+  void write(bool value)
+  {
+    int intValue = value ? 1 : 0;
+    writeRaw(&intValue, 1);
+  }
+
+  /// Writes (appends) a double to the file.
+  void write(double value)
+  {
+    writeRaw(&value, 1);
+  }
+
+  /// Writes (appends) the matrix and its dimensions to the file.
+  template<typename Scalar, int Rows, int Cols>
+  void write(const Eigen::Matrix<Scalar, Rows, Cols>& matrix)
+  {
+    write(static_cast<int>(matrix.rows()));
+    write(static_cast<int>(matrix.cols()));
+    writeRaw(matrix.data(), matrix.size());
+  }
+
+  /// Writes (appends) the vector of scalars and its size to the file.
+  template<typename T>
+  void write(const std::vector<T>& values)
+  {
+    static_assert(std::is_arithmetic<T>::value, "Only vectors of scalars can be written raw.");
+    write(static_cast<int>(values.size()));
+    writeRaw(values.data(), values.size());
+  }
+
+  /// Writes (appends) the matrices and their number to the file.
+  void write(const std::vector<Eigen::MatrixXd>& matrices)
+  {
+    write(static_cast<int>(matrices.size()));
+    for (const Eigen::MatrixXd& matrix : matrices) {
+      write(matrix);
+    }
+  }
+
+  /// Writes (appends) the deque and its size to the file.
+  void write(const std::deque<int>& values)
+  {
+    write(static_cast<int>(values.size()));
+    for (int value : values) {
+      write(value);
+    }
+  }
+
+private:
+  logging::Logger _log{"io::BinaryWriter"};
+
+  /// @brief Filestream.
+  std::ofstream _file;
+
+  template<typename T>
+  void writeRaw(const T* data, size_t size)
+  {
+    _file.write(reinterpret_cast<const char*>(data), sizeof(T) * size);
+  }
+};
+
+}} // namespace precice, io
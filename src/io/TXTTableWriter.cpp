@@ -1,20 +1,135 @@
 #include "TXTTableWriter.hpp"
 #include "utils/Helpers.hpp"
 #include "utils/assertion.hpp"
+#include <condition_variable>
+#include <deque>
+#include <functional>
 #include <iomanip>
+#include <mutex>
+#include <thread>
 
 namespace precice {
 namespace io {
 
+namespace {
+/// Identifies files written in the binary table format.
+const char BINARY_TABLE_MAGIC[8] = {'P','R','E','C','T','B','L','1'};
+}
+
+/**
+ * Runs the write tasks of all table writers in order of submission. The thread is started
+ * on first use and stopped when the last writer releases the instance.
+ */
+class TXTTableWriter::BackgroundWriter
+{
+public:
+
+  BackgroundWriter ()
+  :
+    _thread ( &BackgroundWriter::run, this )
+  {}
+
+  /// Runs all posted tasks before stopping the thread.
+  ~BackgroundWriter ()
+  {
+    {
+      std::lock_guard<std::mutex> lock ( _mutex );
+      _stop = true;
+    }
+    _changed.notify_all ();
+    _thread.join ();
+  }
+
+  static std::shared_ptr<BackgroundWriter> getInstance ()
+  {
+    static std::weak_ptr<BackgroundWriter> instance;
+    static std::mutex instanceMutex;
+    std::lock_guard<std::mutex> lock ( instanceMutex );
+    std::shared_ptr<BackgroundWriter> writer = instance.lock ();
+    if ( not writer ) {
+      writer = std::make_shared<BackgroundWriter> ();
+      instance = writer;
+    }
+    return writer;
+  }
+
+  /// Posts a task and returns its ticket, see wait().
+  unsigned long long post ( std::function<void()> task )
+  {
+    unsigned long long ticket;
+    {
+      std::lock_guard<std::mutex> lock ( _mutex );
+      _tasks.push_back ( std::move(task) );
+      ticket = ++_posted;
+    }
+    _changed.notify_all ();
+    return ticket;
+  }
+
+  /// Blocks until the task with the given ticket and all tasks posted before have been run.
+  void wait ( unsigned long long ticket )
+  {
+    std::unique_lock<std::mutex> lock ( _mutex );
+    _changed.wait ( lock, [this, ticket] { return _done >= ticket; } );
+  }
+
+private:
+
+  std::deque<std::function<void()>> _tasks;
+
+  unsigned long long _posted = 0;
+
+  unsigned long long _done = 0;
+
+  bool _stop = false;
+
+  std::mutex _mutex;
+
+  std::condition_variable _changed;
+
+  // Declared last, such that all other members are initialized when the thread starts
+  std::thread _thread;
+
+  void run ()
+  {
+    std::unique_lock<std::mutex> lock ( _mutex );
+    while ( true ) {
+      _changed.wait ( lock, [this] { return _stop || not _tasks.empty(); } );
+      if ( _tasks.empty() ) {
+        return;
+      }
+      std::function<void()> task = std::move ( _tasks.front() );
+      _tasks.pop_front ();
+      lock.unlock ();
+      task ();
+      lock.lock ();
+      _done ++;
+      _changed.notify_all ();
+    }
+  }
+};
+
+logging::Logger TXTTableWriter:: _log("io::TXTTableWriter");
+
 TXTTableWriter:: TXTTableWriter
 (
-  const std::string& filename )
+  const std::string& filename,
+  Format             format,
+  int                flushInterval )
 :
   _data (),
   _writeIterator ( _data.end() ),
-  _outputStream ()
+  _outputStream (),
+  _format ( format ),
+  _flushInterval ( flushInterval )
 {
-  _outputStream.open ( filename.c_str() );
+  assertion ( flushInterval > 0, flushInterval );
+  if ( format == BINARY ) {
+    _outputStream.open ( filename.c_str(), std::ios::out | std::ios::binary );
+  }
+  else {
+    _outputStream.open ( filename.c_str() );
+  }
   if ( not _outputStream ) {
     ERROR("Could not open file \"" << filename
                    << "\" for writing txt table data!" );
@@ -27,7 +142,7 @@ TXTTableWriter:: TXTTableWriter
 TXTTableWriter:: ~TXTTableWriter ()
 {
   if ( _outputStream.is_open() ) {
-    _outputStream.close ();
+    close ();
   }
 }
 
@@ -40,20 +155,24 @@ void TXTTableWriter:: addData
   data.name = name;
   data.type = type;
   assertion ( not utils::contained(data, _data), data.name, data.type );
+  assertion ( not _headerWritten, data.name );
   _data.push_back ( data );
   assertion ( _outputStream.is_open() );
   if ( (type == INT) || (type == DOUBLE) ) {
-    _outputStream << name << "  ";
+    _columnNames.push_back ( name );
+    _columnIsInt.push_back ( type == INT ? 1 : 0 );
   }
   else if ( type == VECTOR2D ){
     for ( int i=0; i < 2; i++ ) {
-      _outputStream << name << i << "  ";
+      _columnNames.push_back ( name + std::to_string(i) );
+      _columnIsInt.push_back ( 0 );
     }
   }
   else {
     assertion ( type == VECTOR3D );
     for ( int i=0; i < 3; i++ ) {
-      _outputStream << name << i << "  ";
+      _columnNames.push_back ( name + std::to_string(i) );
+      _columnIsInt.push_back ( 0 );
     }
   }
   _writeIterator = _data.end();
@@ -64,17 +183,10 @@ void TXTTableWriter:: writeData
   const std::string& name,
   int                value )
 {
-  assertion ( not _data.empty() );
-  if ( _writeIterator == _data.end() ) {
-    _writeIterator = _data.begin();
-    _outputStream << "\n";
-  }
-  assertion ( _writeIterator->name == name, _writeIterator->name, name );
-  assertion ( _writeIterator->type == INT, _writeIterator->type );
-  _outputStream << value << "  ";
+  appendValue ( name, INT, static_cast<double>(value) );
   _writeIterator ++;
   if ( _writeIterator == _data.end() ) {
-    _outputStream.flush ();
+    flushRows ();
   }
 }
 
@@ -83,17 +195,10 @@ void TXTTableWriter:: writeData
   const std::string& name,
   double             value )
 {
-  assertion ( not _data.empty() );
-  if ( _writeIterator == _data.end() ) {
-    _writeIterator = _data.begin();
-    _outputStream << "\n";
-  }
-  assertion ( _writeIterator->name == name, _writeIterator->name, name );
-  assertion ( _writeIterator->type == DOUBLE, _writeIterator->type );
-  _outputStream << value << "  ";
+  appendValue ( name, DOUBLE, value );
   _writeIterator ++;
   if ( _writeIterator == _data.end() ) {
-    _outputStream.flush ();
+    flushRows ();
   }
 }
 
@@ -102,19 +207,11 @@ void TXTTableWriter:: writeData
   const std::string&     name,
   const Eigen::Vector2d& value )
 {
-  assertion ( not _data.empty() );
-  if ( _writeIterator == _data.end() ) {
-    _writeIterator = _data.begin();
-    _outputStream << "\n";
-  }
-  assertion ( _writeIterator->name == name, _writeIterator->name, name );
-  assertion ( _writeIterator->type == VECTOR2D, _writeIterator->type );
-  for ( int i=0; i < value.size(); i++ ) {
-    _outputStream << value[i] << "  ";
-  }
+  appendValue ( name, VECTOR2D, value[0] );
+  _rows.push_back ( value[1] );
   _writeIterator ++;
   if ( _writeIterator == _data.end() ) {
-    _outputStream.flush ();
+    flushRows ();
   }
 }
 
@@ -122,27 +219,180 @@ void TXTTableWriter:: writeData
 (
   const std::string&     name,
   const Eigen::Vector3d& value )
+{
+  appendValue ( name, VECTOR3D, value[0] );
+  _rows.push_back ( value[1] );
+  _rows.push_back ( value[2] );
+  _writeIterator ++;
+  if ( _writeIterator == _data.end() ) {
+    flushRows ();
+  }
+}
+
+void TXTTableWriter:: close ()
+{
+  assertion ( _outputStream.is_open() );
+  assertion ( _writeIterator == _data.end() || _writeIterator == _data.begin(),
+              "Closing table writer in the middle of a row" );
+  if ( not _headerWritten ) {
+    writeHeader ();
+  }
+  if ( not _rows.empty() ) {
+    _bufferedRows = _flushInterval;
+    flushRows ();
+  }
+  if ( _backgroundWriter ) {
+    _backgroundWriter->wait ( _lastTicket );
+    _backgroundWriter.reset ();
+  }
+  _outputStream.close ();
+}
+
+void TXTTableWriter:: convertBinaryToText
+(
+  const std::string& binaryFilename,
+  const std::string& textFilename )
+{
+  std::ifstream inputStream ( binaryFilename.c_str(), std::ios::in | std::ios::binary );
+  CHECK ( inputStream, "Could not open file \"" << binaryFilename
+          << "\" for reading binary table data!" );
+
+  char magic[sizeof(BINARY_TABLE_MAGIC)];
+  inputStream.read ( magic, sizeof(magic) );
+  CHECK ( inputStream && std::equal(magic, magic + sizeof(magic), BINARY_TABLE_MAGIC),
+          "File \"" << binaryFilename << "\" does not contain binary table data!" );
+
+  int columns = 0;
+  inputStream.read ( reinterpret_cast<char*>(&columns), sizeof(columns) );
+  CHECK ( inputStream && columns > 0,
+          "Invalid number of columns in binary table \"" << binaryFilename << "\"!" );
+
+  std::vector<std::string> names ( columns );
+  std::vector<int> isInt ( columns );
+  for ( int i=0; i < columns; i++ ) {
+    int length = 0;
+    inputStream.read ( reinterpret_cast<char*>(&isInt[i]), sizeof(int) );
+    inputStream.read ( reinterpret_cast<char*>(&length), sizeof(int) );
+    CHECK ( inputStream && length >= 0,
+            "Invalid column header in binary table \"" << binaryFilename << "\"!" );
+    names[i].resize ( length );
+    inputStream.read ( &names[i][0], length );
+  }
+  CHECK ( inputStream, "Invalid column header in binary table \"" << binaryFilename << "\"!" );
+
+  std::ofstream outputStream ( textFilename.c_str() );
+  CHECK ( outputStream, "Could not open file \"" << textFilename
+          << "\" for writing txt table data!" );
+  outputStream.setf ( std::ios::showpoint );
+  outputStream.setf ( std::ios::fixed );
+  outputStream << std::setprecision(16);
+  for ( const std::string& name : names ) {
+    outputStream << name << "  ";
+  }
+
+  std::vector<double> row ( columns );
+  while ( inputStream.read(reinterpret_cast<char*>(row.data()), columns * sizeof(double)) ) {
+    outputStream << "\n";
+    for ( int i=0; i < columns; i++ ) {
+      if ( isInt[i] ) {
+        outputStream << static_cast<int>(row[i]) << "  ";
+      }
+      else {
+        outputStream << row[i] << "  ";
+      }
+    }
+  }
+  CHECK ( inputStream.gcount() == 0,
+          "Binary table \"" << binaryFilename << "\" ends with an incomplete row!" );
+}
+
+void TXTTableWriter:: appendValue
+(
+  const std::string& name,
+  DataType           type,
+  double             value )
 {
   assertion ( not _data.empty() );
   if ( _writeIterator == _data.end() ) {
     _writeIterator = _data.begin();
-    _outputStream << "\n";
   }
   assertion ( _writeIterator->name == name, _writeIterator->name, name );
-  assertion ( _writeIterator->type == VECTOR3D, _writeIterator->type );
-  for ( int i=0; i < value.size(); i++ ) {
-    _outputStream << value[i] << "  ";
+  assertion ( _writeIterator->type == type, _writeIterator->type );
+  _rows.push_back ( value );
+}
+
+void TXTTableWriter:: flushRows ()
+{
+  _bufferedRows ++;
+  if ( _bufferedRows < _flushInterval ) {
+    return;
   }
-  _writeIterator ++;
-  if ( _writeIterator == _data.end() ) {
-    _outputStream.flush ();
+  _bufferedRows = 0;
+
+  if ( not _headerWritten ) {
+    writeHeader ();
   }
+  if ( _flushInterval == 1 ) {
+    // A single row is not worth the hand-over
+    writeRows ( _rows );
+    _rows.clear ();
+    return;
+  }
+  if ( not _backgroundWriter ) {
+    // The stream is only accessed by the background writer from now on
+    _backgroundWriter = BackgroundWriter::getInstance ();
+  }
+  auto rows = std::make_shared<std::vector<double>> ();
+  rows->swap ( _rows );
+  _lastTicket = _backgroundWriter->post ( [this, rows] { writeRows(*rows); } );
 }
 
-void TXTTableWriter:: close ()
+void TXTTableWriter:: writeHeader ()
 {
-  assertion ( _outputStream.is_open() );
-  _outputStream.close ();
+  assertion ( not _backgroundWriter );
+  if ( _format == BINARY ) {
+    int columns = static_cast<int>(_columnNames.size());
+    _outputStream.write ( BINARY_TABLE_MAGIC, sizeof(BINARY_TABLE_MAGIC) );
+    _outputStream.write ( reinterpret_cast<const char*>(&columns), sizeof(columns) );
+    for ( int i=0; i < columns; i++ ) {
+      int length = static_cast<int>(_columnNames[i].size());
+      _outputStream.write ( reinterpret_cast<const char*>(&_columnIsInt[i]), sizeof(int) );
+      _outputStream.write ( reinterpret_cast<const char*>(&length), sizeof(length) );
+      _outputStream.write ( _columnNames[i].data(), length );
+    }
+  }
+  else {
+    for ( const std::string& name : _columnNames ) {
+      _outputStream << name << "  ";
+    }
+  }
+  _outputStream.flush ();
+  _headerWritten = true;
+}
+
+void TXTTableWriter:: writeRows
+(
+  const std::vector<double>& rows )
+{
+  size_t columns = _columnNames.size();
+  assertion ( rows.size() % columns == 0, rows.size(), columns );
+  if ( _format == BINARY ) {
+    _outputStream.write ( reinterpret_cast<const char*>(rows.data()), rows.size() * sizeof(double) );
+  }
+  else {
+    for ( size_t i=0; i < rows.size(); i++ ) {
+      if ( i % columns == 0 ) {
+        _outputStream << "\n";
+      }
+      if ( _columnIsInt[i % columns] ) {
+        _outputStream << static_cast<int>(rows[i]) << "  ";
+      }
+      else {
+        _outputStream << rows[i] << "  ";
+      }
+    }
+  }
+  _outputStream.flush ();
 }
 
 }} // namespace precice, io
@@ -3,6 +3,7 @@
 #include <string>
 #include <vector>
 #include <fstream>
+#include <memory>
 #include <Eigen/Core>
 #include "logging/Logger.hpp"
 
@@ -15,6 +16,12 @@ namespace io {
  * Usage:
  * Create the writer, add data entries in the wanted sequence, and write data
  * values cyclically in the same sequence.
+ *
+ * With a flushInterval larger than one, completed rows are buffered and handed over every
+ * flushInterval rows to a background thread, which formats and writes them to the file.
+ * The thread is shared by all writers of the process. Otherwise, every row is written
+ * directly. In BINARY format, the rows are written unformatted with a fixed layout and
+ * can be converted to the text format by convertBinaryToText().
  */
 class TXTTableWriter
 {
@@ -28,8 +35,23 @@ public:
     VECTOR3D
   };
 
-  /// Constructor, opens file.
-  explicit TXTTableWriter ( const std::string& filename );
+  /// Constants defining possible file formats.
+  enum Format {
+    TEXT,
+    BINARY
+  };
+
+  /**
+   * @brief Constructor, opens file.
+   *
+   * @param[in] filename Name of the file to be written.
+   * @param[in] format Text or fixed-layout binary format.
+   * @param[in] flushInterval Number of completed rows buffered before they are written.
+   */
+  explicit TXTTableWriter (
+    const std::string& filename,
+    Format             format = TEXT,
+    int                flushInterval = 1 );
 
   /// Destructor, closes file, if not done yet.
   ~TXTTableWriter();
@@ -76,9 +98,18 @@ public:
     const std::string&     name,
     const Eigen::Vector3d& value );
 
-  /// Closes the file, is automatically called on destruction.
+  /// Writes all buffered rows and closes the file, is automatically called on destruction.
   void close();
 
+  /**
+   * @brief Converts a table written in BINARY format to the TEXT format.
+   *
+   * The resulting text file is identical to the one written directly in TEXT format.
+   */
+  static void convertBinaryToText (
+    const std::string& binaryFilename,
+    const std::string& textFilename );
+
 private:
 
   /// Represents one data entry to be written.
@@ -93,13 +124,49 @@ private:
     }
   };
 
-  logging::Logger _log{"io::TXTTableWriter"};
+  /// Process-wide thread writing the rows handed over by all writers.
+  class BackgroundWriter;
+
+  static logging::Logger _log;
 
   std::vector<Data> _data;
 
   std::vector<Data>::const_iterator _writeIterator;
 
   std::ofstream _outputStream;
+
+  Format _format;
+
+  int _flushInterval;
+
+  /// Names and integer flags of all columns, vector entries count as several columns.
+  std::vector<std::string> _columnNames;
+  std::vector<int> _columnIsInt;
+
+  /// Completed rows and the current row, not yet written or handed over.
+  std::vector<double> _rows;
+
+  int _bufferedRows = 0;
+
+  bool _headerWritten = false;
+
+  /// Shared background writer, only used if rows are buffered.
+  std::shared_ptr<BackgroundWriter> _backgroundWriter;
+
+  /// Ticket of the last rows handed over to the background writer.
+  unsigned long long _lastTicket = 0;
+
+  /// Appends a value to the current row, starts a new row if required.
+  void appendValue ( const std::string& name, DataType type, double value );
+
+  /// Writes the buffered rows or hands them over to the background writer.
+  void flushRows();
+
+  /// Writes the header of the table, called before any rows are handed over.
+  void writeHeader();
+
+  /// Writes rows of values to the stream in the configured format.
+  void writeRows ( const std::vector<double>& rows );
 };
 
 }} // namespace precice, io
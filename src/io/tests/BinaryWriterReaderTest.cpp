@@ -0,0 +1,61 @@
+#include "io/BinaryReader.hpp"
+#include "io/BinaryWriter.hpp"
+#include "testing/Testing.hpp"
+
+BOOST_AUTO_TEST_SUITE(IOTests)
+
+using namespace precice;
+using namespace precice::io;
+
+BOOST_AUTO_TEST_CASE(BinaryWriterReaderTest, * testing::OnMaster())
+{
+  Eigen::MatrixXd matOutput(2, 3);
+  matOutput << 1.5, 2, 3, 4, 5, 6.25;
+  Eigen::Vector3d    vecOutput(1, 2, 3);
+  Eigen::VectorXd    emptyOutput;
+  std::vector<double> weightsOutput = {0.5, 2.0};
+  std::deque<int>    colsOutput    = {3, 1, 4};
+  {
+    BinaryWriter writer("io-BinaryWriterReaderTest.bin");
+    writer.write(42);
+    writer.write(true);
+    writer.write(0.1);
+    writer.write(matOutput);
+    writer.write(vecOutput);
+    writer.write(emptyOutput);
+    writer.write(weightsOutput);
+    writer.write(colsOutput);
+  }
+
+  int                 intInput = 0;
+  bool                boolInput = false;
+  double              doubleInput = 0.0;
+  Eigen::MatrixXd     matInput;
+  Eigen::Vector3d     vecInput;
+  Eigen::VectorXd     emptyInput = Eigen::VectorXd::Zero(2);
+  std::vector<double> weightsInput;
+  std::deque<int>     colsInput;
+
+  BinaryReader reader("io-BinaryWriterReaderTest.bin");
+  reader.read(intInput);
+  reader.read(boolInput);
+  reader.read(doubleInput);
+  reader.read(matInput);
+  reader.read(vecInput);
+  reader.read(emptyInput);
+  reader.read(weightsInput);
+  reader.read(colsInput);
+
+  BOOST_TEST(intInput == 42);
+  BOOST_TEST(boolInput);
+  BOOST_TEST(doubleInput == 0.1);
+  BOOST_TEST(matInput.rows() == 2);
+  BOOST_TEST(matInput.cols() == 3);
+  BOOST_TEST(testing::equals(matOutput, matInput));
+  BOOST_TEST(testing::equals(vecOutput, vecInput));
+  BOOST_TEST(emptyInput.size() == 0);
+  BOOST_TEST(weightsInput == weightsOutput);
+  BOOST_TEST(colsInput == colsOutput);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -1,3 +1,8 @@
+#include <algorithm>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <vector>
 #include "io/TXTTableWriter.hpp"
 #include "testing/Testing.hpp"
 
@@ -25,4 +30,71 @@ BOOST_AUTO_TEST_CASE(TXTTableWriterTest, * precice::testing::OnMaster())
   writer.close();
 }
 
+BOOST_AUTO_TEST_CASE(TXTTableWriterBinaryTest, * precice::testing::OnMaster())
+{
+  auto writeTable = [](TXTTableWriter& writer) {
+    writer.addData("Timestep", TXTTableWriter::INT);
+    writer.addData("Flowrate", TXTTableWriter::DOUBLE);
+    writer.addData("Force3D", TXTTableWriter::VECTOR3D);
+    for (int t = 0; t < 10; t++) {
+      writer.writeData("Timestep", t);
+      writer.writeData("Flowrate", 0.1 * (double) t);
+      writer.writeData("Force3D", Eigen::Vector3d(1.0 * t, 2.0 * t, 3.0 * t));
+    }
+    writer.close();
+  };
+  auto readFile = [](const std::string& filename) {
+    std::ifstream file(filename);
+    std::stringstream content;
+    content << file.rdbuf();
+    return content.str();
+  };
+
+  // flush interval does not divide the number of rows, the last rows are written on close
+  TXTTableWriter textWriter("io-TXTTableWriterBinaryTest.log", TXTTableWriter::TEXT, 4);
+  writeTable(textWriter);
+  TXTTableWriter binaryWriter("io-TXTTableWriterBinaryTest.bin", TXTTableWriter::BINARY, 4);
+  writeTable(binaryWriter);
+  TXTTableWriter::convertBinaryToText("io-TXTTableWriterBinaryTest.bin", "io-TXTTableWriterBinaryTest-converted.log");
+
+  std::string text = readFile("io-TXTTableWriterBinaryTest.log");
+  BOOST_TEST(text.substr(0, 10) == "Timestep  ");
+  BOOST_TEST(std::count(text.begin(), text.end(), '\n') == 10);
+  BOOST_TEST(readFile("io-TXTTableWriterBinaryTest-converted.log") == text);
+}
+
+BOOST_AUTO_TEST_CASE(TXTTableWriterSharedThreadTest, * precice::testing::OnMaster())
+{
+  auto readFile = [](const std::string& filename) {
+    std::ifstream file(filename);
+    std::stringstream content;
+    content << file.rdbuf();
+    return content.str();
+  };
+
+  // buffered writers share the background thread, the direct writer writes every row itself
+  std::vector<std::unique_ptr<TXTTableWriter>> writers;
+  writers.emplace_back(new TXTTableWriter("io-TXTTableWriterSharedThreadTest-0.log", TXTTableWriter::TEXT, 1));
+  writers.emplace_back(new TXTTableWriter("io-TXTTableWriterSharedThreadTest-1.log", TXTTableWriter::TEXT, 3));
+  writers.emplace_back(new TXTTableWriter("io-TXTTableWriterSharedThreadTest-2.log", TXTTableWriter::TEXT, 5));
+  for (auto& writer : writers) {
+    writer->addData("Timestep", TXTTableWriter::INT);
+    writer->addData("Flowrate", TXTTableWriter::DOUBLE);
+  }
+  for (int t = 0; t < 20; t++) {
+    for (auto& writer : writers) {
+      writer->writeData("Timestep", t);
+      writer->writeData("Flowrate", 0.1 * (double) t);
+    }
+  }
+  for (auto& writer : writers) {
+    writer->close();
+  }
+
+  std::string text = readFile("io-TXTTableWriterSharedThreadTest-0.log");
+  BOOST_TEST(std::count(text.begin(), text.end(), '\n') == 20);
+  BOOST_TEST(readFile("io-TXTTableWriterSharedThreadTest-1.log") == text);
+  BOOST_TEST(readFile("io-TXTTableWriterSharedThreadTest-2.log") == text);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // IOTests
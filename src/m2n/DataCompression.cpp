@@ -0,0 +1,145 @@
+#include "DataCompression.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include "utils/assertion.hpp"
+
+namespace precice
+{
+namespace m2n
+{
+namespace
+{
+/// Modes of a message, stored in the lowest byte of the header. The other bytes hold the number of values.
+const uint64_t MODE_RAW   = 0;
+const uint64_t MODE_DELTA = 1;
+
+uint64_t toBits(double value)
+{
+  uint64_t bits;
+  std::memcpy(&bits, &value, sizeof(double));
+  return bits;
+}
+
+double toDouble(uint64_t bits)
+{
+  double value;
+  std::memcpy(&value, &bits, sizeof(double));
+  return value;
+}
+
+/// Returns the number of bytes without the leading zero bytes.
+int significantBytes(uint64_t bits)
+{
+  return bits == 0 ? 0 : 8 - __builtin_clzll(bits) / 8;
+}
+} // namespace
+
+DataCompression::DataCompression(double tolerance)
+    : _tolerance(tolerance)
+{
+  assertion(tolerance >= 0.0, tolerance);
+}
+
+void DataCompression::encode(Key key, const double *values, size_t size, std::vector<double> &message)
+{
+  TRACE(key.first, key.second, size);
+
+  std::vector<double> &reference = _sentValues[key];
+  if (reference.size() != size) {
+    reference.assign(size, 0.0);
+  }
+
+  double threshold = 0.0;
+  if (_tolerance > 0.0) {
+    for (size_t i = 0; i < size; i++) {
+      threshold = std::max(threshold, std::abs(values[i]));
+    }
+    threshold *= _tolerance;
+  }
+
+  // Header, one 4-bit control code per value, significant bytes of all values
+  const size_t rawBytes     = size * sizeof(double);
+  const size_t controlBytes = (size + 1) / 2;
+  message.assign(1 + (controlBytes + rawBytes + sizeof(double) - 1) / sizeof(double), 0.0);
+  auto   control   = reinterpret_cast<unsigned char *>(message.data() + 1);
+  auto   bytes     = control + controlBytes;
+  size_t byteCount = controlBytes;
+
+  bool isSmaller = true;
+  for (size_t i = 0; i < size; i++) {
+    uint64_t delta = 0;
+    if (threshold == 0.0 or not(std::abs(values[i] - reference[i]) <= threshold)) {
+      delta = toBits(values[i]) ^ toBits(reference[i]);
+    }
+    int count = significantBytes(delta);
+    byteCount += count;
+    if (byteCount >= rawBytes) {
+      isSmaller = false;
+      break;
+    }
+    control[i / 2] |= count << (4 * (i % 2));
+    for (int b = 0; b < count; b++) {
+      *bytes++ = (delta >> (8 * b)) & 0xff;
+    }
+  }
+
+  if (isSmaller) {
+    message.resize(1 + (byteCount + sizeof(double) - 1) / sizeof(double));
+    message[0] = toDouble(MODE_DELTA | (size << 8));
+    // Unchanged values keep the previous value, just like on the receiving side
+    for (size_t i = 0; i < size; i++) {
+      if ((control[i / 2] >> (4 * (i % 2))) & 0xf) {
+        reference[i] = values[i];
+      }
+    }
+  } else {
+    message.resize(1 + size);
+    message[0] = toDouble(MODE_RAW | (size << 8));
+    std::copy(values, values + size, message.begin() + 1);
+    reference.assign(values, values + size);
+  }
+  DEBUG("Encoded " << size << " values into " << message.size() - 1 << " words");
+}
+
+void DataCompression::decode(Key key, std::vector<double> const &message, double *values, size_t size)
+{
+  TRACE(key.first, key.second, size);
+  CHECK(not message.empty(), "Received an empty compressed message");
+
+  uint64_t header = toBits(message[0]);
+  uint64_t mode   = header & 0xff;
+  CHECK(header >> 8 == size, "Received a compressed message with " << (header >> 8)
+                                                                   << " values, but expected " << size << " values");
+
+  std::vector<double> &reference = _receivedValues[key];
+  if (reference.size() != size) {
+    reference.assign(size, 0.0);
+  }
+
+  if (mode == MODE_RAW) {
+    assertion(message.size() == size + 1, message.size(), size);
+    std::copy(message.begin() + 1, message.end(), values);
+    reference.assign(values, values + size);
+  } else {
+    CHECK(mode == MODE_DELTA, "Received a compressed message of unknown mode " << mode);
+    auto control = reinterpret_cast<const unsigned char *>(message.data() + 1);
+    auto bytes   = control + (size + 1) / 2;
+    for (size_t i = 0; i < size; i++) {
+      int      count = (control[i / 2] >> (4 * (i % 2))) & 0xf;
+      uint64_t delta = 0;
+      for (int b = 0; b < count; b++) {
+        delta |= static_cast<uint64_t>(*bytes++) << (8 * b);
+      }
+      if (delta != 0) {
+        reference[i] = toDouble(toBits(reference[i]) ^ delta);
+      }
+      values[i] = reference[i];
+    }
+    assertion(bytes <= reinterpret_cast<const unsigned char *>(message.data() + message.size()));
+  }
+}
+
+} // namespace m2n
+} // namespace precice
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <map>
+#include <utility>
+#include <vector>
+#include "logging/Logger.hpp"
+
+namespace precice
+{
+namespace m2n
+{
+/**
+ * @brief Delta encoding of data fields, which are exchanged repeatedly.
+ *
+ * Every message is encoded against the values of the previous message of the same stream,
+ * which is identified by a key, e.g. the data ID and the remote rank. The bits of each value
+ * are XOR-ed with the bits of its previous value. Only the non-zero low bytes of the result
+ * are sent, their number is stored in a 4-bit control code per value. Values, which did not
+ * change, thus cost half a byte. If the encoding is not smaller than the raw values, they are
+ * sent raw.
+ *
+ * With a tolerance larger than zero, values which changed by at most the tolerance times the
+ * largest absolute value of the message are not updated. The error of the received values is
+ * bounded by this threshold, since the previous values of both sides always agree.
+ *
+ * The sender and the receiver each hold one DataCompression and have to encode and decode the
+ * messages of a stream in the same order.
+ *
+ * Messages are stored in vectors of doubles, so that they can be sent by any com::Communication.
+ */
+class DataCompression
+{
+public:
+  /// Data ID and an identifier of the part of the data, e.g. the remote rank or the chunk.
+  using Key = std::pair<int, int>;
+
+  explicit DataCompression(double tolerance = 0.0);
+
+  /// Encodes size values of the stream key into message.
+  void encode(Key key, const double *values, size_t size, std::vector<double> &message);
+
+  /// Decodes a message of the stream key into size values.
+  void decode(Key key, std::vector<double> const &message, double *values, size_t size);
+
+  double getTolerance() const
+  {
+    return _tolerance;
+  }
+
+private:
+  logging::Logger _log{"m2n::DataCompression"};
+
+  double _tolerance;
+
+  /// Values of the last encoded message per stream, as known to both sides.
+  std::map<Key, std::vector<double>> _sentValues;
+
+  /// Values of the last decoded message per stream, as known to both sides.
+  std::map<Key, std::vector<double>> _receivedValues;
+};
+
+} // namespace m2n
+} // namespace precice
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <memory>
+#include "m2n/DataCompression.hpp"
 #include "mesh/SharedPointer.hpp"
 
 namespace precice
@@ -70,19 +72,34 @@ public:
    */
   virtual void closeConnection() = 0;
 
-  /// Sends an array of double values from all slaves (different for each slave).
+  /**
+   * @brief Sends an array of double values from all slaves (different for each slave).
+   *
+   * @param[in] dataID Identifies the data for the compression, negative to send it uncompressed.
+   */
   virtual void send(
       double *itemsToSend,
       size_t  size,
-      int     valueDimension) = 0;
+      int     valueDimension,
+      int     dataID = -1) = 0;
 
   /// All slaves receive an array of doubles (different for each slave).
   virtual void receive(
       double *itemsToReceive,
       size_t  size,
-      int     valueDimension) = 0;
+      int     valueDimension,
+      int     dataID = -1) = 0;
+
+  /// Encodes the data against the previously exchanged values of the same data, see DataCompression.
+  void enableCompression(double tolerance)
+  {
+    _compression = std::make_shared<DataCompression>(tolerance);
+  }
 
 protected:
+  /// Compression of the exchanged data, nullptr if disabled.
+  std::shared_ptr<DataCompression> _compression;
+
   /**
    * @brief mesh that dictates the distribution of this mapping
    *
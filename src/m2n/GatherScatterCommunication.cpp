@@ -1,12 +1,16 @@
 #include "GatherScatterCommunication.hpp"
 #include "com/Communication.hpp"
+#include "com/Request.hpp"
 #include "mesh/Mesh.hpp"
 #include "utils/MasterSlave.hpp"
+#include <algorithm>
 
 namespace precice
 {
 namespace m2n
 {
+const int GatherScatterCommunication::CHUNK_VERTICES;
+
 GatherScatterCommunication::GatherScatterCommunication(
     com::PtrCommunication com,
     mesh::PtrMesh         mesh)
@@ -56,7 +60,8 @@ void GatherScatterCommunication::closeConnection()
 void GatherScatterCommunication::send(
     double *itemsToSend,
     size_t  size,
-    int     valueDimension)
+    int     valueDimension,
+    int     dataID)
 {
   TRACE(size);
   assertion(utils::MasterSlave::_slaveMode || utils::MasterSlave::_masterMode);
@@ -72,42 +77,51 @@ void GatherScatterCommunication::send(
     }
   } else { // Master
     assertion(utils::MasterSlave::_rank == 0);
-    mesh::Mesh::VertexDistribution  &vertexDistribution = _mesh->getVertexDistribution();
-    int                              globalSize         = _mesh->getGlobalNumberOfVertices() * valueDimension;
+    mesh::Mesh::VertexDistribution &vertexDistribution = _mesh->getVertexDistribution();
+    int                             globalSize         = _mesh->getGlobalNumberOfVertices() * valueDimension;
     DEBUG("Global Size = " << globalSize);
-    std::vector<double> globalItemsToSend(globalSize);
-
-    // Master data
-    for (size_t i = 0; i < vertexDistribution[0].size(); i++) {
-      for (int j = 0; j < valueDimension; j++) {
-        globalItemsToSend[vertexDistribution[0][i] * valueDimension + j] += itemsToSend[i * valueDimension + j];
-      }
-    }
+    _globalItems.assign(globalSize, 0.0);
+    computeChunks();
 
-    // Slaves data
+    // Post all slave receives at once, they are accumulated in order of arrival
+    std::vector<com::PtrRequest> requests(utils::MasterSlave::_size);
+    int                          pendingRequests = 0;
+    _slaveItems.resize(utils::MasterSlave::_size);
     for (int rankSlave = 1; rankSlave < utils::MasterSlave::_size; rankSlave++) {
       int slaveSize = vertexDistribution[rankSlave].size() * valueDimension;
       DEBUG("Slave Size = " << slaveSize);
       if (slaveSize > 0) {
-        std::vector<double> valuesSlave(slaveSize);
-        utils::MasterSlave::_communication->receive(valuesSlave, rankSlave);
-        for (size_t i = 0; i < vertexDistribution[rankSlave].size(); i++) {
-          for (int j = 0; j < valueDimension; j++) {
-            globalItemsToSend[vertexDistribution[rankSlave][i] * valueDimension + j] += valuesSlave[i * valueDimension + j];
-          }
-        }
+        _slaveItems[rankSlave].resize(slaveSize);
+        requests[rankSlave] = utils::MasterSlave::_communication->aReceive(
+            _slaveItems[rankSlave].data(), slaveSize, rankSlave);
+        pendingRequests++;
       }
     }
 
-    // Send data to other master
-    _com->send(globalItemsToSend.data(), globalSize, 0);
+    // Master data
+    std::vector<int> pendingRanks = _ranksPerChunk;
+    size_t           nextChunk    = 0;
+    accumulate(vertexDistribution[0], itemsToSend, valueDimension);
+    completeRank(0, pendingRanks);
+    nextChunk = sendCompleteChunks(nextChunk, pendingRanks, valueDimension, dataID);
+
+    // Slaves data, chunks are sent to the other master as soon as all their contributions arrived
+    for (; pendingRequests > 0; pendingRequests--) {
+      size_t rankSlave = com::Request::waitAny(requests);
+      assertion(rankSlave < requests.size(), rankSlave);
+      accumulate(vertexDistribution[rankSlave], _slaveItems[rankSlave].data(), valueDimension);
+      completeRank(rankSlave, pendingRanks);
+      nextChunk = sendCompleteChunks(nextChunk, pendingRanks, valueDimension, dataID);
+    }
+    assertion(nextChunk == _ranksPerChunk.size(), nextChunk, _ranksPerChunk.size());
   } // Master
 }
 
 void GatherScatterCommunication::receive(
     double *itemsToReceive,
     size_t  size,
-    int     valueDimension)
+    int     valueDimension,
+    int     dataID)
 {
   TRACE(size);
   assertion(utils::MasterSlave::_slaveMode || utils::MasterSlave::_masterMode);
@@ -116,16 +130,6 @@ void GatherScatterCommunication::receive(
   assertion(utils::MasterSlave::_size > 1);
   assertion(utils::MasterSlave::_rank != -1);
 
-  std::vector<double> globalItemsToReceive;
-
-  // Receive data at master
-  if (utils::MasterSlave::_masterMode) {
-    int globalSize = _mesh->getGlobalNumberOfVertices() * valueDimension;
-    DEBUG("Global Size = " << globalSize);
-    globalItemsToReceive.resize(globalSize);
-    _com->receive(globalItemsToReceive.data(), globalSize, 0);
-  }
-
   // Scatter data
   if (utils::MasterSlave::_slaveMode) { // Slave
     if (size > 0) {
@@ -136,31 +140,126 @@ void GatherScatterCommunication::receive(
   } else { // Master
     assertion(utils::MasterSlave::_rank == 0);
     mesh::Mesh::VertexDistribution &vertexDistribution = _mesh->getVertexDistribution();
+    int                             globalSize         = _mesh->getGlobalNumberOfVertices() * valueDimension;
+    DEBUG("Global Size = " << globalSize);
+    _globalItems.resize(globalSize);
+    computeChunks();
 
-    // Master data
-    for (size_t i = 0; i < vertexDistribution[0].size(); i++) {
-      for (int j = 0; j < valueDimension; j++) {
-        itemsToReceive[i * valueDimension + j] = globalItemsToReceive[vertexDistribution[0][i] * valueDimension + j];
+    // Ranks, which have all their data available after receiving a chunk
+    std::vector<std::vector<int>> completedRanks(_ranksPerChunk.size());
+    for (int rank = 0; rank < utils::MasterSlave::_size; rank++) {
+      if (not vertexDistribution[rank].empty()) {
+        completedRanks[_lastChunks[rank]].push_back(rank);
       }
     }
 
-    // Slaves data
-    for (int rankSlave = 1; rankSlave < utils::MasterSlave::_size; rankSlave++) {
-      int slaveSize = vertexDistribution[rankSlave].size() * valueDimension;
-      DEBUG("Slave Size = " << slaveSize);
-      if (slaveSize > 0) {
-        std::vector<double> valuesSlave(slaveSize);
-        for (size_t i = 0; i < vertexDistribution[rankSlave].size(); i++) {
-          for (int j = 0; j < valueDimension; j++) {
-            valuesSlave[i * valueDimension + j] = globalItemsToReceive[vertexDistribution[rankSlave][i] * valueDimension + j];
-          }
+    // Receive data chunk-wise from other master and scatter it while the next chunks arrive
+    std::vector<com::PtrRequest> requests;
+    _slaveItems.resize(utils::MasterSlave::_size);
+    int chunkSize = CHUNK_VERTICES * valueDimension;
+    for (size_t chunk = 0; chunk < _ranksPerChunk.size(); chunk++) {
+      int offset = chunk * chunkSize;
+      int length = std::min(chunkSize, globalSize - offset);
+      if (_compression && dataID >= 0) {
+        _com->receive(_message, 0);
+        _compression->decode({dataID, static_cast<int>(chunk)}, _message, &_globalItems[offset], length);
+      } else {
+        _com->receive(&_globalItems[offset], length, 0);
+      }
+
+      for (int rank : completedRanks[chunk]) {
+        if (rank == 0) { // Master data
+          extract(vertexDistribution[0], itemsToReceive, valueDimension);
+        } else { // Slaves data
+          DEBUG("Slave Size = " << vertexDistribution[rank].size() * valueDimension);
+          _slaveItems[rank].resize(vertexDistribution[rank].size() * valueDimension);
+          extract(vertexDistribution[rank], _slaveItems[rank].data(), valueDimension);
+          requests.push_back(utils::MasterSlave::_communication->aSend(_slaveItems[rank], rank));
         }
-        utils::MasterSlave::_communication->send(valuesSlave, rankSlave);
-        DEBUG("valuesSlave[0] = " << valuesSlave[0]);
       }
     }
+    com::Request::waitAll(requests);
   } // Master
 }
 
+void GatherScatterCommunication::computeChunks()
+{
+  mesh::Mesh::VertexDistribution &vertexDistribution = _mesh->getVertexDistribution();
+  int                             numberOfChunks     = (_mesh->getGlobalNumberOfVertices() + CHUNK_VERTICES - 1) / CHUNK_VERTICES;
+
+  _ranksPerChunk.assign(numberOfChunks, 0);
+  _rankChunks.assign(utils::MasterSlave::_size, std::vector<int>());
+  _lastChunks.assign(utils::MasterSlave::_size, 0);
+  std::vector<int> lastRank(numberOfChunks, -1);
+  for (int rank = 0; rank < utils::MasterSlave::_size; rank++) {
+    for (int vertex : vertexDistribution[rank]) {
+      int chunk = vertex / CHUNK_VERTICES;
+      assertion(chunk < numberOfChunks, chunk, numberOfChunks);
+      if (lastRank[chunk] != rank) {
+        lastRank[chunk] = rank;
+        _ranksPerChunk[chunk]++;
+        _rankChunks[rank].push_back(chunk);
+      }
+      _lastChunks[rank] = std::max(_lastChunks[rank], chunk);
+    }
+  }
+}
+
+void GatherScatterCommunication::completeRank(
+    int               rank,
+    std::vector<int> &pendingRanks)
+{
+  for (int chunk : _rankChunks[rank]) {
+    pendingRanks[chunk]--;
+  }
+}
+
+size_t GatherScatterCommunication::sendCompleteChunks(
+    size_t                  nextChunk,
+    const std::vector<int> &pendingRanks,
+    int                     valueDimension,
+    int                     dataID)
+{
+  int chunkSize  = CHUNK_VERTICES * valueDimension;
+  int globalSize = _globalItems.size();
+  while (nextChunk < pendingRanks.size() && pendingRanks[nextChunk] == 0) {
+    int offset = nextChunk * chunkSize;
+    int length = std::min(chunkSize, globalSize - offset);
+    // Blocking, since asynchronous sends to the same rank are not guaranteed to stay in order
+    if (_compression && dataID >= 0) {
+      _compression->encode({dataID, static_cast<int>(nextChunk)}, &_globalItems[offset], length, _message);
+      _com->send(_message, 0);
+    } else {
+      _com->send(&_globalItems[offset], length, 0);
+    }
+    nextChunk++;
+  }
+  return nextChunk;
+}
+
+void GatherScatterCommunication::accumulate(
+    const std::vector<int> &vertices,
+    const double           *items,
+    int                     valueDimension)
+{
+  for (size_t i = 0; i < vertices.size(); i++) {
+    for (int j = 0; j < valueDimension; j++) {
+      _globalItems[vertices[i] * valueDimension + j] += items[i * valueDimension + j];
+    }
+  }
+}
+
+void GatherScatterCommunication::extract(
+    const std::vector<int> &vertices,
+    double                 *items,
+    int                     valueDimension) const
+{
+  for (size_t i = 0; i < vertices.size(); i++) {
+    for (int j = 0; j < valueDimension; j++) {
+      items[i * valueDimension + j] = _globalItems[vertices[i] * valueDimension + j];
+    }
+  }
+}
+
 } // namespace m2n
 } // namespace precice
@@ -3,6 +3,7 @@
 #include "DistributedCommunication.hpp"
 #include "com/SharedPointer.hpp"
 #include "logging/Logger.hpp"
+#include <vector>
 
 namespace precice
 {
@@ -13,11 +14,23 @@ namespace m2n
  * @brief Implements DistributedCommunication by using a gathering/scattering methodology.
  * Arrays of data are always gathered and scattered at the master. No direct communication
  * between slaves is used.
+ *
+ * The global data is exchanged between both masters in chunks of CHUNK_VERTICES vertices.
+ * While gathering, the master receives from all slaves concurrently and sends a chunk as
+ * soon as all ranks contributing to it have arrived. While scattering, a slave gets its
+ * data as soon as the last chunk it depends on has arrived.
  * For more details see m2n/DistributedCommunication.hpp
  */
 class GatherScatterCommunication : public DistributedCommunication
 {
 public:
+  /**
+   * @brief Number of vertices per chunk exchanged between the masters.
+   *
+   * Participants running in coupling mode have to use the same chunks, see M2N::send().
+   */
+  static const int CHUNK_VERTICES = 16384;
+
   GatherScatterCommunication(
       com::PtrCommunication com,
       mesh::PtrMesh         mesh);
@@ -66,13 +79,15 @@ public:
   virtual void send(
       double *itemsToSend,
       size_t  size,
-      int     valueDimension);
+      int     valueDimension,
+      int     dataID = -1);
 
   /// All slaves receive an array of doubles (different for each slave).
   virtual void receive(
       double *itemsToReceive,
       size_t  size,
-      int     valueDimension);
+      int     valueDimension,
+      int     dataID = -1);
 
 private:
   logging::Logger _log{"m2n::GatherScatterCommunication"};
@@ -82,6 +97,39 @@ private:
 
   /// Global communication is set up or not
   bool _isConnected;
+
+  /// Buffer for the global data at the master, kept to avoid reallocations.
+  std::vector<double> _globalItems;
+
+  /// Buffers for the data of each slave at the master.
+  std::vector<std::vector<double>> _slaveItems;
+
+  /// Number of ranks contributing to each chunk.
+  std::vector<int> _ranksPerChunk;
+
+  /// Chunks each rank contributes to.
+  std::vector<std::vector<int>> _rankChunks;
+
+  /// Last chunk each rank contributes to.
+  std::vector<int> _lastChunks;
+
+  /// Buffer for a compressed chunk.
+  std::vector<double> _message;
+
+  /// Assigns the vertices of all ranks to chunks.
+  void computeChunks();
+
+  /// Marks the contributions of the given rank as arrived.
+  void completeRank(int rank, std::vector<int> &pendingRanks);
+
+  /// Sends all complete chunks starting at nextChunk in order, returns the next incomplete chunk.
+  size_t sendCompleteChunks(size_t nextChunk, const std::vector<int> &pendingRanks, int valueDimension, int dataID);
+
+  /// Adds the values of the given vertices to the global data.
+  void accumulate(const std::vector<int> &vertices, const double *items, int valueDimension);
+
+  /// Copies the values of the given vertices from the global data.
+  void extract(const std::vector<int> &vertices, double *items, int valueDimension) const;
 };
 
 } // namespace m2n
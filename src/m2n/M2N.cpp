@@ -1,11 +1,13 @@
 #include "M2N.hpp"
 #include "DistributedComFactory.hpp"
 #include "DistributedCommunication.hpp"
+#include "GatherScatterCommunication.hpp"
 #include "com/Communication.hpp"
 #include "mesh/Mesh.hpp"
 #include "utils/EventTimings.hpp"
 #include "utils/MasterSlave.hpp"
 #include "utils/Publisher.hpp"
+#include <algorithm>
 
 using precice::utils::Event;
 using precice::utils::Publisher;
@@ -130,13 +132,23 @@ void M2N::createDistributedCommunication(mesh::PtrMesh mesh)
 {
   DistributedCommunication::SharedPointer distCom = _distrFactory->newDistributedCommunication(mesh);
   _distComs[mesh->getID()]                        = distCom;
+  if (_compression) {
+    distCom->enableCompression(_compression->getTolerance());
+  }
+}
+
+void M2N::enableCompression(double tolerance)
+{
+  assertion(_distComs.empty());
+  _compression = std::make_shared<DataCompression>(tolerance);
 }
 
 void M2N::send(
     double *itemsToSend,
     int     size,
     int     meshID,
-    int     valueDimension)
+    int     valueDimension,
+    int     dataID)
 {
   if (utils::MasterSlave::_slaveMode || utils::MasterSlave::_masterMode) {
     assertion(_areSlavesConnected);
@@ -152,10 +164,20 @@ void M2N::send(
       }
     }
     Event e("m2n.sendData", precice::syncMode);
-    _distComs[meshID]->send(itemsToSend, size, valueDimension);
+    _distComs[meshID]->send(itemsToSend, size, valueDimension, dataID);
   } else { //coupling mode
     assertion(_isMasterConnected);
-    _masterCom->send(itemsToSend, size, 0);
+    // Use the same chunks as a gather-scatter master on the other side
+    int chunkSize = GatherScatterCommunication::CHUNK_VERTICES * valueDimension;
+    for (int offset = 0; offset < size; offset += chunkSize) {
+      int length = std::min(chunkSize, size - offset);
+      if (_compression && dataID >= 0) {
+        _compression->encode({dataID, offset / chunkSize}, itemsToSend + offset, length, _message);
+        _masterCom->send(_message, 0);
+      } else {
+        _masterCom->send(itemsToSend + offset, length, 0);
+      }
+    }
   }
 }
 
@@ -178,7 +200,8 @@ void M2N::send(double itemToSend)
 void M2N::receive(double *itemsToReceive,
                   int     size,
                   int     meshID,
-                  int     valueDimension)
+                  int     valueDimension,
+                  int     dataID)
 {
   if (utils::MasterSlave::_slaveMode || utils::MasterSlave::_masterMode) {
     assertion(_areSlavesConnected);
@@ -195,10 +218,19 @@ void M2N::receive(double *itemsToReceive,
       }
     }
     Event e("m2n.receiveData", precice::syncMode);
-    _distComs[meshID]->receive(itemsToReceive, size, valueDimension);
+    _distComs[meshID]->receive(itemsToReceive, size, valueDimension, dataID);
   } else { //coupling mode
     assertion(_isMasterConnected);
-    _masterCom->receive(itemsToReceive, size, 0);
+    int chunkSize = GatherScatterCommunication::CHUNK_VERTICES * valueDimension;
+    for (int offset = 0; offset < size; offset += chunkSize) {
+      int length = std::min(chunkSize, size - offset);
+      if (_compression && dataID >= 0) {
+        _masterCom->receive(_message, 0);
+        _compression->decode({dataID, offset / chunkSize}, _message, itemsToReceive + offset, length);
+      } else {
+        _masterCom->receive(itemsToReceive + offset, length, 0);
+      }
+    }
   }
 }
 
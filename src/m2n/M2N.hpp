@@ -1,10 +1,12 @@
 #pragma once
 
+#include "DataCompression.hpp"
 #include "DistributedComFactory.hpp"
 #include "com/SharedPointer.hpp"
 #include "logging/Logger.hpp"
 #include "mesh/SharedPointer.hpp"
 #include <map>
+#include <memory>
 
 namespace precice
 {
@@ -77,11 +79,25 @@ public:
   /// Creates a new distributes communication for that mesh, stores the pointer in _distComs
   void createDistributedCommunication(mesh::PtrMesh mesh);
 
-  /// Sends an array of double values from all slaves (different for each slave).
+  /**
+   * @brief Compresses the data arrays, which are sent and received with a data ID.
+   *
+   * Has to be enabled on both sides before the distributed communications are created.
+   *
+   * @param[in] tolerance Changes up to this fraction of the largest value are not sent, 0 is lossless.
+   */
+  void enableCompression(double tolerance);
+
+  /**
+   * @brief Sends an array of double values from all slaves (different for each slave).
+   *
+   * @param[in] dataID ID of the sent data, enables the compression if non-negative.
+   */
   void send(double *itemsToSend,
             int     size,
             int     meshID,
-            int     valueDimension);
+            int     valueDimension,
+            int     dataID = -1);
 
   /**
    * @brief The master sends a bool to the other master, for performance reasons, we
@@ -99,7 +115,8 @@ public:
   void receive(double *itemsToReceive,
                int     size,
                int     meshID,
-               int     valueDimension);
+               int     valueDimension,
+               int     dataID = -1);
 
   /// All slaves receive a bool (the same for each slave).
   void receive(bool &itemToReceive);
@@ -117,6 +134,12 @@ private:
 
   DistributedComFactory::SharedPointer _distrFactory;
 
+  /// Compression of the data sent between the masters in coupling mode, nullptr if disabled.
+  std::shared_ptr<DataCompression> _compression;
+
+  /// Buffer for a compressed chunk in coupling mode.
+  std::vector<double> _message;
+
   bool _isMasterConnected = false;
 
   bool _areSlavesConnected = false;
@@ -3,6 +3,7 @@
 #include <thread>
 #include "com/Communication.hpp"
 #include "com/CommunicationFactory.hpp"
+#include "com/Request.hpp"
 #include "mesh/Mesh.hpp"
 #include "utils/EventTimings.hpp"
 #include "utils/MasterSlave.hpp"
@@ -399,7 +400,7 @@ void PointToPointCommunication::acceptConnection(std::string const &acceptorName
       therefore, for data structure consistency of `_mappings' with the requester participant side, 
       we simply duplicate references to the same communication object `c'.
     */
-    _mappings.push_back({globalRequesterRank, std::move(indices), c, com::PtrRequest(), {}});
+    _mappings.push_back({globalRequesterRank, std::move(indices), c, com::PtrRequest(), {}, 0, {}});
   }
   e4.stop();
   _isConnected = true;
@@ -519,7 +520,7 @@ void PointToPointCommunication::requestConnection(std::string const &acceptorNam
     // On the requester participant side, the communication objects behave
     // as clients, i.e. each of them requests only one connection to
     // acceptor process (in the acceptor participant).
-    _mappings.push_back({globalAcceptorRank, std::move(indices), c, com::PtrRequest(), {}});
+    _mappings.push_back({globalAcceptorRank, std::move(indices), c, com::PtrRequest(), {}, 0, {}});
   }
   e4.stop();
   _isConnected = true;
@@ -544,7 +545,8 @@ void PointToPointCommunication::closeConnection()
 
 void PointToPointCommunication::send(double *itemsToSend,
                                      size_t  size,
-                                     int     valueDimension)
+                                     int     valueDimension,
+                                     int     dataID)
 {
 
   if (_mappings.empty()) {
@@ -559,6 +561,13 @@ void PointToPointCommunication::send(double *itemsToSend,
         buffer->push_back(itemsToSend[index * valueDimension + d]);
       }
     }
+    if (_compression && dataID >= 0) {
+      auto message = std::make_shared<std::vector<double>>();
+      _compression->encode({dataID, mapping.remoteRank}, buffer->data(), buffer->size(), *message);
+      // Blocking, so that the length and the message stay in order
+      mapping.communication->send(static_cast<int>(message->size()), mapping.remoteRank);
+      buffer = message;
+    }
     auto request = mapping.communication->aSend(*buffer, mapping.remoteRank);
     bufferedRequests.emplace_back(request, buffer);
   }
@@ -580,7 +589,8 @@ void PointToPointCommunication::send(double *itemsToSend,
 
 void PointToPointCommunication::receive(double *itemsToReceive,
                                         size_t  size,
-                                        int     valueDimension)
+                                        int     valueDimension,
+                                        int     dataID)
 {
   if (_mappings.empty()) {
     return;
@@ -588,18 +598,44 @@ void PointToPointCommunication::receive(double *itemsToReceive,
 
   std::fill(itemsToReceive, itemsToReceive + size, 0);
 
+  bool isCompressed = _compression && dataID >= 0;
+
+  std::vector<com::PtrRequest> requests;
+  requests.reserve(_mappings.size());
+  if (isCompressed) {
+    // Compressed messages have a variable length, which is sent first
+    for (auto &mapping : _mappings) {
+      requests.push_back(mapping.communication->aReceive(mapping.messageLength, mapping.remoteRank));
+    }
+    com::Request::waitAll(requests);
+    requests.clear();
+  }
+
   for (auto &mapping : _mappings) {
-    mapping.recvBuffer.resize(mapping.indices.size() * valueDimension);
+    mapping.recvBuffer.resize(isCompressed ? mapping.messageLength : mapping.indices.size() * valueDimension);
     mapping.request = mapping.communication->aReceive(mapping.recvBuffer, mapping.remoteRank);
+    requests.push_back(mapping.request);
   }
 
-  for (auto &mapping : _mappings) {
-    mapping.request->wait();
+  // accumulate the received values in the order of arrival
+  for (size_t completed = 0; completed < _mappings.size(); completed++) {
+    size_t index = com::Request::waitAny(requests);
+    assertion(index < _mappings.size(), index);
+    auto &mapping   = _mappings[index];
+    mapping.request = nullptr;
+
+    const double *values = mapping.recvBuffer.data();
+    if (isCompressed) {
+      mapping.decodedBuffer.resize(mapping.indices.size() * valueDimension);
+      _compression->decode({dataID, mapping.remoteRank}, mapping.recvBuffer,
+                           mapping.decodedBuffer.data(), mapping.decodedBuffer.size());
+      values = mapping.decodedBuffer.data();
+    }
 
     int i = 0;
     for (auto index : mapping.indices) {
       for (int d = 0; d < valueDimension; ++d) {
-        itemsToReceive[index * valueDimension + d] += mapping.recvBuffer[i * valueDimension + d];
+        itemsToReceive[index * valueDimension + d] += values[i * valueDimension + d];
       }
       i++;
     }
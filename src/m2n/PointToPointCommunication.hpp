@@ -62,7 +62,7 @@ public:
    * @brief Sends a subset of local double values corresponding to local indices
    *        deduced from the current and remote vertex distributions.
    */
-  virtual void send(double *itemsToSend, size_t size, int valueDimension = 1);
+  virtual void send(double *itemsToSend, size_t size, int valueDimension = 1, int dataID = -1);
 
   /**
    * @brief Receives a subset of local double values corresponding to local
@@ -70,7 +70,8 @@ public:
    */
   virtual void receive(double *itemsToReceive,
                        size_t  size,
-                       int     valueDimension = 1);
+                       int     valueDimension = 1,
+                       int     dataID         = -1);
 
 private:
   logging::Logger _log{"m2n::PointToPointCommunication"};
@@ -91,6 +92,7 @@ private:
    *           the current process rank and the remote process rank;
    *        3. communication object (provides point-to-point communication routines).
    *        5. Appropriatly sized buffer to receive elements
+   *        6. Length of a compressed message and buffer for its decoded values
    */
   struct Mapping {
     int                   remoteRank;
@@ -98,6 +100,8 @@ private:
     com::PtrCommunication communication;
     com::PtrRequest       request;
     std::vector<double>   recvBuffer;
+    int                   messageLength;
+    std::vector<double>   decodedBuffer;
   };
 
   /**
@@ -3,7 +3,10 @@
 #include "com/MPIDirectCommunication.hpp"
 #include "com/MPIPortsCommunicationFactory.hpp"
 #include "com/MPISinglePortsCommunicationFactory.hpp"
+#include "com/SharedMemoryCommunication.hpp"
+#include "com/SharedMemoryCommunicationFactory.hpp"
 #include "com/SocketCommunicationFactory.hpp"
+#include "com/SocketIOService.hpp"
 #include "m2n/DistributedComFactory.hpp"
 #include "m2n/GatherScatterComFactory.hpp"
 #include "m2n/M2N.hpp"
@@ -47,6 +50,45 @@ M2NConfiguration::M2NConfiguration(xml::XMLTag &parent)
     attrNetwork.setDefaultValue("lo");
     tag.addAttribute(attrNetwork);
 
+    XMLAttribute<int> attrIOThreads("io-threads");
+    doc = "Number of threads running the asynchronous socket operations. The threads are ";
+    doc += "shared by all socket communications of the process, independent of the number ";
+    doc += "of communication partners. Hence, the setting applies per process and all ";
+    doc += "sockets m2n have to use the same value.";
+    attrIOThreads.setDocumentation(doc);
+    attrIOThreads.setDefaultValue(1);
+    tag.addAttribute(attrIOThreads);
+
+    XMLAttribute<std::string> attrExchangeDirectory(ATTR_EXCHANGE_DIRECTORY);
+    doc = "Directory where connection information is exchanged. By default, the ";
+    doc += "directory of startup is chosen, and both solvers have to be started ";
+    doc += "in the same directory.";
+    attrExchangeDirectory.setDocumentation(doc);
+    attrExchangeDirectory.setDefaultValue("");
+    tag.addAttribute(attrExchangeDirectory);
+    tags.push_back(tag);
+  }
+  {
+    XMLTag tag(*this, "shared-memory", occ, TAG);
+    doc = "Communication via shared memory between ranks on the same host. The connection ";
+    doc += "is established via sockets, which are also used between ranks on different hosts. ";
+    doc += "Only available on Linux, other systems use sockets only.";
+    tag.setDocumentation(doc);
+
+    XMLAttribute<int> attrBufferSize("buffer-size");
+    doc = "Size in bytes of the ring buffer used per pair of ranks and direction. Larger messages ";
+    doc += "are streamed through the buffer.";
+    attrBufferSize.setDocumentation(doc);
+    attrBufferSize.setDefaultValue(1 << 20);
+    tag.addAttribute(attrBufferSize);
+
+    XMLAttribute<std::string> attrNetwork("network");
+    doc = "Interface name to be used for the socket communication. ";
+    doc += "Default is \"lo\", i.e., the local host loopback.";
+    attrNetwork.setDocumentation(doc);
+    attrNetwork.setDefaultValue("lo");
+    tag.addAttribute(attrNetwork);
+
     XMLAttribute<std::string> attrExchangeDirectory(ATTR_EXCHANGE_DIRECTORY);
     doc = "Directory where connection information is exchanged. By default, the ";
     doc += "directory of startup is chosen, and both solvers have to be started ";
@@ -120,10 +162,26 @@ M2NConfiguration::M2NConfiguration(xml::XMLTag &parent)
   doc = "Second participant name involved in communication.";
   attrTo.setDocumentation(doc);
 
+  XMLAttribute<bool> attrCompression(ATTR_COMPRESSION);
+  doc = "Encodes the exchanged coupling data against the values of the previous exchange and only ";
+  doc += "sends the changed bytes. Reduces the transferred volume, if the data changes little between ";
+  doc += "exchanges, e.g. between the iterations of an implicit coupling.";
+  attrCompression.setDocumentation(doc);
+  attrCompression.setDefaultValue(false);
+
+  XMLAttribute<double> attrCompressionTolerance(ATTR_COMPRESSION_TOLERANCE);
+  doc = "Changes of a value up to this fraction of the largest absolute value of the message are not ";
+  doc += "sent, the previous value is kept instead. The default 0 compresses lossless.";
+  attrCompressionTolerance.setDocumentation(doc);
+  attrCompressionTolerance.setDefaultValue(0.0);
+
   for (XMLTag &tag : tags) {
     tag.addAttribute(attrFrom);
     tag.addAttribute(attrTo);
-    if (tag.getName() == "mpi" || tag.getName() == "mpi-singleports" || tag.getName() == "sockets") {
+    tag.addAttribute(attrCompression);
+    tag.addAttribute(attrCompressionTolerance);
+    if (tag.getName() == "mpi" || tag.getName() == "mpi-singleports" || tag.getName() == "sockets" ||
+        tag.getName() == "shared-memory") {
       tag.addAttribute(attrDistrTypeBoth);
     } else {
       tag.addAttribute(attrDistrTypeOnly);
@@ -164,9 +222,31 @@ void M2NConfiguration::xmlTagCallback(xml::XMLTag &tag)
       CHECK(not utils::isTruncated<unsigned short>(port),
             "The value given for the \"port\" attribute is not a 16-bit unsigned integer: " << port);
 
+      int ioThreads = tag.getIntAttributeValue("io-threads");
+      CHECK(ioThreads > 0, "The value given for the \"io-threads\" attribute has to be larger than zero: " << ioThreads);
+      CHECK(_ioThreads == -1 or _ioThreads == ioThreads,
+            "The socket I/O threads are shared by all m2n of a process, hence all sockets m2n have to "
+                << "use the same value for the \"io-threads\" attribute, but " << ioThreads << " and "
+                << _ioThreads << " are given");
+      _ioThreads = ioThreads;
+      com::SocketIOService::setNumberOfThreads(ioThreads);
+
       std::string dir = tag.getStringAttributeValue(ATTR_EXCHANGE_DIRECTORY);
       comFactory      = std::make_shared<com::SocketCommunicationFactory>(port, false, network, dir);
       com             = comFactory->newCommunication();
+    } else if (tag.getName() == "shared-memory") {
+      std::string network    = tag.getStringAttributeValue("network");
+      int         bufferSize = tag.getIntAttributeValue("buffer-size");
+      CHECK(bufferSize > 0, "The value given for the \"buffer-size\" attribute has to be larger than zero: " << bufferSize);
+
+      std::string dir = tag.getStringAttributeValue(ATTR_EXCHANGE_DIRECTORY);
+#ifdef __linux__
+      comFactory = std::make_shared<com::SharedMemoryCommunicationFactory>(bufferSize, network, dir);
+#else
+      WARN("Communication type \"shared-memory\" is only available on Linux, using sockets instead");
+      comFactory = std::make_shared<com::SocketCommunicationFactory>(0, false, network, dir);
+#endif
+      com = comFactory->newCommunication();
     } else if (tag.getName() == "mpi") {
       std::string dir = tag.getStringAttributeValue(ATTR_EXCHANGE_DIRECTORY);
 #ifdef PRECICE_NO_MPI
@@ -207,12 +287,19 @@ void M2NConfiguration::xmlTagCallback(xml::XMLTag &tag)
       assertion(distrType == VALUE_GATHER_SCATTER);
       distrFactory = std::make_shared<GatherScatterComFactory>(com);
     } else if (distrType == VALUE_POINT_TO_POINT) {
-      assertion(tag.getName() == "mpi" or tag.getName() == "mpi-singleports" or tag.getName() == "sockets");
+      assertion(tag.getName() == "mpi" or tag.getName() == "mpi-singleports" or tag.getName() == "sockets" or
+                tag.getName() == "shared-memory");
       distrFactory = std::make_shared<PointToPointComFactory>(comFactory);
     }
     assertion(distrFactory.get() != nullptr);
 
     auto m2n = std::make_shared<m2n::M2N>(com, distrFactory);
+    if (tag.getBooleanAttributeValue(ATTR_COMPRESSION)) {
+      double tolerance = tag.getDoubleAttributeValue(ATTR_COMPRESSION_TOLERANCE);
+      CHECK(tolerance >= 0.0, "The value given for the \"" << ATTR_COMPRESSION_TOLERANCE
+                                                            << "\" attribute must not be negative: " << tolerance);
+      m2n->enableCompression(tolerance);
+    }
     _m2ns.push_back(std::make_tuple(m2n, from, to));
   }
 }
@@ -50,15 +50,20 @@ public:
 private:
   logging::Logger _log{"m2n::M2NConfiguration"};
 
-  const std::string TAG                     = "m2n";
-  const std::string ATTR_DISTRIBUTION_TYPE  = "distribution-type";
-  const std::string ATTR_EXCHANGE_DIRECTORY = "exchange-directory";
+  const std::string TAG                        = "m2n";
+  const std::string ATTR_DISTRIBUTION_TYPE     = "distribution-type";
+  const std::string ATTR_EXCHANGE_DIRECTORY    = "exchange-directory";
+  const std::string ATTR_COMPRESSION           = "compression";
+  const std::string ATTR_COMPRESSION_TOLERANCE = "compression-tolerance";
 
   const std::string VALUE_GATHER_SCATTER = "gather-scatter";
   const std::string VALUE_POINT_TO_POINT = "point-to-point";
 
   std::vector<M2NTuple> _m2ns;
 
+  /// Number of socket I/O threads of all sockets m2n, which is a setting of the whole process.
+  int _ioThreads = -1;
+
   void checkDuplicates(
       const std::string &from,
       const std::string &to);
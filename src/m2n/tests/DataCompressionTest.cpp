@@ -0,0 +1,74 @@
+#include <vector>
+#include "m2n/DataCompression.hpp"
+#include "testing/Testing.hpp"
+
+using namespace precice;
+using namespace precice::m2n;
+
+BOOST_AUTO_TEST_SUITE(M2NTests)
+BOOST_AUTO_TEST_SUITE(DataCompressionTests)
+
+BOOST_AUTO_TEST_CASE(Lossless, *testing::OnMaster())
+{
+  DataCompression     sender, receiver;
+  std::vector<double> values(100), received(values.size()), message;
+  for (size_t i = 0; i < values.size(); i++) {
+    values[i] = 1.0 / (i + 1);
+  }
+
+  // The first message has nothing to compare to and is sent raw
+  sender.encode({0, 1}, values.data(), values.size(), message);
+  BOOST_TEST(message.size() == values.size() + 1);
+  receiver.decode({0, 1}, message, received.data(), received.size());
+  BOOST_TEST(received == values, boost::test_tools::per_element());
+
+  // Unchanged values cost half a byte each
+  sender.encode({0, 1}, values.data(), values.size(), message);
+  BOOST_TEST(message.size() == 1 + values.size() / 16 + 1);
+  std::fill(received.begin(), received.end(), 0.0);
+  receiver.decode({0, 1}, message, received.data(), received.size());
+  BOOST_TEST(received == values, boost::test_tools::per_element());
+
+  // Small changes are reconstructed exactly
+  values[3] *= 1.0 + 1e-15;
+  values[50] = -values[50];
+  values[99] = 0.0;
+  sender.encode({0, 1}, values.data(), values.size(), message);
+  BOOST_TEST(message.size() < values.size() / 4);
+  receiver.decode({0, 1}, message, received.data(), received.size());
+  BOOST_TEST(received == values, boost::test_tools::per_element());
+
+  // Other streams are independent
+  std::vector<double> other(3, 2.0), otherReceived(3);
+  sender.encode({1, 1}, other.data(), other.size(), message);
+  receiver.decode({1, 1}, message, otherReceived.data(), otherReceived.size());
+  BOOST_TEST(otherReceived == other, boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_CASE(Lossy, *testing::OnMaster())
+{
+  const double        tolerance = 1e-3;
+  DataCompression     sender(tolerance), receiver(tolerance);
+  std::vector<double> values(50), received(values.size()), message;
+  for (size_t i = 0; i < values.size(); i++) {
+    values[i] = i + 1.0;
+  }
+  sender.encode({2, 0}, values.data(), values.size(), message);
+  receiver.decode({2, 0}, message, received.data(), received.size());
+
+  // Changes below the threshold are not sent, but never accumulate beyond it
+  for (int step = 0; step < 10; step++) {
+    for (size_t i = 0; i < values.size(); i++) {
+      values[i] += (i % 2 == 0) ? 1e-2 : 1e-5;
+    }
+    sender.encode({2, 0}, values.data(), values.size(), message);
+    receiver.decode({2, 0}, message, received.data(), received.size());
+    double maxValue = values.back();
+    for (size_t i = 0; i < values.size(); i++) {
+      BOOST_TEST(std::abs(received[i] - values[i]) <= tolerance * maxValue);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END() // DataCompressionTests
+BOOST_AUTO_TEST_SUITE_END() // M2NTests
@@ -3,6 +3,7 @@
 #include "com/MPIDirectCommunication.hpp"
 #include "m2n/DistributedComFactory.hpp"
 #include "m2n/GatherScatterComFactory.hpp"
+#include "m2n/GatherScatterCommunication.hpp"
 #include "m2n/M2N.hpp"
 #include "m2n/SharedPointer.hpp"
 #include "mesh/Mesh.hpp"
@@ -144,6 +145,125 @@ BOOST_AUTO_TEST_CASE(GatherScatterTest, *testing::OnSize(4))
   utils::Parallel::clearGroups();
 }
 
+BOOST_AUTO_TEST_CASE(GatherScatterChunksTest, *testing::OnSize(4))
+{
+  assertion(utils::Parallel::getCommunicatorSize() == 4);
+
+  com::PtrCommunication participantCom = com::PtrCommunication(new com::MPIDirectCommunication());
+  m2n::DistributedComFactory::SharedPointer distrFactory =
+      m2n::DistributedComFactory::SharedPointer(
+          new m2n::GatherScatterComFactory(participantCom));
+  m2n::PtrM2N           m2n = m2n::PtrM2N(new m2n::M2N(participantCom, distrFactory));
+  com::PtrCommunication masterSlaveCom = com::PtrCommunication(new com::MPIDirectCommunication());
+  utils::MasterSlave::_communication = masterSlaveCom;
+
+  utils::Parallel::synchronizeProcesses();
+
+  if (utils::Parallel::getProcessRank() == 0) { // Participant 1
+    utils::Parallel::splitCommunicator("Part1");
+    utils::MasterSlave::_rank       = 0;
+    utils::MasterSlave::_size       = 1;
+    utils::MasterSlave::_slaveMode  = false;
+    utils::MasterSlave::_masterMode = false;
+  } else if (utils::Parallel::getProcessRank() == 1) { // Participant 2 - Master
+    utils::Parallel::splitCommunicator("Part2Master");
+    utils::MasterSlave::_rank       = 0;
+    utils::MasterSlave::_size       = 3;
+    utils::MasterSlave::_slaveMode  = false;
+    utils::MasterSlave::_masterMode = true;
+    masterSlaveCom->acceptConnection("Part2Master", "Part2Slaves", utils::Parallel::getProcessRank());
+    masterSlaveCom->setRankOffset(1);
+  } else if (utils::Parallel::getProcessRank() == 2) { // Participant 2 - Slave1
+    utils::Parallel::splitCommunicator("Part2Slaves");
+    utils::MasterSlave::_rank       = 1;
+    utils::MasterSlave::_size       = 3;
+    utils::MasterSlave::_slaveMode  = true;
+    utils::MasterSlave::_masterMode = false;
+    masterSlaveCom->requestConnection("Part2Master", "Part2Slaves", 0, 2);
+  } else if (utils::Parallel::getProcessRank() == 3) { // Participant 2 - Slave2
+    utils::Parallel::splitCommunicator("Part2Slaves");
+    utils::MasterSlave::_rank       = 2;
+    utils::MasterSlave::_size       = 3;
+    utils::MasterSlave::_slaveMode  = true;
+    utils::MasterSlave::_masterMode = false;
+    masterSlaveCom->requestConnection("Part2Master", "Part2Slaves", 1, 2);
+  }
+
+  utils::Parallel::synchronizeProcesses();
+
+  if (utils::Parallel::getProcessRank() == 0) { // Part1
+    m2n->acceptMasterConnection("Part1", "Part2Master");
+  } else if (utils::Parallel::getProcessRank() == 1) { // Part2 Master
+    m2n->requestMasterConnection("Part1", "Part2Master");
+  } else if (utils::Parallel::getProcessRank() == 2) { // Part2 Slave1
+    m2n->requestMasterConnection("Part1", "Part2Master");
+  } else if (utils::Parallel::getProcessRank() == 3) { // Part2 Slave2
+    m2n->requestMasterConnection("Part1", "Part2Master");
+  }
+
+  utils::Parallel::synchronizeProcesses();
+
+  // Spans several chunks, the last vertices of the master overlap with the second slave
+  int  chunk            = GatherScatterCommunication::CHUNK_VERTICES;
+  int  numberOfVertices = 2 * chunk + 100;
+  int  overlap          = 10;
+  int  valueDimension   = 2;
+  bool flipNormals      = false;
+
+  if (utils::Parallel::getProcessRank() == 0) { // Part1
+    mesh::PtrMesh pMesh(new mesh::Mesh("Mesh", 2, flipNormals));
+    m2n->createDistributedCommunication(pMesh);
+    m2n->acceptSlavesConnection("Part1", "Part2Master");
+    Eigen::VectorXd values = Eigen::VectorXd::LinSpaced(numberOfVertices * valueDimension, 0, numberOfVertices * valueDimension - 1);
+    m2n->send(values.data(), values.size(), pMesh->getID(), valueDimension);
+    Eigen::VectorXd result = Eigen::VectorXd::Zero(values.size());
+    m2n->receive(result.data(), result.size(), pMesh->getID(), valueDimension);
+    for (int i = 0; i < values.size(); i++) {
+      bool shared = (i >= (chunk - overlap) * valueDimension) && (i < chunk * valueDimension);
+      BOOST_TEST(result[i] == (shared ? 4.0 : 2.0) * values[i]);
+    }
+  } else {
+    mesh::PtrMesh pMesh(new mesh::Mesh("Mesh", 2, flipNormals));
+    m2n->createDistributedCommunication(pMesh);
+    m2n->requestSlavesConnection("Part1", "Part2Master");
+
+    std::vector<int> vertices;
+    if (utils::Parallel::getProcessRank() == 1) { // Master
+      pMesh->setGlobalNumberOfVertices(numberOfVertices);
+      for (int i = 0; i < chunk; i++) {
+        pMesh->getVertexDistribution()[0].push_back(i);
+      }
+      for (int i = chunk - overlap; i < numberOfVertices; i++) {
+        pMesh->getVertexDistribution()[2].push_back(i);
+      }
+      vertices = pMesh->getVertexDistribution()[0];
+    } else if (utils::Parallel::getProcessRank() == 3) { // Slave2
+      for (int i = chunk - overlap; i < numberOfVertices; i++) {
+        vertices.push_back(i);
+      }
+    }
+
+    Eigen::VectorXd values = Eigen::VectorXd::Zero(vertices.size() * valueDimension);
+    m2n->receive(values.data(), values.size(), pMesh->getID(), valueDimension);
+    for (size_t i = 0; i < vertices.size(); i++) {
+      for (int j = 0; j < valueDimension; j++) {
+        BOOST_TEST(values[i * valueDimension + j] == vertices[i] * valueDimension + j);
+      }
+    }
+    values = values * 2;
+    m2n->send(values.data(), values.size(), pMesh->getID(), valueDimension);
+  }
+
+  utils::MasterSlave::_communication.reset();
+  utils::MasterSlave::_rank       = utils::Parallel::getProcessRank();
+  utils::MasterSlave::_size       = utils::Parallel::getCommunicatorSize();
+  utils::MasterSlave::_slaveMode  = false;
+  utils::MasterSlave::_masterMode = false;
+
+  utils::Parallel::synchronizeProcesses();
+  utils::Parallel::clearGroups();
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 #endif // PRECICE_NO_MPI
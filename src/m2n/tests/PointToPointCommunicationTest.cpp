@@ -3,6 +3,7 @@
 #include <vector>
 #include "com/MPIDirectCommunication.hpp"
 #include "com/MPIPortsCommunicationFactory.hpp"
+#include "com/SharedMemoryCommunicationFactory.hpp"
 #include "com/SocketCommunicationFactory.hpp"
 #include "m2n/PointToPointCommunication.hpp"
 #include "mesh/Mesh.hpp"
@@ -26,7 +27,8 @@ void process(vector<double> &data)
   }
 }
 
-void P2PComTest1(com::PtrCommunicationFactory cf)
+/// With compression, the data is exchanged twice, the second time it is delta encoded.
+void P2PComTest1(com::PtrCommunicationFactory cf, bool compress = false)
 {
   assertion(Parallel::getCommunicatorSize() == 4);
 
@@ -132,20 +134,33 @@ void P2PComTest1(com::PtrCommunicationFactory cf)
   }
   }
 
+  int dataID = -1;
+  if (compress) {
+    c.enableCompression(0.0);
+    dataID = 0;
+  }
+  const vector<double> initialData = data;
+
   if (Parallel::getProcessRank() < 2) {
     c.requestConnection("B", "A");
 
-    c.send(data.data(), data.size());
-    c.receive(data.data(), data.size());
+    for (int round = 0; round < (compress ? 2 : 1); round++) {
+      data = initialData;
+      c.send(data.data(), data.size(), 1, dataID);
+      c.receive(data.data(), data.size(), 1, dataID);
 
-    BOOST_TEST(data == expectedData);
+      BOOST_TEST(data == expectedData);
+    }
   } else {
     c.acceptConnection("B", "A");
 
-    c.receive(data.data(), data.size());
-    BOOST_TEST(data == expectedData);
-    process(data);
-    c.send(data.data(), data.size());
+    for (int round = 0; round < (compress ? 2 : 1); round++) {
+      data = initialData;
+      c.receive(data.data(), data.size(), 1, dataID);
+      BOOST_TEST(data == expectedData);
+      process(data);
+      c.send(data.data(), data.size(), 1, dataID);
+    }
   }
 
   MasterSlave::_communication.reset();
@@ -294,6 +309,27 @@ BOOST_AUTO_TEST_CASE(SocketCommunication,
   }
 }
 
+BOOST_AUTO_TEST_CASE(CompressedSocketCommunication,
+                     * testing::OnSize(4))
+{
+  com::PtrCommunicationFactory cf(new com::SocketCommunicationFactory);
+  if (utils::Parallel::getProcessRank() < 4) {
+    P2PComTest1(cf, true);
+  }
+}
+
+#ifdef __linux__
+BOOST_AUTO_TEST_CASE(SharedMemoryCommunication,
+                     * testing::OnSize(4))
+{
+  com::PtrCommunicationFactory cf(new com::SharedMemoryCommunicationFactory(4096));
+  if (utils::Parallel::getProcessRank() < 4) {
+    P2PComTest1(cf);
+    P2PComTest2(cf);
+  }
+}
+#endif // __linux__
+
 BOOST_AUTO_TEST_CASE(MPIPortsCommunication,
                      * testing::OnSize(4)
                      * boost::unit_test::label("MPI_Ports"))
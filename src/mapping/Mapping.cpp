@@ -1,4 +1,5 @@
 #include "Mapping.hpp"
+#include "utils/EventTimings.hpp"
 
 namespace precice {
 namespace mapping {
@@ -48,6 +49,19 @@ Mapping::MeshRequirement Mapping:: getOutputRequirement() const
   return _outputRequirement;
 }
 
+bool Mapping:: hasMeshChanged() const
+{
+  return not hasComputedMapping()
+         || _input->getRevision() != _inputRevision
+         || _output->getRevision() != _outputRevision;
+}
+
+void Mapping:: updateMapping()
+{
+  clear();
+  computeMapping();
+}
+
 mesh::PtrMesh Mapping:: input() const
 {
   return _input;
@@ -58,6 +72,24 @@ mesh::PtrMesh Mapping:: output() const
   return _output;
 }
 
+void Mapping:: storeMeshRevisions()
+{
+  _inputRevision = _input->getRevision();
+  _outputRevision = _output->getRevision();
+}
+
+int Mapping:: getEventID
+(
+  int&               eventID,
+  const std::string& name ) const
+{
+  if (eventID < 0) {
+    eventID = utils::EventRegistry::instance().registerEvent(
+        name + ".From" + _input->getName() + "To" + _output->getName());
+  }
+  return eventID;
+}
+
 void Mapping:: setInputRequirement
 (
   MeshRequirement requirement )
@@ -85,6 +85,22 @@ public:
   /// Removes a computed mapping.
   virtual void clear() = 0;
 
+  /**
+   * @brief Returns true, if the input or output mesh changed since the mapping has been computed.
+   *
+   * Changes are detected by comparing the revisions of the meshes, see mesh::Mesh::getRevision().
+   * Returns also true, if no mapping has been computed.
+   */
+  bool hasMeshChanged() const;
+
+  /**
+   * @brief Recomputes the mapping after the input or output mesh changed.
+   *
+   * The default implementation removes the computed mapping and computes it anew.
+   * Mappings which can reuse parts of their previous computation override this.
+   */
+  virtual void updateMapping();
+
   /**
    * @brief Maps input data to output data from input mesh to output mesh.
    *
@@ -121,6 +137,19 @@ protected:
 
   int getDimensions() const;
 
+  /// Stores the current revisions of input and output mesh, to be called by computeMapping().
+  void storeMeshRevisions();
+
+  /**
+   * @brief Returns the handle of the event <name>.From<input>To<output>.
+   *
+   * The event is registered on first use only, which avoids building its name on every call.
+   *
+   * @param[inout] eventID Cached handle of the event, registered if negative.
+   * @param[in] name Name of the event, without the mesh names.
+   */
+  int getEventID(int & eventID, const std::string & name) const;
+
 private:
 
   /// Determines wether mapping is consistent or conservative.
@@ -139,6 +168,10 @@ private:
   mesh::PtrMesh _output;
 
   int _dimensions;
+
+  /// Revisions of input and output mesh at the last computation of the mapping.
+  std::size_t _inputRevision = 0;
+  std::size_t _outputRevision = 0;
 };
 
 
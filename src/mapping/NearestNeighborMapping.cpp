@@ -1,6 +1,5 @@
 #include "NearestNeighborMapping.hpp"
 #include "query/FindClosestVertex.hpp"
-#include "utils/Helpers.hpp"
 #include "mesh/RTree.hpp"
 #include <Eigen/Core>
 #include <boost/function_output_iterator.hpp>
@@ -13,6 +12,46 @@ extern bool syncMode;
 
 namespace mapping {
 
+namespace {
+
+/// Copies the value of vertex indices[i] in input to vertex i in output.
+template<int DIM>
+void gather(const Eigen::VectorXd& input, Eigen::VectorXd& output, const std::vector<int>& indices)
+{
+  for (size_t i = 0; i < indices.size(); i++) {
+    output.segment<DIM>(i * DIM) = input.segment<DIM>(indices[i] * DIM);
+  }
+}
+
+/// Runtime value dimension variant of gather.
+void gather(const Eigen::VectorXd& input, Eigen::VectorXd& output, const std::vector<int>& indices, int dim)
+{
+  for (size_t i = 0; i < indices.size(); i++) {
+    output.segment(i * dim, dim) = input.segment(indices[i] * dim, dim);
+  }
+}
+
+/// Adds the value of vertex i in input to vertex indices[i] in output, visiting i in the given order.
+template<int DIM>
+void scatterAdd(const Eigen::VectorXd& input, Eigen::VectorXd& output,
+                const std::vector<int>& indices, const std::vector<int>& order)
+{
+  for (int i : order) {
+    output.segment<DIM>(indices[i] * DIM) += input.segment<DIM>(i * DIM);
+  }
+}
+
+/// Runtime value dimension variant of scatterAdd.
+void scatterAdd(const Eigen::VectorXd& input, Eigen::VectorXd& output,
+                const std::vector<int>& indices, const std::vector<int>& order, int dim)
+{
+  for (int i : order) {
+    output.segment(indices[i] * dim, dim) += input.segment(i * dim, dim);
+  }
+}
+
+} // namespace
+
 NearestNeighborMapping:: NearestNeighborMapping
 (
   Constraint constraint,
@@ -31,7 +70,7 @@ void NearestNeighborMapping:: computeMapping()
   assertion(input().get() != nullptr);
   assertion(output().get() != nullptr);
 
-  precice::utils::Event e("map.nn.computeMapping.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
+  precice::utils::Event e(getEventID(_computeMappingEventID, "map.nn.computeMapping"), precice::syncMode);
   
   if (getConstraint() == CONSISTENT){
     DEBUG("Compute consistent mapping");
@@ -63,7 +102,9 @@ void NearestNeighborMapping:: computeMapping()
                        _vertexIndices[i] =  output()->vertices()[val].getID();
                      }));
     }
+    computeScatterOrder(output()->vertices().size());
   }
+  storeMeshRevisions();
   _hasComputedMapping = true;
 }
 
@@ -77,9 +118,28 @@ void NearestNeighborMapping:: clear()
 {
   TRACE();
   _vertexIndices.clear();
+  _scatterOrder.clear();
   _hasComputedMapping = false;
 }
 
+void NearestNeighborMapping:: computeScatterOrder
+(
+  size_t outputSize )
+{
+  // Counting sort of the input vertices by their output vertex
+  std::vector<int> starts(outputSize + 1, 0);
+  for (int index : _vertexIndices) {
+    starts[index + 1]++;
+  }
+  for (size_t i = 0; i < outputSize; i++) {
+    starts[i + 1] += starts[i];
+  }
+  _scatterOrder.resize(_vertexIndices.size());
+  for (size_t i = 0; i < _vertexIndices.size(); i++) {
+    _scatterOrder[starts[_vertexIndices[i]]++] = i;
+  }
+}
+
 void NearestNeighborMapping:: map
 (
   int inputDataID,
@@ -87,7 +147,7 @@ void NearestNeighborMapping:: map
 {
   TRACE(inputDataID, outputDataID);
 
-  precice::utils::Event e("map.nn.mapData.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
+  precice::utils::Event e(getEventID(_mapDataEventID, "map.nn.mapData"), precice::syncMode);
 
   const Eigen::VectorXd& inputValues = input()->data(inputDataID)->values();
   Eigen::VectorXd& outputValues = output()->data(outputDataID)->values();
@@ -101,23 +161,39 @@ void NearestNeighborMapping:: map
                outputValues.size(), valueDimensions, output()->vertices().size() );
   if (getConstraint() == CONSISTENT){
     DEBUG("Map consistent");
-    size_t outSize = output()->vertices().size();
-    for ( size_t i=0; i < outSize; i++ ){
-      int inputIndex = _vertexIndices[i] * valueDimensions;
-      for ( int dim=0; dim < valueDimensions; dim++ ){
-        outputValues((i*valueDimensions)+dim) = inputValues(inputIndex+dim);
-      }
+    assertion(_vertexIndices.size() == output()->vertices().size(),
+              _vertexIndices.size(), output()->vertices().size());
+    switch (valueDimensions) {
+    case 1:
+      gather<1>(inputValues, outputValues, _vertexIndices);
+      break;
+    case 2:
+      gather<2>(inputValues, outputValues, _vertexIndices);
+      break;
+    case 3:
+      gather<3>(inputValues, outputValues, _vertexIndices);
+      break;
+    default:
+      gather(inputValues, outputValues, _vertexIndices, valueDimensions);
     }
   }
   else {
     assertion(getConstraint() == CONSERVATIVE, getConstraint());
     DEBUG("Map conservative");
-    size_t inSize = input()->vertices().size();
-    for ( size_t i=0; i < inSize; i++ ){
-      int outputIndex = _vertexIndices[i] * valueDimensions;
-      for ( int dim=0; dim < valueDimensions; dim++ ){
-        outputValues(outputIndex+dim) += inputValues((i*valueDimensions)+dim);
-      }
+    assertion(_vertexIndices.size() == input()->vertices().size(),
+              _vertexIndices.size(), input()->vertices().size());
+    switch (valueDimensions) {
+    case 1:
+      scatterAdd<1>(inputValues, outputValues, _vertexIndices, _scatterOrder);
+      break;
+    case 2:
+      scatterAdd<2>(inputValues, outputValues, _vertexIndices, _scatterOrder);
+      break;
+    case 3:
+      scatterAdd<3>(inputValues, outputValues, _vertexIndices, _scatterOrder);
+      break;
+    default:
+      scatterAdd(inputValues, outputValues, _vertexIndices, _scatterOrder, valueDimensions);
     }
   }
 }
@@ -129,20 +205,29 @@ void NearestNeighborMapping::tagMeshFirstRound()
   computeMapping();
 
   if (getConstraint() == CONSISTENT){
-    for(mesh::Vertex& v : input()->vertices()){
-      if(utils::contained(v.getID(),_vertexIndices)) v.tag();
-    }
+    tagVertices(*input());
   }
   else {
     assertion(getConstraint() == CONSERVATIVE, getConstraint());
-    for(mesh::Vertex& v : output()->vertices()){
-      if(utils::contained(v.getID(),_vertexIndices)) v.tag();
-    }
+    tagVertices(*output());
   }
 
   clear();
 }
 
+void NearestNeighborMapping::tagVertices(mesh::Mesh& mesh) const
+{
+  // Marks the vertex IDs once, instead of searching each vertex in _vertexIndices
+  std::vector<bool> isNearest(mesh.vertices().size(), false);
+  for (int index : _vertexIndices) {
+    assertion(index < static_cast<int>(isNearest.size()), index, isNearest.size());
+    isNearest[index] = true;
+  }
+  for (mesh::Vertex& v : mesh.vertices()) {
+    if (isNearest[v.getID()]) v.tag();
+  }
+}
+
 void NearestNeighborMapping::tagMeshSecondRound()
 {
   TRACE();
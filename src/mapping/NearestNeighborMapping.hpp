@@ -46,8 +46,21 @@ private:
   /// Flag to indicate whether computeMapping() has been called.
   bool _hasComputedMapping = false;
 
+  /// Cached event handles, see Mapping::getEventID
+  int _computeMappingEventID = -1;
+  int _mapDataEventID = -1;
+
   /// Computed output vertex indices to map data from input vertices to.
   std::vector<int> _vertexIndices;
+
+  /// Input vertex positions sorted by their nearest output vertex, used for the conservative mapping
+  std::vector<int> _scatterOrder;
+
+  /// Sorts the input vertices by their nearest output vertex, such that the results are accumulated in order
+  void computeScatterOrder(size_t outputSize);
+
+  /// Tags all vertices of mesh that are in _vertexIndices.
+  void tagVertices(mesh::Mesh& mesh) const;
 };
 
 }} // namespace precice, mapping
@@ -30,37 +30,18 @@ void NearestProjectionMapping:: computeMapping()
 {
   TRACE(input()->vertices().size(), output()->vertices().size());
 
-  precice::utils::Event e("map.np.computeMapping.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
+  precice::utils::Event e(getEventID(_computeMappingEventID, "map.np.computeMapping"), precice::syncMode);
 
   if (getConstraint() == CONSISTENT){
     DEBUG("Compute consistent mapping");
-    _weights.resize(output()->vertices().size());
-    for ( size_t i=0; i < output()->vertices().size(); i++ ){
-      query::FindClosest findClosest(output()->vertices()[i].getCoords());
-      findClosest(*input()); // Search inside the input mesh for the output vertex
-      assertion(findClosest.hasFound());
-      const query::ClosestElement& closest = findClosest.getClosest();
-      _weights[i].clear();
-      for (const query::InterpolationElement& elem : closest.interpolationElements) {
-        _weights[i].push_back(elem);
-      }
-    }
+    computeWeights(*output(), *input());
   }
   else {
     assertion(getConstraint() == CONSERVATIVE, getConstraint());
     DEBUG("Compute conservative mapping");
-    _weights.resize(input()->vertices().size());
-    for ( size_t i=0; i < input()->vertices().size(); i++ ){
-      query::FindClosest findClosest(input()->vertices()[i].getCoords());
-      findClosest(*output());
-      assertion(findClosest.hasFound());
-      const query::ClosestElement& closest = findClosest.getClosest();
-      _weights[i].clear();
-      for (const query::InterpolationElement& elem : closest.interpolationElements) {
-        _weights[i].push_back(elem);
-      }
-    }
+    computeWeights(*input(), *output());
   }
+  storeMeshRevisions();
   _hasComputedMapping = true;
 }
 
@@ -72,10 +53,59 @@ bool NearestProjectionMapping:: hasComputedMapping() const
 void NearestProjectionMapping:: clear()
 {
   TRACE();
+  _rowStarts.clear();
+  _columns.clear();
   _weights.clear();
   _hasComputedMapping = false;
 }
 
+void NearestProjectionMapping:: computeWeights
+(
+  const mesh::Mesh& searchMesh,
+  mesh::Mesh&       mesh )
+{
+  size_t rows = searchMesh.vertices().size();
+  _rowStarts.assign(1, 0);
+  _rowStarts.reserve(rows + 1);
+  _columns.clear();
+  _weights.clear();
+  for (size_t i=0; i < rows; i++){
+    query::FindClosest findClosest(searchMesh.vertices()[i].getCoords());
+    findClosest(mesh); // Search inside mesh for the vertex
+    assertion(findClosest.hasFound());
+    for (const query::InterpolationElement& elem : findClosest.getClosest().interpolationElements) {
+      if (elem.weight != 0.0) {
+        _columns.push_back(elem.element->getID());
+        _weights.push_back(elem.weight);
+      }
+    }
+    _rowStarts.push_back(_columns.size());
+  }
+  _columns.shrink_to_fit();
+  _weights.shrink_to_fit();
+}
+
+void NearestProjectionMapping:: multiply
+(
+  const Eigen::VectorXd& inValues,
+  Eigen::VectorXd&       outValues,
+  int                    dimensions,
+  bool                   transpose ) const
+{
+  size_t rows = _rowStarts.size() - 1;
+  for (size_t row=0; row < rows; row++){
+    for (size_t k=_rowStarts[row]; k < _rowStarts[row+1]; k++){
+      size_t inOffset  = (transpose ? row : (size_t)_columns[k]) * dimensions;
+      size_t outOffset = (transpose ? (size_t)_columns[k] : row) * dimensions;
+      assertion(outOffset + dimensions <= (size_t)outValues.size());
+      assertion(inOffset + dimensions <= (size_t)inValues.size());
+      for (int dim=0; dim < dimensions; dim++){
+        outValues(outOffset + dim) += _weights[k] * inValues(inOffset + dim);
+      }
+    }
+  }
+}
+
 void NearestProjectionMapping:: map
 (
   int inputDataID,
@@ -83,7 +113,7 @@ void NearestProjectionMapping:: map
 {
   TRACE(inputDataID, outputDataID);
 
-  precice::utils::Event e("map.np.mapData.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
+  precice::utils::Event e(getEventID(_mapDataEventID, "map.np.mapData"), precice::syncMode);
 
   mesh::PtrData inData = input()->data(inputDataID);
   mesh::PtrData outData = output()->data(outputDataID);
@@ -95,38 +125,16 @@ void NearestProjectionMapping:: map
 
   if (getConstraint() == CONSISTENT){
     DEBUG("Map consistent");
-    assertion(_weights.size() == output()->vertices().size(),
-               _weights.size(), output()->vertices().size());
-    for (size_t i=0; i < output()->vertices().size(); i++){
-      InterpolationElements& elems = _weights[i];
-      size_t outOffset = i * dimensions;
-      for (query::InterpolationElement& elem : elems) {
-        size_t inOffset = (size_t)elem.element->getID() * dimensions;
-        for (int dim=0; dim < dimensions; dim++){
-          assertion(outOffset + dim < (size_t)outValues.size());
-          assertion(inOffset + dim < (size_t)inValues.size());
-          outValues(outOffset + dim) += elem.weight * inValues(inOffset + dim);
-        }
-      }
-    }
+    assertion(_rowStarts.size() == output()->vertices().size() + 1,
+               _rowStarts.size(), output()->vertices().size());
+    multiply(inValues, outValues, dimensions, false);
   }
   else {
     assertion(getConstraint() == CONSERVATIVE, getConstraint());
     DEBUG("Map conservative");
-    assertion(_weights.size() == input()->vertices().size(),
-               _weights.size(), input()->vertices().size());
-    for (size_t i=0; i < input()->vertices().size(); i++){
-      size_t inOffset = i * dimensions;
-      InterpolationElements& elems = _weights[i];
-      for (query::InterpolationElement& elem : elems) {
-        size_t outOffset = (size_t)elem.element->getID() * dimensions;
-        for ( int dim=0; dim < dimensions; dim++ ){
-          assertion(outOffset + dim < (size_t)outValues.size());
-          assertion(inOffset + dim < (size_t)inValues.size());
-          outValues(outOffset + dim) += elem.weight * inValues(inOffset + dim);
-        }
-      }
-    }
+    assertion(_rowStarts.size() == input()->vertices().size() + 1,
+               _rowStarts.size(), input()->vertices().size());
+    multiply(inValues, outValues, dimensions, true);
   }
 }
 
@@ -136,30 +144,14 @@ void NearestProjectionMapping::tagMeshFirstRound()
 
   computeMapping();
 
-  if (getConstraint() == CONSISTENT){
-    for(mesh::Vertex& v : input()->vertices()){
-      for (size_t i=0; i < output()->vertices().size(); i++) {
-        const InterpolationElements& elems = _weights[i];
-        for (const query::InterpolationElement& elem : elems) {
-          if (elem.element->getID()==v.getID() && elem.weight!=0.0) {
-            v.tag();
-          }
-        }
-      }
-    }
+  // All vertices the other mesh is projected onto have a nonzero weight
+  mesh::PtrMesh mesh = getConstraint() == CONSISTENT ? input() : output();
+  std::vector<bool> isInterpolated(mesh->vertices().size(), false);
+  for (int column : _columns) {
+    isInterpolated[column] = true;
   }
-  else {
-    assertion(getConstraint() == CONSERVATIVE, getConstraint());
-    for(mesh::Vertex& v : output()->vertices()){
-      for (size_t i=0; i < input()->vertices().size(); i++) {
-        const InterpolationElements& elems = _weights[i];
-        for (const query::InterpolationElement& elem : elems) {
-          if (elem.element->getID()==v.getID() && elem.weight!=0.0) {
-            v.tag();
-          }
-        }
-      }
-    }
+  for (mesh::Vertex& v : mesh->vertices()) {
+    if (isInterpolated[v.getID()]) v.tag();
   }
 
   clear();
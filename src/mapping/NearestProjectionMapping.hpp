@@ -1,10 +1,8 @@
 #pragma once
 
 #include "Mapping.hpp"
-#include <list>
 #include <vector>
 #include "logging/Logger.hpp"
-#include "query/FindClosest.hpp"
 
 namespace precice {
 namespace mapping {
@@ -51,10 +49,36 @@ public:
 private:
   logging::Logger _log{"mapping::NearestProjectionMapping"};
 
-  using InterpolationElements = std::list<query::InterpolationElement>;
-  std::vector<InterpolationElements> _weights;
+  /**
+   * @brief Interpolation weights in compressed sparse row format.
+   *
+   * There is one row per projected vertex, i.e., per output vertex for a consistent and per input vertex
+   * for a conservative mapping. The columns are the vertices of the mesh that is projected onto.
+   * A consistent mapping multiplies with the matrix, a conservative one with its transpose.
+   */
+  std::vector<size_t> _rowStarts;
+
+  /// Column, i.e., vertex ID, of each weight.
+  std::vector<int> _columns;
+
+  /// Nonzero weights, ordered by row.
+  std::vector<double> _weights;
+
+  /// Projects all vertices of searchMesh onto mesh and stores the interpolation weights.
+  void computeWeights(const mesh::Mesh& searchMesh, mesh::Mesh& mesh);
+
+  /// Adds the product of the weights or their transpose with the input values to the output values.
+  void multiply(
+    const Eigen::VectorXd& inValues,
+    Eigen::VectorXd&       outValues,
+    int                    dimensions,
+    bool                   transpose) const;
 
   bool _hasComputedMapping = false;
+
+  /// Cached event handles, see Mapping::getEventID
+  int _computeMappingEventID = -1;
+  int _mapDataEventID = -1;
 };
 
 }} // namespace precice, mapping
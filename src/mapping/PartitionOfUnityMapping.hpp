@@ -0,0 +1,612 @@
+#pragma once
+
+#include "Mapping.hpp"
+#include "impl/BasisFunctions.hpp"
+#include "mesh/RTree.hpp"
+#include "utils/EventTimings.hpp"
+#include "utils/Parallel.hpp"
+
+#include <Eigen/Core>
+#include <Eigen/QR>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <thread>
+#include <vector>
+
+namespace precice {
+extern bool syncMode;
+
+namespace mapping {
+
+/**
+ * @brief Partition of unity mapping with local radial basis function interpolants.
+ *
+ * The interface is covered by overlapping spherical patches of a given radius, whose
+ * centers lie on a regular grid. For every patch, a small RBF interpolant with a linear
+ * polynomial is constructed from the input vertices inside the patch. The output values
+ * are the sum of the local interpolants, blended with compactly supported weights
+ * (CompactPolynomialC6) that are normalized to sum up to one at each output vertex.
+ *
+ * The patch grid does not depend on the partitioning. An output vertex only depends
+ * on input vertices within twice the patch radius, which is the safety margin used to
+ * filter the received mesh. Hence, no communication besides the partitioning is needed.
+ * The costs grow linearly with the number of patches.
+ *
+ * The radial basis function type has to be given as template parameter, and has
+ * to be one of the defined types in impl/BasisFunctions.hpp.
+ */
+template<typename RADIAL_BASIS_FUNCTION_T>
+class PartitionOfUnityMapping : public Mapping
+{
+public:
+
+  /**
+   * @brief Constructor.
+   *
+   * @param[in] constraint Specifies mapping to be consistent or conservative.
+   * @param[in] dimensions Dimensionality of the meshes
+   * @param[in] function Radial basis function used for the local interpolants.
+   * @param[in] patchRadius Radius of the patches, should contain a few layers of input vertices.
+   * @param[in] xDead, yDead, zDead Deactivates mapping along an axis
+   */
+  PartitionOfUnityMapping (
+    Constraint              constraint,
+    int                     dimensions,
+    RADIAL_BASIS_FUNCTION_T function,
+    double                  patchRadius,
+    bool                    xDead,
+    bool                    yDead,
+    bool                    zDead);
+
+  /// Computes the local interpolants of all patches.
+  virtual void computeMapping() override;
+
+  /// Returns true, if computeMapping() has been called.
+  virtual bool hasComputedMapping() const override;
+
+  /// Removes a computed mapping.
+  virtual void clear() override;
+
+  /// Maps input data to output data from input mesh to output mesh.
+  virtual void map(int inputDataID, int outputDataID) override;
+
+  virtual void tagMeshFirstRound() override;
+
+  virtual void tagMeshSecondRound() override;
+
+private:
+
+  /// A patch with the interpolation from its source to its target vertices.
+  struct Patch {
+    /// Center of the patch, zero along dead axes.
+    Eigen::VectorXd center;
+
+    /// Positions of the vertices the local interpolant is constructed from.
+    std::vector<int> sources;
+
+    /// Positions of the vertices the local interpolant is evaluated at.
+    std::vector<int> targets;
+
+    /// Weighted evaluation of the local interpolant, targets x sources.
+    Eigen::MatrixXd evaluation;
+
+    /// True, if the sources allow for a linear polynomial in the local interpolant.
+    bool linear = false;
+  };
+
+  precice::logging::Logger _log{"mapping::PartitionOfUnityMapping"};
+
+  bool _hasComputedMapping = false;
+
+  /// Cached event handles, see Mapping::getEventID
+  int _computeMappingEventID = -1;
+  int _mapDataEventID = -1;
+
+  /// Radial basis function type used in the local interpolants.
+  RADIAL_BASIS_FUNCTION_T _basisFunction;
+
+  /// Weight function of the patches, its support radius is the patch radius.
+  CompactPolynomialC6 _weightFunction;
+
+  double _patchRadius;
+
+  /// true if the mapping along some axis should be ignored
+  std::vector<bool> _deadAxis;
+
+  std::vector<Patch> _patches;
+
+  /// Deletes all dead directions from fullVector and returns a vector of reduced dimensionality.
+  Eigen::VectorXd reduceVector(const Eigen::VectorXd& fullVector) const;
+
+  /// Creates the patches around all target vertices, without sources.
+  void createPatches(const mesh::Mesh& targetMesh);
+
+  /// Collects the source vertices of all patches and removes patches without sources.
+  void collectSources(const mesh::PtrMesh& sourceMesh);
+
+  /// Restricts patches without linear polynomial to targets that are not covered otherwise.
+  void restrictDegeneratedPatches(int targetSize);
+
+  /// Computes the evaluation matrix of a patch, weighted by the normalized patch weights.
+  void computeEvaluation(
+    Patch&                 patch,
+    const mesh::Mesh&      sourceMesh,
+    const mesh::Mesh&      targetMesh,
+    const Eigen::VectorXd& weightSums);
+
+  /// Tags all vertices of mesh within the margin around the given bounding box.
+  void tagVerticesInBox(mesh::Mesh& mesh, const mesh::Mesh::BoundingBox& bb) const;
+
+  void setDeadAxis(bool xDead, bool yDead, bool zDead)
+  {
+    _deadAxis.resize(getDimensions());
+    if (getDimensions() == 2) {
+      _deadAxis[0] = xDead;
+      _deadAxis[1] = yDead;
+      CHECK(not (xDead && yDead), "You cannot choose all axis to be dead for a RBF mapping");
+      if (zDead)
+        WARN("Setting the z-axis to dead on a 2 dimensional problem has not effect and will be ignored.");
+    }
+    else if (getDimensions() == 3) {
+      _deadAxis[0] = xDead;
+      _deadAxis[1] = yDead;
+      _deadAxis[2] = zDead;
+      CHECK(not (xDead && yDead && zDead), "You cannot choose all axis to be dead for a RBF mapping");
+    }
+    else {
+      assertion(false);
+    }
+  }
+
+};
+
+// --------------------------------------------------- HEADER IMPLEMENTATIONS
+
+template<typename RADIAL_BASIS_FUNCTION_T>
+PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>:: PartitionOfUnityMapping
+(
+  Constraint              constraint,
+  int                     dimensions,
+  RADIAL_BASIS_FUNCTION_T function,
+  double                  patchRadius,
+  bool                    xDead,
+  bool                    yDead,
+  bool                    zDead)
+  :
+  Mapping ( constraint, dimensions ),
+  _basisFunction ( function ),
+  _weightFunction ( patchRadius ),
+  _patchRadius ( patchRadius )
+{
+  setInputRequirement(Mapping::MeshRequirement::VERTEX);
+  setOutputRequirement(Mapping::MeshRequirement::VERTEX);
+  setDeadAxis(xDead, yDead, zDead);
+}
+
+template<typename RADIAL_BASIS_FUNCTION_T>
+void PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>:: computeMapping()
+{
+  TRACE();
+
+  precice::utils::Event e(getEventID(_computeMappingEventID, "map.pu.computeMapping"), precice::syncMode);
+
+  assertion(input()->getDimensions() == output()->getDimensions(),
+            input()->getDimensions(), output()->getDimensions());
+  assertion(getDimensions() == output()->getDimensions(),
+            getDimensions(), output()->getDimensions());
+
+  // The interpolants are constructed on the source mesh and evaluated on the target mesh
+  mesh::PtrMesh sourceMesh = input();
+  mesh::PtrMesh targetMesh = output();
+  if (getConstraint() == CONSERVATIVE){
+    std::swap(sourceMesh, targetMesh);
+  }
+
+  _patches.clear();
+  if (not targetMesh->vertices().empty()) {
+    createPatches(*targetMesh);
+    collectSources(sourceMesh);
+    restrictDegeneratedPatches(targetMesh->vertices().size());
+
+    Eigen::VectorXd weightSums = Eigen::VectorXd::Zero(targetMesh->vertices().size());
+    for (const Patch& patch : _patches) {
+      for (int target : patch.targets) {
+        weightSums[target] += _weightFunction.evaluate(
+            reduceVector(targetMesh->vertices()[target].getCoords() - patch.center).norm());
+      }
+    }
+    for (int i = 0; i < weightSums.size(); i++) {
+      CHECK(weightSums[i] > 0.0, "No input vertex of mesh \"" << sourceMesh->getName()
+            << "\" is within the patch radius " << _patchRadius << " of vertex "
+            << targetMesh->vertices()[i].getCoords() << " of mesh \"" << targetMesh->getName()
+            << "\". Please increase the patch radius.");
+    }
+
+    // The patches only share the read-only weightSums, hence they are split into contiguous chunks
+    // on several threads. Ranks usually occupy all cores of a node, threads only pay off for idle cores.
+    size_t const minPatchesPerThread = 100;
+    size_t threads = std::thread::hardware_concurrency() / utils::Parallel::getCommunicatorSize();
+    threads = std::max<size_t>(1, std::min(threads, _patches.size() / minPatchesPerThread));
+    DEBUG("Computing the evaluation of " << _patches.size() << " patches on " << threads << " threads");
+
+    auto computeChunk = [&](size_t chunk) {
+      size_t const chunkEnd = _patches.size() * (chunk + 1) / threads;
+      for (size_t i = _patches.size() * chunk / threads; i < chunkEnd; i++) {
+        computeEvaluation(_patches[i], *sourceMesh, *targetMesh, weightSums);
+      }
+    };
+    std::vector<std::thread> workers;
+    for (size_t chunk = 1; chunk < threads; chunk++) {
+      workers.emplace_back(computeChunk, chunk);
+    }
+    computeChunk(0);
+    for (std::thread& worker : workers) {
+      worker.join();
+    }
+  }
+  DEBUG("Computed " << _patches.size() << " patches");
+
+  storeMeshRevisions();
+  _hasComputedMapping = true;
+}
+
+template<typename RADIAL_BASIS_FUNCTION_T>
+bool PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>:: hasComputedMapping() const
+{
+  return _hasComputedMapping;
+}
+
+template<typename RADIAL_BASIS_FUNCTION_T>
+void PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>:: clear()
+{
+  TRACE();
+  _patches.clear();
+  _hasComputedMapping = false;
+}
+
+template<typename RADIAL_BASIS_FUNCTION_T>
+void PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>:: map
+(
+  int inputDataID,
+  int outputDataID )
+{
+  TRACE(inputDataID, outputDataID);
+
+  precice::utils::Event e(getEventID(_mapDataEventID, "map.pu.mapData"), precice::syncMode);
+
+  assertion(_hasComputedMapping);
+  const Eigen::VectorXd& inValues = input()->data(inputDataID)->values();
+  Eigen::VectorXd& outValues = output()->data(outputDataID)->values();
+  int valueDim = input()->data(inputDataID)->getDimensions();
+  assertion(valueDim == output()->data(outputDataID)->getDimensions(),
+            valueDim, output()->data(outputDataID)->getDimensions());
+
+  outValues.setZero();
+  Eigen::MatrixXd in;
+  Eigen::MatrixXd out;
+  for (const Patch& patch : _patches) {
+    // Consistent: sources are input vertices, conservative: targets are input vertices
+    const std::vector<int>& inVertices  = getConstraint() == CONSISTENT ? patch.sources : patch.targets;
+    const std::vector<int>& outVertices = getConstraint() == CONSISTENT ? patch.targets : patch.sources;
+
+    in.resize(inVertices.size(), valueDim);
+    for (size_t i = 0; i < inVertices.size(); i++) {
+      for (int dim = 0; dim < valueDim; dim++) {
+        in(i, dim) = inValues(inVertices[i] * valueDim + dim);
+      }
+    }
+
+    if (getConstraint() == CONSISTENT){
+      out.noalias() = patch.evaluation * in;
+    }
+    else {
+      out.noalias() = patch.evaluation.transpose() * in;
+    }
+
+    for (size_t i = 0; i < outVertices.size(); i++) {
+      for (int dim = 0; dim < valueDim; dim++) {
+        outValues(outVertices[i] * valueDim + dim) += out(i, dim);
+      }
+    }
+  }
+}
+
+template<typename RADIAL_BASIS_FUNCTION_T>
+void PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>:: createPatches
+(
+  const mesh::Mesh& targetMesh )
+{
+  TRACE(targetMesh.vertices().size());
+  int dimensions = getDimensions();
+  int liveDimensions = 0;
+  for (int d = 0; d < dimensions; d++) {
+    if (not _deadAxis[d]) liveDimensions++;
+  }
+  // The center of the closest patch is at most 2/3 of the patch radius away from any point
+  double spacing = 4.0 * _patchRadius / (3.0 * std::sqrt(liveDimensions));
+
+  std::map<std::array<long, 3>, int> patchIndices;
+  std::array<long, 3> lower {{0, 0, 0}};
+  std::array<long, 3> upper {{0, 0, 0}};
+  Eigen::VectorXd center(dimensions);
+  for (size_t position = 0; position < targetMesh.vertices().size(); position++) {
+    const Eigen::VectorXd& coords = targetMesh.vertices()[position].getCoords();
+    for (int d = 0; d < dimensions; d++) {
+      if (not _deadAxis[d]) {
+        lower[d] = static_cast<long>(std::ceil((coords[d] - _patchRadius) / spacing));
+        upper[d] = static_cast<long>(std::floor((coords[d] + _patchRadius) / spacing));
+      }
+    }
+    // Visits all grid points in the bounding box of the sphere around the vertex
+    std::array<long, 3> index = lower;
+    while (true) {
+      for (int d = 0; d < dimensions; d++) {
+        center[d] = _deadAxis[d] ? 0.0 : index[d] * spacing;
+      }
+      if (reduceVector(coords - center).norm() < _patchRadius) {
+        auto inserted = patchIndices.emplace(index, _patches.size());
+        if (inserted.second) {
+          _patches.emplace_back();
+          _patches.back().center = center;
+        }
+        _patches[inserted.first->second].targets.push_back(position);
+      }
+      int d = 0;
+      while (d < dimensions && index[d] == upper[d]) {
+        index[d] = lower[d];
+        d++;
+      }
+      if (d == dimensions)
+        break;
+      index[d]++;
+    }
+  }
+}
+
+template<typename RADIAL_BASIS_FUNCTION_T>
+void PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>:: collectSources
+(
+  const mesh::PtrMesh& sourceMesh )
+{
+  TRACE(sourceMesh->vertices().size());
+  namespace bg = boost::geometry;
+  auto tree = mesh::rtree::getVertexRTree(sourceMesh);
+
+  for (Patch& patch : _patches) {
+    // The tree indexes vertices as 3d points, unused or dead axes are not restricted
+    mesh::Box3d box;
+    std::array<double, 3> minCorner {{std::numeric_limits<double>::lowest(),
+                                      std::numeric_limits<double>::lowest(),
+                                      std::numeric_limits<double>::lowest()}};
+    std::array<double, 3> maxCorner {{std::numeric_limits<double>::max(),
+                                      std::numeric_limits<double>::max(),
+                                      std::numeric_limits<double>::max()}};
+    for (int d = 0; d < getDimensions(); d++) {
+      if (not _deadAxis[d]) {
+        minCorner[d] = patch.center[d] - _patchRadius;
+        maxCorner[d] = patch.center[d] + _patchRadius;
+      }
+    }
+    bg::set<bg::min_corner, 0>(box, minCorner[0]);
+    bg::set<bg::min_corner, 1>(box, minCorner[1]);
+    bg::set<bg::min_corner, 2>(box, minCorner[2]);
+    bg::set<bg::max_corner, 0>(box, maxCorner[0]);
+    bg::set<bg::max_corner, 1>(box, maxCorner[1]);
+    bg::set<bg::max_corner, 2>(box, maxCorner[2]);
+
+    std::vector<size_t> results;
+    tree->query(bg::index::within(box) and bg::index::satisfies([&](size_t const i){
+          return reduceVector(sourceMesh->vertices()[i].getCoords() - patch.center).norm() < _patchRadius;}),
+      std::back_inserter(results));
+    patch.sources.assign(results.begin(), results.end());
+    std::sort(patch.sources.begin(), patch.sources.end());
+  }
+
+  _patches.erase(std::remove_if(_patches.begin(), _patches.end(),
+                                [](const Patch& patch){ return patch.sources.empty(); }),
+                 _patches.end());
+
+  // A linear polynomial needs sources that are not all on a line (2D) or plane (3D)
+  for (Patch& patch : _patches) {
+    int liveDimensions = reduceVector(patch.center).size();
+    Eigen::MatrixXd polynomial(patch.sources.size(), 1 + liveDimensions);
+    for (size_t i = 0; i < patch.sources.size(); i++) {
+      polynomial(i, 0) = 1.0;
+      polynomial.block(i, 1, 1, liveDimensions) =
+          reduceVector(sourceMesh->vertices()[patch.sources[i]].getCoords() - patch.center).transpose();
+    }
+    patch.linear = polynomial.colPivHouseholderQr().rank() == 1 + liveDimensions;
+  }
+}
+
+template<typename RADIAL_BASIS_FUNCTION_T>
+void PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>:: restrictDegeneratedPatches
+(
+  int targetSize )
+{
+  // Degenerated patches, e.g. at the boundary of the source mesh, would spoil the linear
+  // consistency of their neighbors, hence they are only used where no other patch exists.
+  std::vector<bool> covered(targetSize, false);
+  for (const Patch& patch : _patches) {
+    if (patch.linear) {
+      for (int target : patch.targets) {
+        covered[target] = true;
+      }
+    }
+  }
+  for (Patch& patch : _patches) {
+    if (not patch.linear) {
+      patch.targets.erase(std::remove_if(patch.targets.begin(), patch.targets.end(),
+                                         [&](int target){ return covered[target]; }),
+                          patch.targets.end());
+    }
+  }
+  _patches.erase(std::remove_if(_patches.begin(), _patches.end(),
+                                [](const Patch& patch){ return patch.targets.empty(); }),
+                 _patches.end());
+}
+
+template<typename RADIAL_BASIS_FUNCTION_T>
+void PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>:: computeEvaluation
+(
+  Patch&                 patch,
+  const mesh::Mesh&      sourceMesh,
+  const mesh::Mesh&      targetMesh,
+  const Eigen::VectorXd& weightSums)
+{
+  int sourceSize = patch.sources.size();
+  int targetSize = patch.targets.size();
+  int liveDimensions = reduceVector(patch.center).size();
+
+  // Local coordinates relative to the patch center, to keep the polynomial well-conditioned
+  Eigen::MatrixXd sourceCoords(liveDimensions, sourceSize);
+  for (int i = 0; i < sourceSize; i++) {
+    sourceCoords.col(i) = reduceVector(sourceMesh.vertices()[patch.sources[i]].getCoords() - patch.center);
+  }
+  Eigen::MatrixXd targetCoords(liveDimensions, targetSize);
+  for (int i = 0; i < targetSize; i++) {
+    targetCoords.col(i) = reduceVector(targetMesh.vertices()[patch.targets[i]].getCoords() - patch.center);
+  }
+
+  // Uses a linear polynomial if possible, and falls back to a constant one for degenerated patches
+  Eigen::ColPivHouseholderQR<Eigen::MatrixXd> qr;
+  int polyparams = 1 + liveDimensions;
+  if (patch.linear) {
+    Eigen::MatrixXd matrixC = Eigen::MatrixXd::Zero(sourceSize + polyparams, sourceSize + polyparams);
+    for (int i = 0; i < sourceSize; i++) {
+      for (int j = i; j < sourceSize; j++) {
+        matrixC(i, j) = matrixC(j, i) = _basisFunction.evaluate((sourceCoords.col(i) - sourceCoords.col(j)).norm());
+      }
+    }
+    matrixC.block(0, sourceSize, sourceSize, 1).setOnes();
+    matrixC.block(0, sourceSize + 1, sourceSize, liveDimensions) = sourceCoords.transpose();
+    matrixC.block(sourceSize, 0, polyparams, sourceSize) = matrixC.block(0, sourceSize, sourceSize, polyparams).transpose();
+    qr.compute(matrixC);
+  }
+  if (not patch.linear or not qr.isInvertible()) {
+    polyparams = 1;
+    Eigen::MatrixXd matrixC = Eigen::MatrixXd::Zero(sourceSize + polyparams, sourceSize + polyparams);
+    for (int i = 0; i < sourceSize; i++) {
+      for (int j = i; j < sourceSize; j++) {
+        matrixC(i, j) = matrixC(j, i) = _basisFunction.evaluate((sourceCoords.col(i) - sourceCoords.col(j)).norm());
+      }
+    }
+    matrixC.block(0, sourceSize, sourceSize, 1).setOnes();
+    matrixC.block(sourceSize, 0, 1, sourceSize).setOnes();
+    qr.compute(matrixC);
+    CHECK(qr.isInvertible(), "Local interpolation matrix of the patch at " << patch.center
+          << " is not invertible.");
+  }
+
+  Eigen::MatrixXd matrixA(targetSize, sourceSize + polyparams);
+  for (int i = 0; i < targetSize; i++) {
+    for (int j = 0; j < sourceSize; j++) {
+      matrixA(i, j) = _basisFunction.evaluate((targetCoords.col(i) - sourceCoords.col(j)).norm());
+    }
+    matrixA(i, sourceSize) = 1.0;
+    if (polyparams > 1) {
+      matrixA.block(i, sourceSize + 1, 1, liveDimensions) = targetCoords.col(i).transpose();
+    }
+  }
+
+  // A C^-1 restricted to the source values, C is symmetric
+  patch.evaluation = qr.solve(matrixA.transpose()).topRows(sourceSize).transpose();
+  for (int i = 0; i < targetSize; i++) {
+    double weight = _weightFunction.evaluate(targetCoords.col(i).norm()) / weightSums[patch.targets[i]];
+    patch.evaluation.row(i) *= weight;
+  }
+}
+
+template<typename RADIAL_BASIS_FUNCTION_T>
+Eigen::VectorXd PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::reduceVector
+(
+  const Eigen::VectorXd& fullVector) const
+{
+  int deadDimensions = 0;
+  for (int d = 0; d < getDimensions(); d++) {
+    if (_deadAxis[d])
+      deadDimensions +=1;
+  }
+  assertion(getDimensions()>deadDimensions, getDimensions(), deadDimensions);
+  Eigen::VectorXd reducedVector(getDimensions()-deadDimensions);
+  int k = 0;
+  for (int d = 0; d < getDimensions(); d++) {
+    if (not _deadAxis[d]) {
+      reducedVector[k] = fullVector[d];
+      k++;
+    }
+  }
+  return reducedVector;
+}
+
+template<typename RADIAL_BASIS_FUNCTION_T>
+void PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::tagVerticesInBox
+(
+  mesh::Mesh&                    mesh,
+  const mesh::Mesh::BoundingBox& bb) const
+{
+  // Patches around a vertex reach up to twice the patch radius
+  double margin = 2.0 * _patchRadius;
+  for (mesh::Vertex& v : mesh.vertices()) {
+    bool isInside = true;
+    for (int d = 0; d < v.getDimensions(); d++) {
+      if (_deadAxis[d])
+        continue;
+      if (v.getCoords()[d] < bb[d].first - margin or
+          v.getCoords()[d] > bb[d].second + margin) {
+        isInside = false;
+        break;
+      }
+    }
+    if (isInside)
+      v.tag();
+  }
+}
+
+template<typename RADIAL_BASIS_FUNCTION_T>
+void PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::tagMeshFirstRound()
+{
+  TRACE();
+  mesh::PtrMesh filterMesh, otherMesh;
+  if (getConstraint() == CONSISTENT){
+    filterMesh = input(); // remote
+    otherMesh = output(); // local
+  }
+  else {
+    filterMesh = output(); // remote
+    otherMesh = input(); // local
+  }
+
+  if (otherMesh->vertices().size() == 0)
+      return; // Ranks not at the interface should never hold interface vertices
+
+  tagVerticesInBox(*filterMesh, otherMesh->getBoundingBox());
+}
+
+template<typename RADIAL_BASIS_FUNCTION_T>
+void PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::tagMeshSecondRound()
+{
+  TRACE();
+  mesh::PtrMesh mesh = getConstraint() == CONSISTENT ? input() : output(); // The mesh we want to filter
+
+  mesh::Mesh::BoundingBox bb(mesh->getDimensions(),
+                             std::make_pair(std::numeric_limits<double>::max(),
+                                            std::numeric_limits<double>::lowest()));
+
+  // Construct bounding box around all owned vertices
+  for (mesh::Vertex& v : mesh->vertices()) {
+    if (v.isOwner()) {
+      assertion(v.isTagged()); // Should be tagged from the first round
+      for (int d = 0; d < v.getDimensions(); d++) {
+        bb[d].first  = std::min(v.getCoords()[d], bb[d].first);
+        bb[d].second = std::max(v.getCoords()[d], bb[d].second);
+      }
+    }
+  }
+  tagVerticesInBox(*mesh, bb);
+}
+
+}} // namespace precice, mapping
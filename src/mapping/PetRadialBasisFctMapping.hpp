@@ -3,8 +3,11 @@
 
 #include "mapping/Mapping.hpp"
 
+#include <algorithm>
+#include <cmath>
 #include <map>
 #include <numeric>
+#include <thread>
 
 #include "versions.hpp"
 #include "mesh/RTree.hpp"
@@ -14,6 +17,7 @@
 #include "utils/Petsc.hpp"
 namespace petsc = precice::utils::petsc;
 #include "utils/EventTimings.hpp"
+#include "utils/MasterSlave.hpp"
 
 // Forward declaration to friend the boost test struct
 namespace MappingTests {
@@ -58,6 +62,8 @@ public:
    * @param[in] solverRtol Relative tolerance for the linear solver.
    * @param[in] polynomial Type of polynomial augmentation
    * @param[in] preallocation Sets kind of preallocation of matrices.
+   * @param[in] warmStart Keeps the preconditioner and previous solutions when the mapping is updated.
+   * @param[in] preconditioner Preconditioner of the system matrix solver.
    *
    * For description on convergence testing and meaning of solverRtol see http://www.mcs.anl.gov/petsc/petsc-current/docs/manualpages/KSP/KSPConvergedDefault.html#KSPConvergedDefault
    */
@@ -70,7 +76,9 @@ public:
     bool                    zDead,
     double                  solverRtol = 1e-9,
     Polynomial              polynomial = Polynomial::SEPARATE,
-    Preallocation           preallocation = Preallocation::TREE);
+    Preallocation           preallocation = Preallocation::TREE,
+    bool                    warmStart = false,
+    Preconditioner          preconditioner = Preconditioner::DEFAULT);
 
   /// Deletes the PETSc objects and the _deadAxis array
   virtual ~PetRadialBasisFctMapping();
@@ -84,6 +92,14 @@ public:
   /// Removes a computed mapping.
   virtual void clear() override;
 
+  /**
+   * @brief Recomputes the mapping after the input or output mesh changed.
+   *
+   * If warm start is enabled and the number of vertices did not change, the preconditioner
+   * of the previous computation is reused and previous solutions serve as initial guesses.
+   */
+  virtual void updateMapping() override;
+
   /// Maps input data to output data from input mesh to output mesh.
   virtual void map(int inputDataID, int outputDataID) override;
 
@@ -95,13 +111,102 @@ public:
 
 private:
 
-  /// Stores col -> value for each row. Used to return the already computed values from the preconditioning
-  using VertexData = std::vector<std::vector<std::pair<int, double>>>;
+  /// Stores the entries of the local rows, computed during preallocation, in compressed row storage.
+  /*
+   * Column indices are already mapped to the PETSc ordering and the basis function is evaluated,
+   * such that the rows can be passed to MatSetValues as they are.
+   */
+  struct VertexData
+  {
+    /// Position of the first entry of each row, the last element is the total number of entries
+    std::vector<size_t> rowStarts{0};
+    std::vector<PetscInt> cols;
+    std::vector<PetscScalar> values;
+
+    void push_back(PetscInt col, PetscScalar value)
+    {
+      cols.push_back(col);
+      values.push_back(value);
+    }
+
+    /// Closes the current row, entries pushed afterwards belong to the next row
+    void finishRow()
+    {
+      rowStarts.push_back(cols.size());
+    }
+
+    /// Sets the entries of a local row in the given global row of matrix
+    PetscErrorCode setRow(petsc::Matrix & matrix, size_t localRow, PetscInt globalRow) const
+    {
+      PetscInt size = rowStarts[localRow + 1] - rowStarts[localRow];
+      return MatSetValues(matrix, 1, &globalRow, size, cols.data() + rowStarts[localRow],
+                          values.data() + rowStarts[localRow], INSERT_VALUES);
+    }
+
+    /// Exchanges the entries with other, swapping with an empty VertexData frees the memory
+    void swap(VertexData & other)
+    {
+      rowStarts.swap(other.rowStarts);
+      cols.swap(other.cols);
+      values.swap(other.values);
+    }
+
+    /// Releases excess capacity after all rows are added
+    void shrink()
+    {
+      rowStarts.shrink_to_fit();
+      cols.shrink_to_fit();
+      values.shrink_to_fit();
+    }
+
+    /// Number of rows finished so far
+    size_t rows() const
+    {
+      return rowStarts.size() - 1;
+    }
+  };
+
+  /// Computes the rows of a VertexData in contiguous chunks on several threads.
+  /*
+   * computeRow(row, chunk, candidates) pushes the entries of a row to the VertexData of its chunk,
+   * candidates is a buffer owned by the thread. consumeChunk(chunk) is called on the calling thread
+   * for each chunk in the order of the rows, since neither AOApplicationToPetsc nor MatSetValues are
+   * thread-safe. The rows are computed in batches and each chunk is freed once it is consumed, such
+   * that at most one batch of unconsumed rows is held in memory.
+   */
+  template<typename ROW_FUNCTION_T, typename CONSUME_FUNCTION_T>
+  void computeRowsThreaded(size_t rows, ROW_FUNCTION_T computeRow, CONSUME_FUNCTION_T consumeChunk) const;
+
+  /// Distance between two vertices, ignoring the dead axes
+  double deadAxisDistance(const mesh::Vertex& a, const mesh::Vertex& b) const
+  {
+    double squaredDistance = 0;
+    for (int d = 0; d < a.getDimensions(); d++) {
+      if (not _deadAxis[d]) {
+        double const difference = a.getCoords()[d] - b.getCoords()[d];
+        squaredDistance += difference * difference;
+      }
+    }
+    return std::sqrt(squaredDistance);
+  }
   
   mutable logging::Logger _log{"mapping::PetRadialBasisFctMapping"};
 
   bool _hasComputedMapping = false;
 
+  /// Cached event handles, see Mapping::getEventID
+  int _computeMappingEventID = -1;
+  int _fillCEventID = -1;
+  int _fillAEventID = -1;
+  int _postFillEventID = -1;
+  int _mapDataEventID = -1;
+  int _solveConservativeEventID = -1;
+  int _solveConsistentEventID = -1;
+  int _solveRescalingEventID = -1;
+  int _solvePolynomialEventID = -1;
+  int _preallocCEventID = -1;
+  int _preallocAEventID = -1;
+
   /// Radial basis function type used in interpolation.
   RADIAL_BASIS_FUNCTION_T _basisFunction;
 
@@ -157,6 +262,37 @@ private:
   /// Toggles use of preallocation for matrix C and A
   const Preallocation _preallocation;
 
+  /// Toggles reuse of the solver state in updateMapping()
+  const bool _warmStart;
+
+  /// Number of input and output vertices at the last computation, to decide on a warm start
+  size_t _inputSize = 0;
+  size_t _outputSize = 0;
+
+  /// Preconditioner of the system matrix solver
+  const Preconditioner _preconditioner;
+
+  /// Shift and scaling of the coordinates in the polynomial basis, per dimension
+  Eigen::VectorXd _polynomialShift;
+  Eigen::VectorXd _polynomialScale;
+
+  /// Centers and scales the separated polynomial basis to the input mesh.
+  /*
+   * This acts as a right preconditioner for the least-squares problem of the separated polynomial,
+   * whose columns otherwise differ by orders of magnitude for meshes away from the origin.
+   * The space of polynomials and thus the mapping is not changed.
+   */
+  void computePolynomialScaling(const mesh::PtrMesh inMesh);
+
+  /// Returns a coordinate of a vertex in the (scaled) polynomial basis
+  double polynomialCoordinate(const mesh::Vertex& vertex, int dim) const
+  {
+    return (vertex.getCoords()[dim] - _polynomialShift[dim]) / _polynomialScale[dim];
+  }
+
+  /// Sets up the configured preconditioner of the system matrix solver.
+  void configurePreconditioner();
+
   void estimatePreallocationMatrixC(int rows, int cols, mesh::PtrMesh mesh);
 
   void estimatePreallocationMatrixA(int rows, int cols, mesh::PtrMesh mesh);
@@ -175,6 +311,10 @@ private:
   VertexData savedPreallocationMatrixA(const mesh::PtrMesh inMesh, const mesh::PtrMesh outMesh);
 
   /// Preallocate matrix C and saves the coefficients using a boost::geometry spatial tree for neighbor search
+  /*
+   * The neighbor search and the evaluation of the basis function run on several threads,
+   * see computeRowsThreaded().
+   */
   VertexData bgPreallocationMatrixC(const mesh::PtrMesh inMesh);
 
   VertexData bgPreallocationMatrixA(const mesh::PtrMesh inMesh, const mesh::PtrMesh outMesh);
@@ -194,7 +334,9 @@ PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::PetRadialBasisFctMapping
   bool                    zDead,
   double                  solverRtol,
   Polynomial              polynomial,
-  Preallocation           preallocation)
+  Preallocation           preallocation,
+  bool                    warmStart,
+  Preconditioner          preconditioner)
   :
   Mapping ( constraint, dimensions ),
   _basisFunction ( function ),
@@ -207,7 +349,9 @@ PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::PetRadialBasisFctMapping
   _AOmapping(nullptr),
   _solverRtol(solverRtol),
   _polynomial(polynomial),
-  _preallocation(preallocation)
+  _preallocation(preallocation),
+  _warmStart(warmStart),
+  _preconditioner(preconditioner)
 {
   setInputRequirement(Mapping::MeshRequirement::VERTEX);
   setOutputRequirement(Mapping::MeshRequirement::VERTEX);
@@ -251,9 +395,31 @@ template<typename RADIAL_BASIS_FUNCTION_T>
 void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::computeMapping()
 {
   TRACE();
-  precice::utils::Event e("map.pet.computeMapping.From" + input()->getName() + "To"+ output()->getName(), precice::syncMode);
+  precice::utils::Event e(getEventID(_computeMappingEventID, "map.pet.computeMapping"), precice::syncMode);
+
+  // Keep the solver and the previous solutions, if vertices moved only. All ranks need to agree on that.
+  bool warmStart = false;
+  if (_warmStart and _hasComputedMapping) {
+    int sizeChanged = input()->vertices().size() != _inputSize or output()->vertices().size() != _outputSize;
+    int anySizeChanged = sizeChanged;
+    utils::MasterSlave::allreduceSum(sizeChanged, anySizeChanged, 1);
+    warmStart = anySizeChanged == 0;
+  }
 
-  clear();
+  if (warmStart) {
+    DEBUG("Reusing preconditioner and previous solutions.");
+    _matrixC.reset();
+    _matrixA.reset();
+    _matrixQ.reset();
+    _matrixV.reset();
+    _QRsolver.reset();
+    petsc::destroy(&_AOmapping);
+  }
+  else {
+    clear();
+  }
+  _inputSize = input()->vertices().size();
+  _outputSize = output()->vertices().size();
 
   if (_polynomial == Polynomial::ON) {
     DEBUG("Using integrated polynomial.");
@@ -279,6 +445,8 @@ void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::computeMapping()
     outMesh = output();
   }
 
+  computePolynomialScaling(inMesh);
+
   // Indizes that are used to build the Petsc AO mapping
   std::vector<PetscInt> myIndizes;
 
@@ -350,7 +518,7 @@ void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::computeMapping()
 
   // -- BEGIN FILL LOOP FOR MATRIX C --
   DEBUG("Begin filling matrix C");
-  precice::utils::Event eFillC("map.pet.fillC.From" + input()->getName() + "To"+ output()->getName(), precice::syncMode);
+  precice::utils::Event eFillC(getEventID(_fillCEventID, "map.pet.fillC"), precice::syncMode);
 
   // We collect entries for each row and set them blockwise using MatSetValues.
   int preallocRow = 0;
@@ -359,20 +527,18 @@ void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::computeMapping()
     if (not inVertex.isOwner())
       continue;
 
-    PetscInt const idxSize = std::max(_matrixC.getSize().second, _matrixQ.getSize().second);
-    PetscInt colNum = 0;  // holds the number of columns
-    PetscInt colIdx[idxSize];     // holds the columns indices of the entries
-    PetscScalar rowVals[idxSize]; // holds the values of the entries
-    
     // -- SETS THE POLYNOMIAL PART OF THE MATRIX --
     if (_polynomial == Polynomial::ON or _polynomial == Polynomial::SEPARATE) {
+      PetscInt colNum = 0;  // holds the number of columns
+      PetscInt colIdx[4];     // holds the columns indices of the entries, at most 1 + dimensions
+      PetscScalar rowVals[4]; // holds the values of the entries
       colIdx[colNum] = colNum;
       rowVals[colNum++] = 1;
 
       for (int dim = 0; dim < dimensions; dim++) {
         if (not _deadAxis[dim]) {
           colIdx[colNum] = colNum;
-          rowVals[colNum++] = inVertex.getCoords()[dim];
+          rowVals[colNum++] = polynomialCoordinate(inVertex, dim);
         }
       }
 
@@ -383,19 +549,18 @@ void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::computeMapping()
       else if (_polynomial == Polynomial::SEPARATE) {
         ierr = MatSetValues(_matrixQ, 1, &row, colNum, colIdx, rowVals, INSERT_VALUES); CHKERRV(ierr);
       }
-      colNum = 0;
     }
 
     // -- SETS THE COEFFICIENTS --
     if (_preallocation == Preallocation::SAVE or _preallocation == Preallocation::TREE) {
-      const auto & rowVertices = vertexData[preallocRow];
-      for (const auto & vertex : rowVertices) {
-        rowVals[colNum] = _basisFunction.evaluate(vertex.second);
-        colIdx[colNum++] = vertex.first;
-      }
+      ierr = vertexData.setRow(_matrixC, preallocRow, row); CHKERRV(ierr);
       ++preallocRow;
     }
     else {
+      PetscInt const idxSize = _matrixC.getSize().second;
+      PetscInt colNum = 0;  // holds the number of columns
+      PetscInt colIdx[idxSize];     // holds the columns indices of the entries
+      PetscScalar rowVals[idxSize]; // holds the values of the entries
       for (const mesh::Vertex& vj : inMesh->vertices()) {
         int col = vj.getGlobalIndex() + polyparams;
         if (row > col)
@@ -412,9 +577,9 @@ void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::computeMapping()
           colIdx[colNum++] = col; // column of entry is the globalIndex
         }
       }
+      ierr = AOApplicationToPetsc(_AOmapping, colNum, colIdx); CHKERRV(ierr);
+      ierr = MatSetValues(_matrixC, 1, &row, colNum, colIdx, rowVals, INSERT_VALUES); CHKERRV(ierr);
     }
-    ierr = AOApplicationToPetsc(_AOmapping, colNum, colIdx); CHKERRV(ierr);
-    ierr = MatSetValues(_matrixC, 1, &row, colNum, colIdx, rowVals, INSERT_VALUES); CHKERRV(ierr);
     ++row;
   }
   DEBUG("Finished filling Matrix C");
@@ -429,6 +594,7 @@ void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::computeMapping()
   // Begin assembly here, all assembly is ended at the end of this function.
   ierr = MatAssemblyBegin(_matrixC, MAT_FINAL_ASSEMBLY); CHKERRV(ierr);
   ierr = MatAssemblyBegin(_matrixQ, MAT_FINAL_ASSEMBLY); CHKERRV(ierr);
+  vertexData = VertexData(); // Frees the entries of C before the ones of A are computed
 
   if (_preallocation == Preallocation::SAVE) {
     vertexData = savedPreallocationMatrixA(inMesh, outMesh);
@@ -445,7 +611,7 @@ void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::computeMapping()
 
   // -- BEGIN FILL LOOP FOR MATRIX A --
   DEBUG("Begin filling matrix A.");
-  precice::utils::Event eFillA("map.pet.fillA.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
+  precice::utils::Event eFillA(getEventID(_fillAEventID, "map.pet.fillA"), precice::syncMode);
 
   for (PetscInt row = ownerRangeABegin; row < ownerRangeAEnd; ++row) {
     mesh::Vertex const & oVertex = outMesh->vertices()[row - _matrixA.ownerRange().first];
@@ -463,25 +629,20 @@ void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::computeMapping()
         for (int dim = 0; dim < dimensions; dim++) {
           if (not _deadAxis[dim]) {
             colIdx[colNum] = colNum;
-            rowVals[colNum++] = oVertex.getCoords()[dim];
+            rowVals[colNum++] = polynomialCoordinate(oVertex, dim);
           }
         }
         ierr = MatSetValues(*m, 1, &row, colNum, colIdx, rowVals, INSERT_VALUES); CHKERRV(ierr);
     }
     
     // -- SETS THE COEFFICIENTS --
-    PetscInt colNum = 0;
-    PetscInt colIdx[_matrixA.getSize().second];     // holds the columns indices of the entries
-    PetscScalar rowVals[_matrixA.getSize().second]; // holds the values of the entries
-
     if (_preallocation == Preallocation::SAVE or _preallocation == Preallocation::TREE) {
-      const auto & rowVertices = vertexData[row - ownerRangeABegin];
-      for (const auto & vertex : rowVertices) {
-        rowVals[colNum] = _basisFunction.evaluate(vertex.second);
-        colIdx[colNum++] = vertex.first;
-      }
+      ierr = vertexData.setRow(_matrixA, row - ownerRangeABegin, row); CHKERRV(ierr);
     }
     else {
+      PetscInt colNum = 0;
+      PetscInt colIdx[_matrixA.getSize().second];     // holds the columns indices of the entries
+      PetscScalar rowVals[_matrixA.getSize().second]; // holds the values of the entries
       for (const mesh::Vertex& inVertex : inMesh->vertices()) {
         distance = oVertex.getCoords() - inVertex.getCoords();
         for (int d = 0; d < dimensions; d++) {
@@ -494,15 +655,15 @@ void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::computeMapping()
           colIdx[colNum++] = inVertex.getGlobalIndex() + polyparams;
         }
       }
+      ierr = AOApplicationToPetsc(_AOmapping, colNum, colIdx); CHKERRV(ierr);
+      ierr = MatSetValues(_matrixA, 1, &row, colNum, colIdx, rowVals, INSERT_VALUES); CHKERRV(ierr);
     }
-    ierr = AOApplicationToPetsc(_AOmapping, colNum, colIdx); CHKERRV(ierr);
-    ierr = MatSetValues(_matrixA, 1, &row, colNum, colIdx, rowVals, INSERT_VALUES); CHKERRV(ierr);
   }
   DEBUG("Finished filling Matrix A");
   eFillA.stop();
   // -- END FILL LOOP FOR MATRIX A --
 
-  precice::utils::Event ePostFill("map.pet.postFill.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
+  precice::utils::Event ePostFill(getEventID(_postFillEventID, "map.pet.postFill"), precice::syncMode);
 
   ierr = MatAssemblyBegin(_matrixA, MAT_FINAL_ASSEMBLY); CHKERRV(ierr);
 
@@ -525,7 +686,10 @@ void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::computeMapping()
   KSPSetOperators(_solver, _matrixC, _matrixC); CHKERRV(ierr);
   KSPSetTolerances(_solver, _solverRtol, PETSC_DEFAULT, PETSC_DEFAULT, PETSC_DEFAULT);
   KSPSetInitialGuessNonzero(_solver, PETSC_TRUE); CHKERRV(ierr); // Reuse the results from the last iteration, held in the out vector.
-  KSPSetFromOptions(_solver);
+  ierr = KSPSetReusePreconditioner(_solver, warmStart ? PETSC_TRUE : PETSC_FALSE); CHKERRV(ierr);
+  if (not warmStart) {
+    configurePreconditioner();
+  }
 
   // if (totalNNZ > static_cast<size_t>(20*n)) {
   //   DEBUG("Using Cholesky decomposition as direct solver for dense matrix.");
@@ -539,12 +703,17 @@ void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::computeMapping()
   // -- COMPUTE RESCALING COEFFICIENTS USING THE SYSTEM MATRIX SOLVER --
   if (useRescaling and (_polynomial == Polynomial::SEPARATE)) {
     petsc::Vector rhs(_matrixC);
-    ierr = MatCreateVecs(_matrixC, nullptr, &rescalingCoeffs.vector); CHKERRV(ierr);
+    if (not warmStart) { // otherwise, the previous coefficients are the initial guess
+      ierr = MatCreateVecs(_matrixC, nullptr, &rescalingCoeffs.vector); CHKERRV(ierr);
+    }
     VecSet(rhs, 1);
     rhs.assemble();
+    utils::Event eSolve(getEventID(_solveRescalingEventID, "map.pet.solveRescaling"), precice::syncMode);
     _solver.solve(rhs, rescalingCoeffs);
+    eSolve.data.push_back(_solver.getIterationNumber());
   }
 
+  storeMeshRevisions();
   _hasComputedMapping = true;
 
   DEBUG("Number of mallocs for matrix C = " << _matrixC.getInfo(MAT_LOCAL).mallocs);
@@ -576,11 +745,17 @@ void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::clear()
   _hasComputedMapping = false;
 }
 
+template<typename RADIAL_BASIS_FUNCTION_T>
+void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::updateMapping()
+{
+  computeMapping(); // decides on its own, whether the solver state can be reused
+}
+
 template<typename RADIAL_BASIS_FUNCTION_T>
 void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::map(int inputDataID, int outputDataID)
 {
   TRACE(inputDataID, outputDataID);
-  precice::utils::Event e("map.pet.mapData.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
+  precice::utils::Event e(getEventID(_mapDataEventID, "map.pet.mapData"), precice::syncMode);
 
   assertion(_hasComputedMapping);
   assertion(input()->getDimensions() == output()->getDimensions(),
@@ -624,21 +799,28 @@ void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::map(int inputDataID, int
         petsc::Vector eta(_matrixA, "eta", petsc::Vector::RIGHT);
         ierr = MatMultTranspose(_matrixA, in, eta); CHKERRV(ierr);
         petsc::Vector mu(_matrixC, "mu", petsc::Vector::LEFT);
+        utils::Event eSolve(getEventID(_solveConservativeEventID, "map.pet.solveConservative"), precice::syncMode);
         _solver.solve(eta, mu);
+        eSolve.data.push_back(_solver.getIterationNumber());
+        eSolve.stop();
         VecScale(epsilon, -1);
         petsc::Vector tau(_matrixQ, "tau", petsc::Vector::RIGHT);
         ierr = MatMultTransposeAdd(_matrixQ, mu, epsilon, tau); CHKERRV(ierr);
         petsc::Vector sigma(_matrixQ, "sigma", petsc::Vector::LEFT);
+        utils::Event ePolynomial(getEventID(_solvePolynomialEventID, "map.pet.solvePolynomial"), precice::syncMode);
         ierr = KSPSolveTranspose(_QRsolver, tau, sigma); CHKERRV(ierr);
+        ePolynomial.data.push_back(_QRsolver.getIterationNumber());
+        ePolynomial.stop();
         VecWAXPY(out, -1, sigma, mu);
       }
       else {
         ierr = MatMultTranspose(_matrixA, in, au); CHKERRV(ierr);
-        utils::Event eSolve("map.pet.solveConservative.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
+        utils::Event eSolve(getEventID(_solveConservativeEventID, "map.pet.solveConservative"), precice::syncMode);
         if (not _solver.solve(au, out)) {
           KSPView(_solver, PETSC_VIEWER_STDOUT_WORLD);
           ERROR("RBF linear system has not converged.");
         }
+        eSolve.data.push_back(_solver.getIterationNumber());
         eSolve.stop();
 
       }
@@ -686,10 +868,13 @@ void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::map(int inputDataID, int
       in.assemble();
 
       if (_polynomial == Polynomial::SEPARATE) {
+        utils::Event ePolynomial(getEventID(_solvePolynomialEventID, "map.pet.solvePolynomial"), precice::syncMode);
         if (not _QRsolver.solve(in, a)) {
           KSPView(_QRsolver, PETSC_VIEWER_STDOUT_WORLD);
           ERROR("Polynomial QR linear system has not converged.");
         }
+        ePolynomial.data.push_back(_QRsolver.getIterationNumber());
+        ePolynomial.stop();
         VecScale(a, -1);
         MatMultAdd(_matrixQ, a, in, in); // Subtract the polynomial from the input values
       }
@@ -700,11 +885,12 @@ void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::map(int inputDataID, int
                                  std::forward_as_tuple(_matrixC, "p"))
         )->second;
 
-      utils::Event eSolve("map.pet.solveConsistent.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
+      utils::Event eSolve(getEventID(_solveConsistentEventID, "map.pet.solveConsistent"), precice::syncMode);
       if (not _solver.solve(in, p)) {
         KSPView(_solver, PETSC_VIEWER_STDOUT_WORLD);
         ERROR("RBF linear system has not converged.");
       }
+      eSolve.data.push_back(_solver.getIterationNumber());
       eSolve.stop();
 
       ierr = MatMult(_matrixA, p, out); CHKERRV(ierr);
@@ -830,6 +1016,85 @@ void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::tagMeshSecondRound()
 }
 
 
+template <typename RADIAL_BASIS_FUNCTION_T>
+void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::computePolynomialScaling(const mesh::PtrMesh inMesh)
+{
+  int dimensions = getDimensions();
+  _polynomialShift = Eigen::VectorXd::Zero(dimensions);
+  _polynomialScale = Eigen::VectorXd::Ones(dimensions);
+  if (_polynomial != Polynomial::SEPARATE)
+    return;
+
+  // Sums of coordinates, squared coordinates and number of owned vertices over all ranks
+  std::vector<double> localSums(2 * dimensions + 1, 0.0);
+  for (const mesh::Vertex& v : inMesh->vertices()) {
+    if (not v.isOwner())
+      continue;
+    for (int d = 0; d < dimensions; d++) {
+      localSums[d] += v.getCoords()[d];
+      localSums[dimensions + d] += v.getCoords()[d] * v.getCoords()[d];
+    }
+    localSums[2 * dimensions] += 1;
+  }
+  std::vector<double> sums(localSums.size());
+  MPI_Allreduce(localSums.data(), sums.data(), sums.size(), MPI_DOUBLE, MPI_SUM,
+                utils::Parallel::getGlobalCommunicator());
+
+  double count = sums[2 * dimensions];
+  if (count == 0)
+    return;
+  for (int d = 0; d < dimensions; d++) {
+    double mean = sums[d] / count;
+    double deviation = std::sqrt(std::max(sums[dimensions + d] / count - mean * mean, 0.0));
+    _polynomialShift[d] = mean;
+    if (deviation > math::NUMERICAL_ZERO_DIFFERENCE)
+      _polynomialScale[d] = deviation;
+  }
+  DEBUG("Polynomial shift = " << _polynomialShift << ", scale = " << _polynomialScale);
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::configurePreconditioner()
+{
+  PetscErrorCode ierr = 0;
+  PC pc;
+  ierr = KSPGetPC(_solver, &pc); CHKERRV(ierr);
+  if (_preconditioner == Preconditioner::BLOCK_JACOBI) {
+    ierr = PCSetType(pc, PCBJACOBI); CHKERRV(ierr);
+  }
+  else if (_preconditioner == Preconditioner::ASM) {
+    // The overlap follows the sparsity pattern of C, i.e. extends the subdomains by one support radius
+    ierr = PCSetType(pc, PCASM); CHKERRV(ierr);
+    ierr = PCASMSetOverlap(pc, 1); CHKERRV(ierr);
+  }
+  KSPSetFromOptions(_solver); // PETSc options still take precedence
+
+  if (_preconditioner == Preconditioner::DEFAULT)
+    return;
+
+  // The sub solvers only exist after the setup
+  ierr = KSPSetUp(_solver); CHKERRV(ierr);
+  PetscBool isBlockJacobi, isASM;
+  PetscObjectTypeCompare(reinterpret_cast<PetscObject>(pc), PCBJACOBI, &isBlockJacobi);
+  PetscObjectTypeCompare(reinterpret_cast<PetscObject>(pc), PCASM, &isASM);
+  PetscInt localBlocks = 0, firstBlock;
+  KSP* subSolvers;
+  if (isBlockJacobi) {
+    ierr = PCBJacobiGetSubKSP(pc, &localBlocks, &firstBlock, &subSolvers); CHKERRV(ierr);
+  }
+  else if (isASM) {
+    ierr = PCASMGetSubKSP(pc, &localBlocks, &firstBlock, &subSolvers); CHKERRV(ierr);
+  }
+  // Direct solves of the local blocks, C is symmetric but may be indefinite
+  for (PetscInt i = 0; i < localBlocks; i++) {
+    PC subPC;
+    ierr = KSPSetType(subSolvers[i], KSPPREONLY); CHKERRV(ierr);
+    ierr = KSPGetPC(subSolvers[i], &subPC); CHKERRV(ierr);
+    ierr = PCSetType(subPC, PCCHOLESKY); CHKERRV(ierr);
+    ierr = PCFactorSetShiftType(subPC, MAT_SHIFT_NONZERO); CHKERRV(ierr);
+  }
+}
+
 template <typename RADIAL_BASIS_FUNCTION_T>
 void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::printMappingInfo(int inputDataID, int dim) const
 {
@@ -938,7 +1203,7 @@ void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::estimatePreallocationMat
 template <typename RADIAL_BASIS_FUNCTION_T>
 void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::computePreallocationMatrixC(const mesh::PtrMesh inMesh)
 {
-  precice::utils::Event ePreallocC("map.pet.preallocC.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
+  precice::utils::Event ePreallocC(getEventID(_preallocCEventID, "map.pet.preallocC"), precice::syncMode);
 
   PetscInt n, ierr;
 
@@ -1014,7 +1279,7 @@ template <typename RADIAL_BASIS_FUNCTION_T>
 void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::computePreallocationMatrixA(
   const mesh::PtrMesh inMesh, const mesh::PtrMesh outMesh)
 {
-  precice::utils::Event ePreallocA("map.pet.preallocA.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
+  precice::utils::Event ePreallocA(getEventID(_preallocAEventID, "map.pet.preallocA"), precice::syncMode);
 
   PetscInt ownerRangeABegin, ownerRangeAEnd, colOwnerRangeABegin, colOwnerRangeAEnd;
   PetscInt outputSize, ierr;
@@ -1091,7 +1356,7 @@ template <typename RADIAL_BASIS_FUNCTION_T>
 typename PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::VertexData
 PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::savedPreallocationMatrixC(mesh::PtrMesh const inMesh)
 {
-  precice::utils::Event ePreallocC("map.pet.preallocC.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
+  precice::utils::Event ePreallocC(getEventID(_preallocCEventID, "map.pet.preallocC"), precice::syncMode);
 
   PetscInt n;
 
@@ -1103,7 +1368,7 @@ PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::savedPreallocationMatrixC(mes
   PetscInt colOwnerRangeCBegin, colOwnerRangeCEnd;
   std::tie(colOwnerRangeCBegin, colOwnerRangeCEnd) = _matrixC.ownerRangeColumn();
 
-  VertexData vertexData(n - localPolyparams);
+  VertexData vertexData;
 
   size_t local_row = 0;
   // -- PREALLOCATES THE POLYNOMIAL PART OF THE MATRIX --
@@ -1139,15 +1404,17 @@ PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::savedPreallocationMatrixC(mes
           distance[d] = 0;
 
       if (_basisFunction.getSupportRadius() > distance.norm() or col == global_row) {
-        vertexData[local_row - localPolyparams].emplace_back( vj.getGlobalIndex() + polyparams, distance.norm() );
+        vertexData.push_back(mappedCol, _basisFunction.evaluate(distance.norm()));
         if (mappedCol >= colOwnerRangeCBegin and mappedCol < colOwnerRangeCEnd)
           d_nnz[local_row]++;
         else
           o_nnz[local_row]++;
       }
     }
+    vertexData.finishRow();
     local_row++;
   }
+  vertexData.shrink();
 
   if (utils::Parallel::getCommunicatorSize() == 1) {
     // std::cout << "Computed Preallocation C Seq diagonal = " << std::accumulate(d_nnz.begin(), d_nnz.end(), 0) << std::endl;
@@ -1170,7 +1437,7 @@ typename PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::VertexData
 PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::savedPreallocationMatrixA(mesh::PtrMesh const inMesh, mesh::PtrMesh const outMesh)
 {
   INFO("Using saved preallocation");
-  precice::utils::Event ePreallocA("map.pet.preallocA.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
+  precice::utils::Event ePreallocA(getEventID(_preallocAEventID, "map.pet.preallocA"), precice::syncMode);
 
   PetscInt ownerRangeABegin, ownerRangeAEnd, colOwnerRangeABegin, colOwnerRangeAEnd;
   PetscInt outputSize;
@@ -1183,8 +1450,7 @@ PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::savedPreallocationMatrixA(mes
   std::vector<PetscInt> d_nnz(outputSize), o_nnz(outputSize);
   Eigen::VectorXd distance(dimensions);
 
-  // Contains localRow<localCols<colPosition, distance>>>
-  VertexData vertexData(outputSize);
+  VertexData vertexData;
 
   for (int localRow = 0; localRow < ownerRangeAEnd - ownerRangeABegin; localRow++) {
     d_nnz[localRow] = 0;
@@ -1221,16 +1487,18 @@ PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::savedPreallocationMatrixA(mes
 
       if (_basisFunction.getSupportRadius() > distance.norm()) {
         col = inVertex.getGlobalIndex() + polyparams;
-        vertexData[localRow].emplace_back(col, distance.norm());
-
         AOApplicationToPetsc(_AOmapping, 1, &col);
+        vertexData.push_back(col, _basisFunction.evaluate(distance.norm()));
+
         if (col >= colOwnerRangeABegin and col < colOwnerRangeAEnd)
           d_nnz[localRow]++;
         else
           o_nnz[localRow]++;
       }
     }
+    vertexData.finishRow();
   }
+  vertexData.shrink();
   if (utils::Parallel::getCommunicatorSize() == 1) {
     // std::cout << "Preallocation A Seq diagonal = " << std::accumulate(d_nnz.begin(), d_nnz.end(), 0) << std::endl;
     MatSeqAIJSetPreallocation(_matrixA, 0, d_nnz.data());
@@ -1247,12 +1515,54 @@ PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::savedPreallocationMatrixA(mes
 }
 
 
+template <typename RADIAL_BASIS_FUNCTION_T>
+template <typename ROW_FUNCTION_T, typename CONSUME_FUNCTION_T>
+void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::computeRowsThreaded(size_t rows, ROW_FUNCTION_T computeRow,
+                                                                           CONSUME_FUNCTION_T consumeChunk) const
+{
+  // Ranks usually occupy all cores of a node, threads only pay off for idle cores and many rows
+  size_t const minRowsPerThread = 1000;
+  // Bounds the rows held in the chunks before they are consumed
+  size_t const maxRowsPerThread = 10000;
+  size_t threads = std::thread::hardware_concurrency() / utils::Parallel::getCommunicatorSize();
+  threads = std::max<size_t>(1, std::min(threads, rows / minRowsPerThread));
+  size_t const batchSize = threads * maxRowsPerThread;
+  DEBUG("Computing " << rows << " rows on " << threads << " threads");
+
+  std::vector<VertexData> chunks(threads);
+  for (size_t batchBegin = 0; batchBegin < rows; batchBegin += batchSize) {
+    size_t const batchRows = std::min(batchSize, rows - batchBegin);
+    auto computeChunk = [&](size_t chunk) {
+      std::vector<size_t> candidates; // reused for all rows of the chunk
+      size_t const chunkEnd = batchBegin + batchRows * (chunk + 1) / threads;
+      for (size_t row = batchBegin + batchRows * chunk / threads; row < chunkEnd; row++) {
+        computeRow(row, chunks[chunk], candidates);
+        chunks[chunk].finishRow();
+      }
+    };
+
+    std::vector<std::thread> workers;
+    for (size_t chunk = 1; chunk < threads; chunk++) {
+      workers.emplace_back(computeChunk, chunk);
+    }
+    computeChunk(0);
+    for (std::thread& worker : workers) {
+      worker.join();
+    }
+
+    for (VertexData& chunk : chunks) {
+      consumeChunk(chunk);
+      VertexData().swap(chunk); // Frees the chunk before the next one is consumed
+    }
+  }
+}
+
 template <typename RADIAL_BASIS_FUNCTION_T>
 typename PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::VertexData
 PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::bgPreallocationMatrixC(mesh::PtrMesh const inMesh)
 {
   INFO("Using tree-based preallocation for matrix C");
-  precice::utils::Event ePreallocC("map.pet.preallocC.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
+  precice::utils::Event ePreallocC(getEventID(_preallocCEventID, "map.pet.preallocC"), precice::syncMode);
   namespace bg = boost::geometry;
 
   PetscInt n;
@@ -1260,16 +1570,11 @@ PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::bgPreallocationMatrixC(mesh::
   auto tree = mesh::rtree::getVertexRTree(inMesh);
   double const supportRadius = _basisFunction.getSupportRadius();
 
-  int dimensions = input()->getDimensions();
-  Eigen::VectorXd distance(dimensions);
-
   std::tie(n, std::ignore) = _matrixC.getLocalSize();
   std::vector<PetscInt> d_nnz(n), o_nnz(n);
   PetscInt colOwnerRangeCBegin, colOwnerRangeCEnd;
   std::tie(colOwnerRangeCBegin, colOwnerRangeCEnd) = _matrixC.ownerRangeColumn();
 
-  VertexData vertexData(n - localPolyparams);
-
   size_t local_row = 0;
   // -- PREALLOCATES THE POLYNOMIAL PART OF THE MATRIX --
   if (_polynomial == Polynomial::ON) {
@@ -1279,49 +1584,57 @@ PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::bgPreallocationMatrixC(mesh::
     }
   }
 
+  std::vector<const mesh::Vertex*> ownedVertices;
   for (const mesh::Vertex& inVertex : inMesh->vertices()) {
-    if (not inVertex.isOwner())
-      continue;
-
-    PetscInt col = polyparams;
-    PetscInt const global_row = local_row + _matrixC.ownerRange().first;
-    d_nnz[local_row] = 0;
-    o_nnz[local_row] = 0;
+    if (inVertex.isOwner())
+      ownedVertices.push_back(&inVertex);
+  }
 
-    // -- PREALLOCATES THE COEFFICIENTS --
-    std::vector<size_t> results;
+  // -- COMPUTES AND PREALLOCATES THE COEFFICIENTS --
+  // The threads compute the whole rows with unmapped columns, the part below the diagonal
+  // is known after the mapping and dropped before the rows are stored.
+  VertexData vertexData;
+  computeRowsThreaded(ownedVertices.size(),
+      [&](size_t row, VertexData& chunk, std::vector<size_t>& candidates) {
+    const mesh::Vertex& inVertex = *ownedVertices[row];
+    candidates.clear();
     auto search_box = mesh::getEnclosingBox(inVertex, supportRadius);
-
     tree->query(bg::index::within(search_box) and bg::index::satisfies([&](size_t const i){
           return bg::distance(inVertex, inMesh->vertices()[i]) <= supportRadius;}),
-      std::back_inserter(results));
-
-    // for (mesh::Vertex& vj : inMesh->vertices()) {
-    for (auto i : results) {
-      const mesh::Vertex & vj = inMesh->vertices()[i];
-
-      PetscInt mappedCol = vj.getGlobalIndex() + polyparams;
-      AOApplicationToPetsc(_AOmapping, 1, &mappedCol); // likely not efficient in the inner loop
-        
-      if (global_row > mappedCol) // Skip, since we are below the diagonal
-        continue;
-
-      distance = inVertex.getCoords() - vj.getCoords();
-      for (int d = 0; d < dimensions; d++)
-        if (_deadAxis[d])
-          distance[d] = 0;
+      std::back_inserter(candidates));
 
-      if (supportRadius > distance.norm() or col == global_row) {
-        vertexData[local_row - localPolyparams].emplace_back( vj.getGlobalIndex() + polyparams, distance.norm() );
+    for (size_t i : candidates) {
+      const mesh::Vertex& vj = inMesh->vertices()[i];
+      double const distance = deadAxisDistance(inVertex, vj);
+      if (supportRadius > distance or &vj == &inVertex) {
+        chunk.push_back(vj.getGlobalIndex() + polyparams, _basisFunction.evaluate(distance));
+      }
+    }
+  },
+      [&](VertexData& chunk) {
+    // One call for the whole chunk, each call of AOApplicationToPetsc is costly
+    AOApplicationToPetsc(_AOmapping, chunk.cols.size(), chunk.cols.data());
+
+    for (size_t chunkRow = 0; chunkRow < chunk.rows(); chunkRow++, local_row++) {
+      PetscInt const global_row = local_row + _matrixC.ownerRange().first;
+      d_nnz[local_row] = 0;
+      o_nnz[local_row] = 0;
+
+      for (size_t k = chunk.rowStarts[chunkRow]; k < chunk.rowStarts[chunkRow + 1]; k++) {
+        PetscInt const mappedCol = chunk.cols[k];
+        if (global_row > mappedCol) // Skip, since we are below the diagonal
+          continue;
+
+        vertexData.push_back(mappedCol, chunk.values[k]);
         if (mappedCol >= colOwnerRangeCBegin and mappedCol < colOwnerRangeCEnd)
           d_nnz[local_row]++;
         else
           o_nnz[local_row]++;
       }
-      col++;
+      vertexData.finishRow();
     }
-    local_row++;
-  }
+  });
+  vertexData.shrink();
 
   if (utils::Parallel::getCommunicatorSize() == 1) {
     MatSeqSBAIJSetPreallocation(_matrixC, _matrixC.blockSize(), 0, d_nnz.data());
@@ -1341,7 +1654,7 @@ typename PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::VertexData
 PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::bgPreallocationMatrixA(mesh::PtrMesh const inMesh, mesh::PtrMesh const outMesh)
 {
   INFO("Using tree-based preallocation for matrix A");
-  precice::utils::Event ePreallocA("map.pet.preallocA.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
+  precice::utils::Event ePreallocA(getEventID(_preallocAEventID, "map.pet.preallocA"), precice::syncMode);
   namespace bg = boost::geometry;
 
   PetscInt ownerRangeABegin, ownerRangeAEnd, colOwnerRangeABegin, colOwnerRangeAEnd;
@@ -1354,65 +1667,69 @@ PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::bgPreallocationMatrixA(mesh::
   int dimensions = input()->getDimensions();
 
   std::vector<PetscInt> d_nnz(outputSize), o_nnz(outputSize);
-  Eigen::VectorXd distance(dimensions);
-
-  // Contains localRow<localCols<colPosition, distance>>>
-  VertexData vertexData(outputSize);
-
-  for (int localRow = 0; localRow < ownerRangeAEnd - ownerRangeABegin; localRow++) {
-    d_nnz[localRow] = 0;
-    o_nnz[localRow] = 0;
-    PetscInt col = 0;
-    mesh::Vertex const & oVertex = outMesh->vertices()[localRow];
 
-    // -- PREALLOCATE THE POLYNOM PART OF THE MATRIX --
-    // col does not need mapping here, because the first polyparams col are always identity mapped
-    if (_polynomial == Polynomial::ON) {
-      if (col >= colOwnerRangeABegin and col < colOwnerRangeAEnd)
-        d_nnz[localRow]++;
-      else
-        o_nnz[localRow]++;
-      col++;
-
-      for (int dim = 0; dim < dimensions; dim++) {
-        if (not _deadAxis[dim]) {
-          if (col >= colOwnerRangeABegin and col < colOwnerRangeAEnd)
-            d_nnz[localRow]++;
-          else
-            o_nnz[localRow]++;
-          col++;
-        }
-      }
-    }
-
-    // -- PREALLOCATE THE COEFFICIENTS --
-    std::vector<size_t> results;
+  // -- COMPUTES AND PREALLOCATES THE COEFFICIENTS --
+  VertexData vertexData;
+  int localRow = 0;
+  computeRowsThreaded(ownerRangeAEnd - ownerRangeABegin,
+      [&](size_t row, VertexData& chunk, std::vector<size_t>& candidates) {
+    mesh::Vertex const & oVertex = outMesh->vertices()[row];
+    candidates.clear();
     auto search_box = mesh::getEnclosingBox(oVertex, supportRadius);
-
     tree->query(bg::index::within(search_box) and bg::index::satisfies([&](size_t const i){
           return bg::distance(oVertex, inMesh->vertices()[i]) <= supportRadius;}),
-      std::back_inserter(results));
-
-    for (auto i : results ) {
-        const mesh::Vertex & inVertex = inMesh->vertices()[i];
-        distance = oVertex.getCoords() - inVertex.getCoords();
+      std::back_inserter(candidates));
 
-        for (int d = 0; d < dimensions; d++)
-          if (_deadAxis[d])
-            distance[d] = 0;
-
-        if (supportRadius > distance.norm()) {
-          col = inVertex.getGlobalIndex() + polyparams;
-          vertexData[localRow].emplace_back(col, distance.norm());
+    for (size_t i : candidates) {
+      const mesh::Vertex& inVertex = inMesh->vertices()[i];
+      double const distance = deadAxisDistance(oVertex, inVertex);
+      if (supportRadius > distance) {
+        chunk.push_back(inVertex.getGlobalIndex() + polyparams, _basisFunction.evaluate(distance));
+      }
+    }
+  },
+      [&](VertexData& chunk) {
+    // One call for the whole chunk, each call of AOApplicationToPetsc is costly
+    AOApplicationToPetsc(_AOmapping, chunk.cols.size(), chunk.cols.data());
+
+    for (size_t chunkRow = 0; chunkRow < chunk.rows(); chunkRow++, localRow++) {
+      d_nnz[localRow] = 0;
+      o_nnz[localRow] = 0;
+      PetscInt col = 0;
+
+      // -- PREALLOCATE THE POLYNOM PART OF THE MATRIX --
+      // col does not need mapping here, because the first polyparams col are always identity mapped
+      if (_polynomial == Polynomial::ON) {
+        if (col >= colOwnerRangeABegin and col < colOwnerRangeAEnd)
+          d_nnz[localRow]++;
+        else
+          o_nnz[localRow]++;
+        col++;
 
-          AOApplicationToPetsc(_AOmapping, 1, &col);
-          if (col >= colOwnerRangeABegin and col < colOwnerRangeAEnd)
-            d_nnz[localRow]++;
-          else
-            o_nnz[localRow]++;
+        for (int dim = 0; dim < dimensions; dim++) {
+          if (not _deadAxis[dim]) {
+            if (col >= colOwnerRangeABegin and col < colOwnerRangeAEnd)
+              d_nnz[localRow]++;
+            else
+              o_nnz[localRow]++;
+            col++;
+          }
         }
+      }
+
+      // -- PREALLOCATE THE COEFFICIENTS --
+      for (size_t k = chunk.rowStarts[chunkRow]; k < chunk.rowStarts[chunkRow + 1]; k++) {
+        col = chunk.cols[k];
+        vertexData.push_back(col, chunk.values[k]);
+        if (col >= colOwnerRangeABegin and col < colOwnerRangeAEnd)
+          d_nnz[localRow]++;
+        else
+          o_nnz[localRow]++;
+      }
+      vertexData.finishRow();
     }
-  }
+  });
+  vertexData.shrink();
   if (utils::Parallel::getCommunicatorSize() == 1) {
     MatSeqAIJSetPreallocation(_matrixA, 0, d_nnz.data());
   }
@@ -1425,7 +1742,6 @@ PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::bgPreallocationMatrixA(mesh::
   return vertexData;
 }
 
-
 }} // namespace precice, mapping
 
 #endif // PRECICE_NO_PETSC
@@ -68,6 +68,10 @@ private:
 
   bool _hasComputedMapping = false;
 
+  /// Cached event handles, see Mapping::getEventID
+  int _computeMappingEventID = -1;
+  int _mapDataEventID = -1;
+
   /// Radial basis function type used in interpolation.
   RADIAL_BASIS_FUNCTION_T _basisFunction;
 
@@ -129,7 +133,7 @@ void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>:: computeMapping()
 {
   TRACE();
 
-  precice::utils::Event e("map.rbf.computeMapping.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
+  precice::utils::Event e(getEventID(_computeMappingEventID, "map.rbf.computeMapping"), precice::syncMode);
 
   CHECK(not utils::MasterSlave::_slaveMode && not utils::MasterSlave::_masterMode,
         "RBF mapping is not supported for a participant in master mode, use petrbf instead");
@@ -206,6 +210,7 @@ void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>:: computeMapping()
   if (not _qr.isInvertible())
     ERROR("Interpolation matrix C is not invertible.");
   
+  storeMeshRevisions();
   _hasComputedMapping = true;
 }
 
@@ -232,7 +237,7 @@ void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>:: map
 {
   TRACE(inputDataID, outputDataID);
 
-  precice::utils::Event e("map.rbf.mapData.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
+  precice::utils::Event e(getEventID(_mapDataEventID, "map.rbf.mapData"), precice::syncMode);
 
   assertion(_hasComputedMapping);
   assertion(input()->getDimensions() == output()->getDimensions(),
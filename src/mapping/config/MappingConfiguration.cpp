@@ -3,6 +3,7 @@
 #include "mapping/NearestProjectionMapping.hpp"
 #include "mapping/RadialBasisFctMapping.hpp"
 #include "mapping/PetRadialBasisFctMapping.hpp"
+#include "mapping/PartitionOfUnityMapping.hpp"
 #include "mapping/impl/BasisFunctions.hpp"
 #include "mesh/config/MeshConfiguration.hpp"
 #include "xml/XMLTag.hpp"
@@ -29,6 +30,15 @@ MappingConfiguration:: MappingConfiguration
   VALUE_RBF_CPOLYNOMIAL_C0("rbf-compact-polynomial-c0"),
   VALUE_RBF_CPOLYNOMIAL_C6("rbf-compact-polynomial-c6"),
 
+  VALUE_PURBF_TPS("purbf-thin-plate-splines"),
+  VALUE_PURBF_MULTIQUADRICS("purbf-multiquadrics"),
+  VALUE_PURBF_INV_MULTIQUADRICS("purbf-inverse-multiquadrics"),
+  VALUE_PURBF_VOLUME_SPLINES("purbf-volume-splines"),
+  VALUE_PURBF_GAUSSIAN("purbf-gaussian"),
+  VALUE_PURBF_CTPS_C2("purbf-compact-tps-c2"),
+  VALUE_PURBF_CPOLYNOMIAL_C0("purbf-compact-polynomial-c0"),
+  VALUE_PURBF_CPOLYNOMIAL_C6("purbf-compact-polynomial-c6"),
+
   VALUE_PETRBF_TPS("petrbf-thin-plate-splines"),
   VALUE_PETRBF_MULTIQUADRICS("petrbf-multiquadrics"),
   VALUE_PETRBF_INV_MULTIQUADRICS("petrbf-inverse-multiquadrics"),
@@ -68,6 +78,26 @@ MappingConfiguration:: MappingConfiguration
   attrPreallocation.setDocumentation("Sets kind of preallocation for PETSc RBF implementation");
   attrPreallocation.setDefaultValue("tree");
 
+  XMLAttribute<bool> attrWarmStart(ATTR_WARM_START);
+  attrWarmStart.setDocumentation("If set to true, the PETSc RBF implementation reuses the preconditioner and "
+                                 "previous solutions when the mapping is recomputed for moved meshes (timing onadvance)");
+  attrWarmStart.setDefaultValue(false);
+
+  XMLAttribute<std::string> attrPreconditioner(ATTR_PRECONDITIONER);
+  attrPreconditioner.setDocumentation("Preconditioner of the PETSc RBF implementation. \"block-jacobi\" uses a "
+                                      "Cholesky factorization of the rank-local block, \"asm\" an additive Schwarz "
+                                      "method with subdomains overlapping by one support radius. \"default\" keeps "
+                                      "the PETSc default, which can be changed using PETSc options.");
+  attrPreconditioner.setDefaultValue("default");
+  ValidString validDefault("default");
+  ValidString validBlockJacobi("block-jacobi");
+  ValidString validASM("asm");
+  attrPreconditioner.setValidator(validDefault || validBlockJacobi || validASM);
+
+  XMLAttribute<double> attrPatchRadius(ATTR_PATCH_RADIUS);
+  attrPatchRadius.setDocumentation("Radius of the patches of the partition of unity RBF implementation. "
+                                   "Each patch should contain a few layers of vertices of the input mesh.");
+
   XMLTag::Occurrence occ = XMLTag::OCCUR_ARBITRARY;
   std::list<XMLTag> tags;
   {
@@ -108,12 +138,61 @@ MappingConfiguration:: MappingConfiguration
     tag.addAttribute(attrSupportRadius);
     tags.push_back(tag);
   }
+  // ---- Partition of unity RBF declarations ----
+  {
+    XMLTag tag(*this, VALUE_PURBF_TPS, occ, TAG);
+    tag.addAttribute(attrPatchRadius);
+    tags.push_back(tag);
+  }
+  {
+    XMLTag tag(*this, VALUE_PURBF_MULTIQUADRICS, occ, TAG);
+    tag.addAttribute(attrShapeParam);
+    tag.addAttribute(attrPatchRadius);
+    tags.push_back(tag);
+  }
+  {
+    XMLTag tag(*this, VALUE_PURBF_INV_MULTIQUADRICS, occ, TAG);
+    tag.addAttribute(attrShapeParam);
+    tag.addAttribute(attrPatchRadius);
+    tags.push_back(tag);
+  }
+  {
+    XMLTag tag(*this, VALUE_PURBF_VOLUME_SPLINES, occ, TAG);
+    tag.addAttribute(attrPatchRadius);
+    tags.push_back(tag);
+  }
+  {
+    XMLTag tag(*this, VALUE_PURBF_GAUSSIAN, occ, TAG);
+    tag.addAttribute(attrShapeParam);
+    tag.addAttribute(attrPatchRadius);
+    tags.push_back(tag);
+  }
+  {
+    XMLTag tag(*this, VALUE_PURBF_CTPS_C2, occ, TAG);
+    tag.addAttribute(attrSupportRadius);
+    tag.addAttribute(attrPatchRadius);
+    tags.push_back(tag);
+  }
+  {
+    XMLTag tag(*this, VALUE_PURBF_CPOLYNOMIAL_C0, occ, TAG);
+    tag.addAttribute(attrSupportRadius);
+    tag.addAttribute(attrPatchRadius);
+    tags.push_back(tag);
+  }
+  {
+    XMLTag tag(*this, VALUE_PURBF_CPOLYNOMIAL_C6, occ, TAG);
+    tag.addAttribute(attrSupportRadius);
+    tag.addAttribute(attrPatchRadius);
+    tags.push_back(tag);
+  }
   // ---- Petsc RBF declarations ----
   {
     XMLTag tag(*this, VALUE_PETRBF_TPS, occ, TAG);
     tag.addAttribute(attrSolverRtol);
     tag.addAttribute(attrPolynomial);
     tag.addAttribute(attrPreallocation);
+    tag.addAttribute(attrWarmStart);
+    tag.addAttribute(attrPreconditioner);
     tags.push_back(tag);
   }
   {
@@ -122,6 +201,8 @@ MappingConfiguration:: MappingConfiguration
     tag.addAttribute(attrSolverRtol);
     tag.addAttribute(attrPolynomial);
     tag.addAttribute(attrPreallocation);
+    tag.addAttribute(attrWarmStart);
+    tag.addAttribute(attrPreconditioner);
     tags.push_back(tag);
   }
   {
@@ -130,6 +211,8 @@ MappingConfiguration:: MappingConfiguration
     tag.addAttribute(attrSolverRtol);
     tag.addAttribute(attrPolynomial);
     tag.addAttribute(attrPreallocation);
+    tag.addAttribute(attrWarmStart);
+    tag.addAttribute(attrPreconditioner);
     tags.push_back(tag);
   }
   {
@@ -137,6 +220,8 @@ MappingConfiguration:: MappingConfiguration
     tag.addAttribute(attrSolverRtol);
     tag.addAttribute(attrPolynomial);
     tag.addAttribute(attrPreallocation);
+    tag.addAttribute(attrWarmStart);
+    tag.addAttribute(attrPreconditioner);
     tags.push_back(tag);
   }
   {
@@ -145,6 +230,8 @@ MappingConfiguration:: MappingConfiguration
     tag.addAttribute(attrShapeParam);
     tag.addAttribute(attrPolynomial);
     tag.addAttribute(attrPreallocation);
+    tag.addAttribute(attrWarmStart);
+    tag.addAttribute(attrPreconditioner);
     tags.push_back(tag);
   }
   {
@@ -153,6 +240,8 @@ MappingConfiguration:: MappingConfiguration
     tag.addAttribute(attrSupportRadius);
     tag.addAttribute(attrPolynomial);
     tag.addAttribute(attrPreallocation);
+    tag.addAttribute(attrWarmStart);
+    tag.addAttribute(attrPreconditioner);
     tags.push_back(tag);
   }
   {
@@ -161,6 +250,8 @@ MappingConfiguration:: MappingConfiguration
     tag.addAttribute(attrSupportRadius);
     tag.addAttribute(attrPolynomial);
     tag.addAttribute(attrPreallocation);
+    tag.addAttribute(attrWarmStart);
+    tag.addAttribute(attrPreconditioner);
     tags.push_back(tag);
   }
   {
@@ -169,6 +260,8 @@ MappingConfiguration:: MappingConfiguration
     tag.addAttribute(attrSupportRadius);
     tag.addAttribute(attrPolynomial);
     tag.addAttribute(attrPreallocation);
+    tag.addAttribute(attrWarmStart);
+    tag.addAttribute(attrPreconditioner);
     tags.push_back(tag);
   }
   // Add tags that only RBF mappings use
@@ -231,10 +324,13 @@ void MappingConfiguration:: xmlTagCallback
     Timing timing = getTiming(tag.getStringAttributeValue(ATTR_TIMING));
     double shapeParameter = 0.0;
     double supportRadius = 0.0;
+    double patchRadius = 0.0;
     double solverRtol = 1e-9;
     bool xDead = false, yDead = false, zDead = false;
     Polynomial polynomial = Polynomial::ON;
     Preallocation preallocation = Preallocation::TREE;
+    bool warmStart = false;
+    Preconditioner preconditioner = Preconditioner::DEFAULT;
     
     if (tag.hasAttribute(ATTR_SHAPE_PARAM)){
       shapeParameter = tag.getDoubleAttributeValue(ATTR_SHAPE_PARAM);
@@ -242,9 +338,24 @@ void MappingConfiguration:: xmlTagCallback
     if (tag.hasAttribute(ATTR_SUPPORT_RADIUS)){
       supportRadius = tag.getDoubleAttributeValue(ATTR_SUPPORT_RADIUS);
     }
+    if (tag.hasAttribute(ATTR_PATCH_RADIUS)){
+      patchRadius = tag.getDoubleAttributeValue(ATTR_PATCH_RADIUS);
+      CHECK(patchRadius > 0.0, "The value given for the \"" << ATTR_PATCH_RADIUS
+            << "\" attribute of mapping \"" << type << "\" has to be larger than zero: " << patchRadius);
+    }
     if (tag.hasAttribute(ATTR_SOLVER_RTOL)){
       solverRtol = tag.getDoubleAttributeValue(ATTR_SOLVER_RTOL);
     }
+    if (tag.hasAttribute(ATTR_WARM_START)){
+      warmStart = tag.getBooleanAttributeValue(ATTR_WARM_START);
+    }
+    if (tag.hasAttribute(ATTR_PRECONDITIONER)){
+      std::string strPreconditioner = tag.getStringAttributeValue(ATTR_PRECONDITIONER);
+      if (strPreconditioner == "block-jacobi")
+        preconditioner = Preconditioner::BLOCK_JACOBI;
+      else if (strPreconditioner == "asm")
+        preconditioner = Preconditioner::ASM;
+    }
     if (tag.hasAttribute(ATTR_X_DEAD)){
       xDead = tag.getBooleanAttributeValue(ATTR_X_DEAD);
     }
@@ -277,8 +388,9 @@ void MappingConfiguration:: xmlTagCallback
           
     ConfiguredMapping configuredMapping = createMapping(dir, type, constraint,
                                                         fromMesh, toMesh, timing,
-                                                        shapeParameter, supportRadius, solverRtol,
-                                                        xDead, yDead, zDead, polynomial, preallocation);
+                                                        shapeParameter, supportRadius, patchRadius, solverRtol,
+                                                        xDead, yDead, zDead, polynomial, preallocation, warmStart,
+                                                        preconditioner);
     checkDuplicates ( configuredMapping );
     _mappings.push_back ( configuredMapping );
   }
@@ -323,14 +435,17 @@ MappingConfiguration::ConfiguredMapping MappingConfiguration::createMapping
   Timing             timing,
   double             shapeParameter,
   double             supportRadius,
+  double             patchRadius,
   double             solverRtol,
   bool               xDead,
   bool               yDead,
   bool               zDead,
   Polynomial         polynomial,
-  Preallocation      preallocation) const
+  Preallocation      preallocation,
+  bool               warmStart,
+  Preconditioner     preconditioner) const
 {
-  TRACE(direction, type, timing, shapeParameter, supportRadius);
+  TRACE(direction, type, timing, shapeParameter, supportRadius, patchRadius);
   using namespace mapping;
   ConfiguredMapping configuredMapping;
   mesh::PtrMesh fromMesh(_meshConfig->getMesh(fromMeshName));
@@ -429,53 +544,101 @@ MappingConfiguration::ConfiguredMapping MappingConfiguration::createMapping
         constraintValue, dimensions, CompactPolynomialC6(supportRadius),
         xDead, yDead, zDead ));
   }
+  else if (type == VALUE_PURBF_TPS){
+    configuredMapping.mapping = PtrMapping (
+      new PartitionOfUnityMapping<ThinPlateSplines>(
+        constraintValue, dimensions, ThinPlateSplines(), patchRadius,
+        xDead, yDead, zDead ));
+  }
+  else if (type == VALUE_PURBF_MULTIQUADRICS){
+    configuredMapping.mapping = PtrMapping (
+      new PartitionOfUnityMapping<Multiquadrics>(
+        constraintValue, dimensions, Multiquadrics(shapeParameter), patchRadius,
+        xDead, yDead, zDead ));
+  }
+  else if (type == VALUE_PURBF_INV_MULTIQUADRICS){
+    configuredMapping.mapping = PtrMapping (
+      new PartitionOfUnityMapping<InverseMultiquadrics>(
+        constraintValue, dimensions, InverseMultiquadrics(shapeParameter), patchRadius,
+        xDead, yDead, zDead ));
+  }
+  else if (type == VALUE_PURBF_VOLUME_SPLINES){
+    configuredMapping.mapping = PtrMapping (
+      new PartitionOfUnityMapping<VolumeSplines>(
+        constraintValue, dimensions, VolumeSplines(), patchRadius,
+        xDead, yDead, zDead ));
+  }
+  else if (type == VALUE_PURBF_GAUSSIAN){
+    configuredMapping.mapping = PtrMapping (
+      new PartitionOfUnityMapping<Gaussian>(
+        constraintValue, dimensions, Gaussian(shapeParameter), patchRadius,
+        xDead, yDead, zDead ));
+  }
+  else if (type == VALUE_PURBF_CTPS_C2){
+    configuredMapping.mapping = PtrMapping (
+      new PartitionOfUnityMapping<CompactThinPlateSplinesC2>(
+        constraintValue, dimensions, CompactThinPlateSplinesC2(supportRadius), patchRadius,
+        xDead, yDead, zDead ));
+  }
+  else if (type == VALUE_PURBF_CPOLYNOMIAL_C0){
+    configuredMapping.mapping = PtrMapping (
+      new PartitionOfUnityMapping<CompactPolynomialC0>(
+        constraintValue, dimensions, CompactPolynomialC0(supportRadius), patchRadius,
+        xDead, yDead, zDead ));
+  }
+  else if (type == VALUE_PURBF_CPOLYNOMIAL_C6){
+    configuredMapping.mapping = PtrMapping (
+      new PartitionOfUnityMapping<CompactPolynomialC6>(
+        constraintValue, dimensions, CompactPolynomialC6(supportRadius), patchRadius,
+        xDead, yDead, zDead ));
+  }
 # ifndef PRECICE_NO_PETSC
   else if (type == VALUE_PETRBF_TPS){
     utils::Petsc::initialize(&argc, &argv);
     configuredMapping.mapping = PtrMapping (
       new PetRadialBasisFctMapping<ThinPlateSplines>(constraintValue, dimensions, ThinPlateSplines(),
-                                                     xDead, yDead, zDead, solverRtol, polynomial, preallocation) );
+                                                     xDead, yDead, zDead, solverRtol, polynomial, preallocation, warmStart, preconditioner) );
   }
   else if (type == VALUE_PETRBF_MULTIQUADRICS){
     utils::Petsc::initialize(&argc, &argv);
     configuredMapping.mapping = PtrMapping (
       new PetRadialBasisFctMapping<Multiquadrics>(constraintValue, dimensions, Multiquadrics(shapeParameter),
-                                                  xDead, yDead, zDead, solverRtol, polynomial, preallocation) );
+                                                  xDead, yDead, zDead, solverRtol, polynomial, preallocation, warmStart, preconditioner) );
   }
   else if (type == VALUE_PETRBF_INV_MULTIQUADRICS){
     utils::Petsc::initialize(&argc, &argv);
     configuredMapping.mapping = PtrMapping (
       new PetRadialBasisFctMapping<InverseMultiquadrics>(constraintValue, dimensions, InverseMultiquadrics(shapeParameter),
-                                                         xDead, yDead, zDead, solverRtol, polynomial, preallocation) );
+                                                         xDead, yDead, zDead, solverRtol, polynomial, preallocation, warmStart, preconditioner) );
   }
   else if (type == VALUE_PETRBF_VOLUME_SPLINES){
     utils::Petsc::initialize(&argc, &argv);
     configuredMapping.mapping = PtrMapping (
       new PetRadialBasisFctMapping<VolumeSplines>(constraintValue, dimensions, VolumeSplines(),
-                                                  xDead, yDead, zDead, solverRtol, polynomial, preallocation) );
+                                                  xDead, yDead, zDead, solverRtol, polynomial, preallocation, warmStart, preconditioner) );
   }
   else if (type == VALUE_PETRBF_GAUSSIAN){
     utils::Petsc::initialize(&argc, &argv);
     configuredMapping.mapping = PtrMapping(
       new PetRadialBasisFctMapping<Gaussian>(constraintValue, dimensions, Gaussian(shapeParameter),
-                                             xDead, yDead, zDead, solverRtol, polynomial, preallocation));
+                                             xDead, yDead, zDead, solverRtol, polynomial, preallocation, warmStart, preconditioner));
   }
   else if (type == VALUE_PETRBF_CTPS_C2){
     utils::Petsc::initialize(&argc, &argv);
     configuredMapping.mapping = PtrMapping (
       new PetRadialBasisFctMapping<CompactThinPlateSplinesC2>(constraintValue, dimensions, CompactThinPlateSplinesC2(supportRadius),
-                                                              xDead, yDead, zDead, solverRtol, polynomial, preallocation) );
+                                                              xDead, yDead, zDead, solverRtol, polynomial, preallocation, warmStart, preconditioner) );
   }
   else if (type == VALUE_PETRBF_CPOLYNOMIAL_C0){
     utils::Petsc::initialize(&argc, &argv);
     configuredMapping.mapping = PtrMapping (
       new PetRadialBasisFctMapping<CompactPolynomialC0>(constraintValue, dimensions, CompactPolynomialC0(supportRadius),
-                                                        xDead, yDead, zDead, solverRtol, polynomial, preallocation) );
+                                                        xDead, yDead, zDead, solverRtol, polynomial, preallocation, warmStart, preconditioner) );
   }
   else if (type == VALUE_PETRBF_CPOLYNOMIAL_C6){
     utils::Petsc::initialize(&argc, &argv);
     configuredMapping.mapping = PtrMapping (new PetRadialBasisFctMapping<CompactPolynomialC6>(constraintValue, dimensions, CompactPolynomialC6(supportRadius),
-                                                                                              xDead, yDead, zDead, solverRtol, polynomial, preallocation) );
+                                                                                              xDead, yDead, zDead, solverRtol, polynomial, preallocation, warmStart, preconditioner) );
   }
 # endif
   else {
@@ -30,6 +30,12 @@ enum class Preallocation {
   TREE
 };
 
+enum class Preconditioner {
+  DEFAULT,
+  BLOCK_JACOBI,
+  ASM
+};
+
 
 /// Performs XML configuration and holds configured mappings.
 class MappingConfiguration : public xml::XMLTag::Listener
@@ -112,7 +118,10 @@ private:
   const std::string ATTR_CONSTRAINT = "constraint";
   const std::string ATTR_SHAPE_PARAM = "shape-parameter";
   const std::string ATTR_SUPPORT_RADIUS = "support-radius";
+  const std::string ATTR_PATCH_RADIUS = "patch-radius";
   const std::string ATTR_SOLVER_RTOL = "solver-rtol";
+  const std::string ATTR_WARM_START = "warm-start";
+  const std::string ATTR_PRECONDITIONER = "preconditioner";
   const std::string ATTR_X_DEAD = "x-dead";
   const std::string ATTR_Y_DEAD = "y-dead";
   const std::string ATTR_Z_DEAD = "z-dead";
@@ -132,6 +141,15 @@ private:
   const std::string VALUE_RBF_CPOLYNOMIAL_C0;
   const std::string VALUE_RBF_CPOLYNOMIAL_C6;
 
+  const std::string VALUE_PURBF_TPS;
+  const std::string VALUE_PURBF_MULTIQUADRICS;
+  const std::string VALUE_PURBF_INV_MULTIQUADRICS;
+  const std::string VALUE_PURBF_VOLUME_SPLINES;
+  const std::string VALUE_PURBF_GAUSSIAN;
+  const std::string VALUE_PURBF_CTPS_C2;
+  const std::string VALUE_PURBF_CPOLYNOMIAL_C0;
+  const std::string VALUE_PURBF_CPOLYNOMIAL_C6;
+
   const std::string VALUE_PETRBF_TPS;
   const std::string VALUE_PETRBF_MULTIQUADRICS;
   const std::string VALUE_PETRBF_INV_MULTIQUADRICS;
@@ -158,12 +176,15 @@ private:
     Timing             timing,
     double             shapeParameter,
     double             supportRadius,
+    double             patchRadius,
     double             solverRtol,
     bool               xDead,
     bool               yDead,
     bool               zDead,
     Polynomial         polynomial,
-    Preallocation      preallocation) const;
+    Preallocation      preallocation,
+    bool               warmStart,
+    Preconditioner     preconditioner) const;
 
   void checkDuplicates ( const ConfiguredMapping& mapping );
 
@@ -157,5 +157,94 @@ BOOST_AUTO_TEST_CASE(ConservativeNonIncremental)
   BOOST_TEST(outValues(1) == 0.0);
 }
 
+BOOST_AUTO_TEST_CASE(MultipleValueDimensions)
+{
+  int dimensions = 2;
+
+  // Input vertices 0 and 2 are nearest to output vertex 0, input vertex 1 to output vertex 1
+  PtrMesh inMesh(new Mesh("InMesh", dimensions, false));
+  PtrData inData3 = inMesh->createData("InData3", 3);
+  PtrData inData4 = inMesh->createData("InData4", 4);
+  inMesh->createVertex(Eigen::Vector2d::Constant(0.0));
+  inMesh->createVertex(Eigen::Vector2d::Constant(1.0));
+  inMesh->createVertex(Eigen::Vector2d::Constant(0.1));
+  inMesh->allocateDataValues();
+  inData3->values() << 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0;
+  inData4->values() = Eigen::VectorXd::LinSpaced(12, 1.0, 12.0);
+
+  PtrMesh outMesh(new Mesh("OutMesh", dimensions, false));
+  PtrData outData3 = outMesh->createData("OutData3", 3);
+  PtrData outData4 = outMesh->createData("OutData4", 4);
+  outMesh->createVertex(Eigen::Vector2d::Constant(0.0));
+  outMesh->createVertex(Eigen::Vector2d::Constant(1.0));
+  outMesh->allocateDataValues();
+
+  precice::mapping::NearestNeighborMapping conservative(mapping::Mapping::CONSERVATIVE, dimensions);
+  conservative.setMeshes(inMesh, outMesh);
+  conservative.computeMapping();
+  conservative.map(inData3->getID(), outData3->getID());
+  conservative.map(inData4->getID(), outData4->getID());
+  Eigen::VectorXd expected3(6);
+  expected3 << 8.0, 10.0, 12.0, 4.0, 5.0, 6.0;
+  BOOST_TEST(testing::equals(outData3->values(), expected3));
+  Eigen::VectorXd expected4(8);
+  expected4 << 10.0, 12.0, 14.0, 16.0, 5.0, 6.0, 7.0, 8.0;
+  BOOST_TEST(testing::equals(outData4->values(), expected4));
+
+  // Map back, both values of output vertex 0 are copied to input vertices 0 and 2
+  precice::mapping::NearestNeighborMapping consistent(mapping::Mapping::CONSISTENT, dimensions);
+  consistent.setMeshes(outMesh, inMesh);
+  consistent.computeMapping();
+  consistent.map(outData3->getID(), inData3->getID());
+  consistent.map(outData4->getID(), inData4->getID());
+  expected3.resize(9);
+  expected3 << 8.0, 10.0, 12.0, 4.0, 5.0, 6.0, 8.0, 10.0, 12.0;
+  BOOST_TEST(testing::equals(inData3->values(), expected3));
+  expected4.resize(12);
+  expected4 << 10.0, 12.0, 14.0, 16.0, 5.0, 6.0, 7.0, 8.0, 10.0, 12.0, 14.0, 16.0;
+  BOOST_TEST(testing::equals(inData4->values(), expected4));
+}
+
+BOOST_AUTO_TEST_CASE(UpdateMovedMesh)
+{
+  int dimensions = 2;
+
+  PtrMesh inMesh(new Mesh("InMesh", dimensions, false));
+  PtrData inData = inMesh->createData("InData", 1);
+  inMesh->createVertex(Eigen::Vector2d::Constant(0.0));
+  inMesh->createVertex(Eigen::Vector2d::Constant(1.0));
+  inMesh->computeState();
+  inMesh->allocateDataValues();
+  inData->values() << 1.0, 2.0;
+
+  PtrMesh outMesh(new Mesh("OutMesh", dimensions, false));
+  PtrData outData = outMesh->createData("OutData", 1);
+  outMesh->createVertex(Eigen::Vector2d::Constant(0.0));
+  outMesh->createVertex(Eigen::Vector2d::Constant(1.0));
+  outMesh->computeState();
+  outMesh->allocateDataValues();
+
+  precice::mapping::NearestNeighborMapping mapping(mapping::Mapping::CONSISTENT, dimensions);
+  mapping.setMeshes(inMesh, outMesh);
+  BOOST_TEST(mapping.hasMeshChanged());
+  mapping.computeMapping();
+  BOOST_TEST(not mapping.hasMeshChanged());
+  mapping.map(inData->getID(), outData->getID());
+  BOOST_TEST(outData->values()(0) == 1.0);
+  BOOST_TEST(outData->values()(1) == 2.0);
+
+  // Exchange the input vertices, which has to be detected
+  Eigen::MatrixXd coords(2, 2);
+  coords << 1.0, 0.0,
+            1.0, 0.0;
+  inMesh->moveVertices({0, 1}, coords);
+  BOOST_TEST(mapping.hasMeshChanged());
+  mapping.updateMapping();
+  BOOST_TEST(not mapping.hasMeshChanged());
+  mapping.map(inData->getID(), outData->getID());
+  BOOST_TEST(outData->values()(0) == 2.0);
+  BOOST_TEST(outData->values()(1) == 1.0);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,167 @@
+#include "testing/Testing.hpp"
+
+#include "mapping/PartitionOfUnityMapping.hpp"
+#include "mesh/Mesh.hpp"
+#include "mesh/Data.hpp"
+#include "mesh/Vertex.hpp"
+
+using namespace precice;
+using namespace precice::mapping;
+
+BOOST_AUTO_TEST_SUITE(MappingTests)
+BOOST_AUTO_TEST_SUITE(PartitionOfUnity)
+
+namespace
+{
+/// Creates a regular grid of n^dimensions vertices with the given spacing, shifted by offset
+void createGrid(mesh::Mesh& mesh, int n, double spacing, double offset)
+{
+  int dimensions = mesh.getDimensions();
+  int nz = dimensions == 3 ? n : 1;
+  Eigen::VectorXd coords(dimensions);
+  for (int k = 0; k < nz; k++) {
+    for (int j = 0; j < n; j++) {
+      for (int i = 0; i < n; i++) {
+        coords[0] = offset + i * spacing;
+        coords[1] = offset + j * spacing;
+        if (dimensions == 3)
+          coords[2] = offset + k * spacing;
+        mesh.createVertex(coords);
+      }
+    }
+  }
+}
+
+/// Linear function that is reproduced exactly by the local interpolants
+double linearFunction(const Eigen::VectorXd& coords)
+{
+  double value = 1.0;
+  for (int d = 0; d < coords.size(); d++) {
+    value += (d + 1.0) * coords[d];
+  }
+  return value;
+}
+
+void performConsistentTest(Mapping& mapping, int dimensions)
+{
+  mesh::PtrMesh inMesh(new mesh::Mesh("InMesh", dimensions, false));
+  mesh::PtrData inData = inMesh->createData("InData", 1);
+  createGrid(*inMesh, 7, 0.2, 0.0);
+  inMesh->allocateDataValues();
+  for (mesh::Vertex& v : inMesh->vertices()) {
+    inData->values()[v.getID()] = linearFunction(v.getCoords());
+  }
+
+  mesh::PtrMesh outMesh(new mesh::Mesh("OutMesh", dimensions, false));
+  mesh::PtrData outData = outMesh->createData("OutData", 1);
+  createGrid(*outMesh, 5, 0.27, 0.05);
+  outMesh->allocateDataValues();
+
+  mapping.setMeshes(inMesh, outMesh);
+  BOOST_TEST(not mapping.hasComputedMapping());
+  mapping.computeMapping();
+  BOOST_TEST(mapping.hasComputedMapping());
+  mapping.map(inData->getID(), outData->getID());
+
+  for (mesh::Vertex& v : outMesh->vertices()) {
+    BOOST_TEST(outData->values()[v.getID()] == linearFunction(v.getCoords()));
+  }
+
+  mapping.clear();
+  BOOST_TEST(not mapping.hasComputedMapping());
+}
+
+void performConservativeTest(Mapping& mapping, int dimensions)
+{
+  mesh::PtrMesh inMesh(new mesh::Mesh("InMesh", dimensions, false));
+  mesh::PtrData inData = inMesh->createData("InData", 2);
+  createGrid(*inMesh, 5, 0.27, 0.05);
+  inMesh->allocateDataValues();
+  for (int i = 0; i < inData->values().size(); i++) {
+    inData->values()[i] = 1.0 + 0.5 * (i % 7);
+  }
+
+  mesh::PtrMesh outMesh(new mesh::Mesh("OutMesh", dimensions, false));
+  mesh::PtrData outData = outMesh->createData("OutData", 2);
+  createGrid(*outMesh, 7, 0.2, 0.0);
+  outMesh->allocateDataValues();
+
+  mapping.setMeshes(inMesh, outMesh);
+  mapping.computeMapping();
+  mapping.map(inData->getID(), outData->getID());
+
+  // Sum and first moment are preserved, as constant and linear functions are reproduced
+  Eigen::VectorXd inSum = Eigen::VectorXd::Zero(2);
+  Eigen::VectorXd outSum = Eigen::VectorXd::Zero(2);
+  double inMoment = 0.0;
+  double outMoment = 0.0;
+  for (mesh::Vertex& v : inMesh->vertices()) {
+    inSum += inData->values().segment(v.getID() * 2, 2);
+    inMoment += inData->values()[v.getID() * 2] * linearFunction(v.getCoords());
+  }
+  for (mesh::Vertex& v : outMesh->vertices()) {
+    outSum += outData->values().segment(v.getID() * 2, 2);
+    outMoment += outData->values()[v.getID() * 2] * linearFunction(v.getCoords());
+  }
+  BOOST_TEST(testing::equals(inSum, outSum));
+  BOOST_TEST(inMoment == outMoment);
+}
+} // namespace
+
+BOOST_AUTO_TEST_CASE(MapThinPlateSplines)
+{
+  ThinPlateSplines fct;
+  double patchRadius = 0.5;
+  PartitionOfUnityMapping<ThinPlateSplines> consistentMap2D(Mapping::CONSISTENT, 2, fct, patchRadius, false, false, false);
+  performConsistentTest(consistentMap2D, 2);
+  PartitionOfUnityMapping<ThinPlateSplines> consistentMap3D(Mapping::CONSISTENT, 3, fct, patchRadius, false, false, false);
+  performConsistentTest(consistentMap3D, 3);
+  PartitionOfUnityMapping<ThinPlateSplines> conservativeMap2D(Mapping::CONSERVATIVE, 2, fct, patchRadius, false, false, false);
+  performConservativeTest(conservativeMap2D, 2);
+  PartitionOfUnityMapping<ThinPlateSplines> conservativeMap3D(Mapping::CONSERVATIVE, 3, fct, patchRadius, false, false, false);
+  performConservativeTest(conservativeMap3D, 3);
+}
+
+BOOST_AUTO_TEST_CASE(MapCompactPolynomialC6)
+{
+  CompactPolynomialC6 fct(0.6);
+  double patchRadius = 0.45;
+  PartitionOfUnityMapping<CompactPolynomialC6> consistentMap2D(Mapping::CONSISTENT, 2, fct, patchRadius, false, false, false);
+  performConsistentTest(consistentMap2D, 2);
+  PartitionOfUnityMapping<CompactPolynomialC6> conservativeMap3D(Mapping::CONSERVATIVE, 3, fct, patchRadius, false, false, false);
+  performConservativeTest(conservativeMap3D, 3);
+}
+
+BOOST_AUTO_TEST_CASE(DeadAxis)
+{
+  // All vertices lie in a plane z = const, the z axis is ignored
+  ThinPlateSplines fct;
+  PartitionOfUnityMapping<ThinPlateSplines> mapping(Mapping::CONSISTENT, 3, fct, 0.5, false, false, true);
+
+  mesh::PtrMesh inMesh(new mesh::Mesh("InMesh", 3, false));
+  mesh::PtrData inData = inMesh->createData("InData", 1);
+  for (int j = 0; j < 6; j++) {
+    for (int i = 0; i < 6; i++) {
+      inMesh->createVertex(Eigen::Vector3d(i * 0.2, j * 0.2, 3.0));
+    }
+  }
+  inMesh->allocateDataValues();
+  for (mesh::Vertex& v : inMesh->vertices()) {
+    inData->values()[v.getID()] = 2.0 * v.getCoords()[0] - v.getCoords()[1];
+  }
+
+  mesh::PtrMesh outMesh(new mesh::Mesh("OutMesh", 3, false));
+  mesh::PtrData outData = outMesh->createData("OutData", 1);
+  outMesh->createVertex(Eigen::Vector3d(0.3, 0.5, 3.0));
+  outMesh->createVertex(Eigen::Vector3d(0.9, 0.1, 3.0));
+  outMesh->allocateDataValues();
+
+  mapping.setMeshes(inMesh, outMesh);
+  mapping.computeMapping();
+  mapping.map(inData->getID(), outData->getID());
+  BOOST_TEST(outData->values()[0] == 0.1);
+  BOOST_TEST(outData->values()[1] == 1.7);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
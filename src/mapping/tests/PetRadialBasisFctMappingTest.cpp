@@ -1,6 +1,7 @@
 #ifndef PRECICE_NO_PETSC
 
 #include <Eigen/Core>
+#include <cmath>
 #include "versions.hpp"
 #include "mapping/PetRadialBasisFctMapping.hpp"
 #include "mesh/Mesh.hpp"
@@ -1116,6 +1117,71 @@ BOOST_AUTO_TEST_CASE(MapPetCompactPolynomialC6)
   perform3DTestConservativeMapping(conservativeMap3D);
 }
 
+BOOST_AUTO_TEST_CASE(Preconditioners)
+{
+  double supportRadius = 1.2;
+  bool xDead = false;
+  bool yDead = false;
+  bool zDead = false;
+  CompactPolynomialC6 fct(supportRadius);
+  using Mapping = PetRadialBasisFctMapping<CompactPolynomialC6>;
+  for (Preconditioner preconditioner : {Preconditioner::BLOCK_JACOBI, Preconditioner::ASM}) {
+    Mapping consistentMap2D(Mapping::CONSISTENT, 2, fct, xDead, yDead, zDead, 1e-9,
+                            Polynomial::SEPARATE, Preallocation::TREE, false, preconditioner);
+    perform2DTestConsistentMapping(consistentMap2D);
+    Mapping conservativeMap3D(Mapping::CONSERVATIVE, 3, fct, xDead, yDead, zDead, 1e-9,
+                              Polynomial::SEPARATE, Preallocation::TREE, false, preconditioner);
+    perform3DTestConservativeMapping(conservativeMap3D);
+  }
+}
+
+/// Maps a function from a fine to a coarser grid on the unit square, using the given preallocation
+Eigen::VectorXd mapOnGrids(Preallocation preallocation)
+{
+  using Eigen::Vector2d;
+  int dimensions = 2;
+
+  mesh::PtrMesh inMesh(new mesh::Mesh("InMesh", dimensions, false));
+  mesh::PtrData inData = inMesh->createData("InData", 1);
+  for (int i = 0; i < 60; i++) {
+    for (int j = 0; j < 60; j++) {
+      inMesh->createVertex(Vector2d(i / 59.0, j / 59.0));
+    }
+  }
+  inMesh->allocateDataValues();
+  addGlobalIndex(inMesh);
+  for (const mesh::Vertex& v : inMesh->vertices()) {
+    inData->values()[v.getID()] = std::sin(3.0 * v.getCoords()[0]) + v.getCoords()[1];
+  }
+
+  mesh::PtrMesh outMesh(new mesh::Mesh("OutMesh", dimensions, false));
+  mesh::PtrData outData = outMesh->createData("OutData", 1);
+  for (int i = 0; i < 50; i++) {
+    for (int j = 0; j < 50; j++) {
+      outMesh->createVertex(Vector2d(0.01 + i / 51.0, 0.01 + j / 51.0));
+    }
+  }
+  outMesh->allocateDataValues();
+  addGlobalIndex(outMesh);
+
+  CompactPolynomialC6 fct(0.1);
+  PetRadialBasisFctMapping<CompactPolynomialC6> mapping(Mapping::CONSISTENT, dimensions, fct, false, false, false,
+                                                        1e-9, Polynomial::SEPARATE, preallocation);
+  mapping.setMeshes(inMesh, outMesh);
+  mapping.computeMapping();
+  mapping.map(inData->getID(), outData->getID());
+  return outData->values();
+}
+
+/// Tree preallocation computes the rows on several threads for large meshes
+BOOST_AUTO_TEST_CASE(TreePreallocationOnLargeMeshes)
+{
+  Eigen::VectorXd reference = mapOnGrids(Preallocation::SAVE);
+  Eigen::VectorXd tree      = mapOnGrids(Preallocation::TREE);
+  BOOST_TEST(testing::equals(tree, reference, 1e-7));
+  BOOST_TEST(reference.norm() > 0.0);
+}
+
 BOOST_AUTO_TEST_CASE(DeadAxis2)
 {
   using Eigen::Vector2d;
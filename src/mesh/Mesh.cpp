@@ -121,6 +121,7 @@ Edge& Mesh:: createEdge
   Edge* newEdge = new Edge(vertexOne, vertexTwo, _manageEdgeIDs.getFreeID());
   newEdge->addParent(*this);
   _content.add(newEdge);
+  _revision++;
   return *newEdge;
 }
 
@@ -134,6 +135,8 @@ Triangle& Mesh:: createTriangle
       edgeOne, edgeTwo, edgeThree, _manageTriangleIDs.getFreeID());
   newTriangle->addParent(*this);
   _content.add(newTriangle);
+  _vertexEdges.clear(); // Invalidate adjacency
+  _revision++;
   return *newTriangle;
 }
 
@@ -148,9 +151,47 @@ Quad& Mesh:: createQuad
       edgeOne, edgeTwo, edgeThree, edgeFour, _manageQuadIDs.getFreeID());
   newQuad->addParent(*this);
   _content.add(newQuad);
+  _vertexEdges.clear(); // Invalidate adjacency
+  _revision++;
   return *newQuad;
 }
 
+namespace {
+/// Reserves memory for count additional elements, growing the container at least by factor two.
+template<typename CONTAINER_T>
+void reserveAdditional(CONTAINER_T& container, size_t count)
+{
+  size_t required = container.size() + count;
+  if (required > container.capacity()) {
+    container.reserve(std::max(required, 2 * container.capacity()));
+  }
+}
+
+/// Returns the largest ID of the given elements, or -1 if there are none.
+template<typename CONTAINER_T>
+int maxID(const CONTAINER_T& elements)
+{
+  int maxID = -1;
+  for (const auto& element : elements) {
+    maxID = std::max(maxID, element.getID());
+  }
+  return maxID;
+}
+}
+
+void Mesh:: reserve
+(
+  size_t vertexCount,
+  size_t edgeCount,
+  size_t triangleCount,
+  size_t quadCount )
+{
+  reserveAdditional(_content.vertices(), vertexCount);
+  reserveAdditional(_content.edges(), edgeCount);
+  reserveAdditional(_content.triangles(), triangleCount);
+  reserveAdditional(_content.quads(), quadCount);
+}
+
 PropertyContainer& Mesh:: createPropertyContainer()
 {
   PropertyContainer* newPropertyContainer = new PropertyContainer();
@@ -275,44 +316,92 @@ void Mesh:: allocateDataValues()
   }
 }
 
+namespace {
+
+/// Returns the normalized normal of an edge, used in 2D only.
+Eigen::Vector2d computeNormal(const Edge& edge, bool flipNormals)
+{
+  Eigen::Vector2d edgeVector = edge.vertex(1).getCoords() - edge.vertex(0).getCoords();
+  Eigen::Vector2d normal(-edgeVector[1], edgeVector[0]);
+  if (not flipNormals){
+    normal *= -1.0; // Invert direction if counterclockwise
+  }
+  assertion(math::greater(normal.norm(), 0.0));
+  return normal.normalized();
+}
+
+/// Returns the normal of a triangle, weighted by twice its area.
+Eigen::Vector3d computeWeightedNormal(const Triangle& triangle, bool flipNormals)
+{
+  Eigen::Vector3d vectorA = triangle.edge(1).getCenter() - triangle.edge(0).getCenter(); // edge() is faster than vertex()
+  Eigen::Vector3d vectorB = triangle.edge(2).getCenter() - triangle.edge(0).getCenter();
+  // Compute cross-product of vector A and vector B
+  Eigen::Vector3d normal = vectorA.cross(vectorB);
+  if ( flipNormals ){
+    normal *= -1.0; // Invert direction if counterclockwise
+  }
+  return normal;
+}
+
+/// Returns the normal of a quad, weighted by its area.
+Eigen::Vector3d computeWeightedNormal(const Quad& quad, bool flipNormals)
+{
+  // Two triangles are thought by splitting the quad from vertex 0 to 2.
+  // The cross prodcut of the outer edges of the triangles is used to compute
+  // the normal direction and area of the triangles. The direction must be
+  // the same, while the areas differ in general. The normals are added up
+  // and divided by 2 to get the area of the overall quad, since the length
+  // does correspond to the parallelogram spanned by the vectors of the
+  // cross product, which is twice the area of the corresponding triangles.
+  Eigen::Vector3d vectorA = quad.vertex(2).getCoords() - quad.vertex(1).getCoords();
+  Eigen::Vector3d vectorB = quad.vertex(0).getCoords() - quad.vertex(1).getCoords();
+  // Compute cross-product of vector A and vector B
+  Eigen::Vector3d normal = vectorA.cross(vectorB);
+
+  vectorA = quad.vertex(0).getCoords() - quad.vertex(3).getCoords();
+  vectorB = quad.vertex(2).getCoords() - quad.vertex(3).getCoords();
+  Eigen::Vector3d normalSecondPart = vectorA.cross(vectorB);
+
+  assertion(math::equals(normal.normalized(), normalSecondPart.normalized()),
+            normal, normalSecondPart);
+  normal += normalSecondPart;
+  normal *= 0.5;
+
+  if ( flipNormals ){
+    normal *= -1.0; // Invert direction if counterclockwise
+  }
+  return normal;
+}
+
+}
+
+bool Mesh:: hasNormalInformation() const
+{
+  if (_dimensions == 2){
+    return not _content.edges().empty();
+  }
+  assertion(_dimensions == 3, _dimensions);
+  return not (_content.triangles().empty() && _content.quads().empty());
+}
+
 void Mesh:: computeState()
 {
   TRACE(_name);
   assertion(_dimensions==2 || _dimensions==3, _dimensions);
 
   // Compute normals only if faces to derive normal information are available
-  bool computeNormals = true;
-  size_t size2DFaces = _content.edges().size();
-  size_t size3DFaces = _content.triangles().size() + _content.quads().size();
-  if (_dimensions == 2){
-    if (size2DFaces == 0){
-      computeNormals = false;
-    }
-  }
-  else if (size3DFaces == 0){
-    assertion(_dimensions == 3, _dimensions);
-    computeNormals = false;
-  }
+  bool computeNormals = hasNormalInformation();
 
   // Compute (in 2D) edge normals
-  for (Edge& edge : _content.edges()) {
-    if (_dimensions == 2 && computeNormals) {
-      // Compute normal
-      Eigen::VectorXd edgeVector = edge.vertex(1).getCoords() - edge.vertex(0).getCoords();
-      Eigen::VectorXd normal = Eigen::Vector2d(-edgeVector[1], edgeVector[0]);
-      if (not _flipNormals){
-        normal *= -1.0; // Invert direction if counterclockwise
-      }
-      assertion(math::greater(normal.norm(), 0.0));
-      normal.normalize();   // Scale normal vector to length 1
+  if (_dimensions == 2 && computeNormals) {
+    for (Edge& edge : _content.edges()) {
+      Eigen::Vector2d normal = computeNormal(edge, _flipNormals);
       edge.setNormal(normal);
 
       // Accumulate normal in associated vertices
       normal *= edge.getEnclosingRadius() * 2.0; // Weight by length
       for (int i=0; i < 2; i++){
-        Eigen::VectorXd vertexNormal = edge.vertex(i).getNormal();
-        vertexNormal += normal;
-        edge.vertex(i).setNormal(vertexNormal);
+        edge.vertex(i).setNormal(edge.vertex(i).getNormal() + normal);
       }
     }
   }
@@ -329,13 +418,7 @@ void Mesh:: computeState()
 
       // Compute normals
       if (computeNormals){
-        Eigen::Vector3d vectorA = triangle.edge(1).getCenter() - triangle.edge(0).getCenter(); // edge() is faster than vertex()
-        Eigen::Vector3d vectorB = triangle.edge(2).getCenter() - triangle.edge(0).getCenter();
-        // Compute cross-product of vector A and vector B
-        auto normal = vectorA.cross(vectorB);
-        if ( _flipNormals ){
-          normal *= -1.0; // Invert direction if counterclockwise
-        }
+        Eigen::Vector3d normal = computeWeightedNormal(triangle, _flipNormals);
 
         // Accumulate area-weighted normal in associated vertices and edges
         for (int i=0; i < 3; i++){
@@ -357,30 +440,7 @@ void Mesh:: computeState()
 
       // Compute normals (assuming all vertices are on same plane)
       if (computeNormals) {
-        // Two triangles are thought by splitting the quad from vertex 0 to 2.
-        // The cross prodcut of the outer edges of the triangles is used to compute
-        // the normal direction and area of the triangles. The direction must be
-        // the same, while the areas differ in general. The normals are added up
-        // and divided by 2 to get the area of the overall quad, since the length
-        // does correspond to the parallelogram spanned by the vectors of the
-        // cross product, which is twice the area of the corresponding triangles.
-        Eigen::Vector3d vectorA = quad.vertex(2).getCoords() - quad.vertex(1).getCoords();
-        Eigen::Vector3d vectorB = quad.vertex(0).getCoords() - quad.vertex(1).getCoords();
-        // Compute cross-product of vector A and vector B
-        auto normal = vectorA.cross(vectorB);
-        
-        vectorA = quad.vertex(0).getCoords() - quad.vertex(3).getCoords();
-        vectorB = quad.vertex(2).getCoords() - quad.vertex(3).getCoords();
-        auto normalSecondPart = vectorA.cross(vectorB);
-        
-        assertion(math::equals(normal.normalized(), normalSecondPart.normalized()),
-                  normal, normalSecondPart);
-        normal += normalSecondPart;
-        normal *= 0.5;
-
-        if ( _flipNormals ){
-          normal *= -1.0; // Invert direction if counterclockwise
-        }
+        Eigen::Vector3d normal = computeWeightedNormal(quad, _flipNormals);
 
         // Accumulate area-weighted normal in associated vertices and edges
         for (int i=0; i < 4; i++){
@@ -401,17 +461,24 @@ void Mesh:: computeState()
     }
   }
 
-  // Normalize vertex normals & compute bounding box
+  // Normalize vertex normals
+  if (computeNormals) {
+    for (Vertex& vertex : _content.vertices()) {
+      // there can be cases when a vertex has no edge though edges exist in general (e.g. after filtering)
+      vertex.setNormal(vertex.getNormal().normalized());
+    }
+  }
+
+  computeBoundingBox();
+}
+
+void Mesh:: computeBoundingBox()
+{
   _boundingBox = BoundingBox (_dimensions,
                               std::make_pair(std::numeric_limits<double>::max(),
                                              std::numeric_limits<double>::lowest()));
 
-  for (Vertex& vertex : _content.vertices()) {
-    if (computeNormals) {
-      // there can be cases when a vertex has no edge though edges exist in general (e.g. after filtering)
-      vertex.setNormal(vertex.getNormal().normalized());
-    }
-    
+  for (const Vertex& vertex : _content.vertices()) {
     for (int d = 0; d < _dimensions; d++) {
       _boundingBox[d].first  = std::min(vertex.getCoords()[d], _boundingBox[d].first);
       _boundingBox[d].second = std::max(vertex.getCoords()[d], _boundingBox[d].second);
@@ -422,6 +489,166 @@ void Mesh:: computeState()
   }
 }
 
+void Mesh:: computeAdjacency()
+{
+  // New vertices and edges are detected by size, new faces clear the adjacency
+  if (not _vertexEdges.empty() &&
+      _vertexEdges.size() == _content.vertices().size() &&
+      _edgeTriangles.size() == _content.edges().size()) {
+    return;
+  }
+  TRACE(_name);
+
+  size_t vertexCount = _content.vertices().size();
+  size_t edgeCount = _content.edges().size();
+  _vertexEdges.assign(vertexCount, std::vector<int>());
+  _vertexTriangles.assign(vertexCount, std::vector<int>());
+  _vertexQuads.assign(vertexCount, std::vector<int>());
+  _edgeTriangles.assign(edgeCount, std::vector<int>());
+  _edgeQuads.assign(edgeCount, std::vector<int>());
+
+  for (size_t i = 0; i < edgeCount; i++) {
+    const Edge& edge = _content.edges()[i];
+    for (int j = 0; j < 2; j++) {
+      _vertexEdges[edge.vertex(j).getID()].push_back(i);
+    }
+  }
+  for (size_t i = 0; i < _content.triangles().size(); i++) {
+    const Triangle& triangle = _content.triangles()[i];
+    for (int j = 0; j < 3; j++) {
+      _vertexTriangles[triangle.vertex(j).getID()].push_back(i);
+      _edgeTriangles[triangle.edge(j).getID()].push_back(i);
+    }
+  }
+  for (size_t i = 0; i < _content.quads().size(); i++) {
+    const Quad& quad = _content.quads()[i];
+    for (int j = 0; j < 4; j++) {
+      _vertexQuads[quad.vertex(j).getID()].push_back(i);
+      _edgeQuads[quad.edge(j).getID()].push_back(i);
+    }
+  }
+}
+
+void Mesh:: moveVertices
+(
+  const std::vector<int>& vertexIDs,
+  const Eigen::MatrixXd&  coords )
+{
+  TRACE(_name, vertexIDs.size());
+  assertion(coords.rows() == _dimensions, coords.rows(), _dimensions);
+  assertion(coords.cols() == static_cast<int>(vertexIDs.size()), coords.cols(), vertexIDs.size());
+  computeAdjacency();
+
+  // Collect all elements whose geometry is affected by the moved vertices
+  std::vector<bool> isEdgeAffected(_content.edges().size(), false);
+  std::vector<bool> isTriangleAffected(_content.triangles().size(), false);
+  std::vector<bool> isQuadAffected(_content.quads().size(), false);
+  std::vector<PrimitiveIndex> primitives;
+  for (int vertexID : vertexIDs) {
+    assertion(_content.vertices()[vertexID].getID() == vertexID, vertexID);
+    primitives.push_back({Primitive::Vertex, static_cast<size_t>(vertexID)});
+    for (int edge : _vertexEdges[vertexID]) {
+      if (not isEdgeAffected[edge]) {
+        isEdgeAffected[edge] = true;
+        primitives.push_back({Primitive::Edge, static_cast<size_t>(edge)});
+      }
+    }
+    for (int triangle : _vertexTriangles[vertexID]) {
+      if (not isTriangleAffected[triangle]) {
+        isTriangleAffected[triangle] = true;
+        primitives.push_back({Primitive::Triangle, static_cast<size_t>(triangle)});
+      }
+    }
+    for (int quad : _vertexQuads[vertexID]) {
+      if (not isQuadAffected[quad]) {
+        isQuadAffected[quad] = true;
+        primitives.push_back({Primitive::Quad, static_cast<size_t>(quad)});
+      }
+    }
+  }
+
+  rtree::update(*this, primitives, [&]() {
+    for (size_t i = 0; i < vertexIDs.size(); i++) {
+      _content.vertices()[vertexIDs[i]].setCoords(coords.col(i));
+    }
+  });
+  _revision++;
+
+  if (hasNormalInformation()) {
+    // Normals of vertices and edges depend on all adjacent faces, so these
+    // are recomputed from scratch for the vertices and edges of affected faces.
+    std::vector<bool> isVertexUpdated(_content.vertices().size(), false);
+    std::vector<bool> isEdgeUpdated(_content.edges().size(), false);
+
+    if (_dimensions == 2) {
+      for (const auto& primitive : primitives) {
+        if (primitive.type != Primitive::Edge) continue;
+        Edge& edge = _content.edges()[primitive.index];
+        edge.setNormal(computeNormal(edge, _flipNormals));
+      }
+      for (const auto& primitive : primitives) {
+        if (primitive.type != Primitive::Edge) continue;
+        for (int i = 0; i < 2; i++) {
+          Vertex& vertex = _content.edges()[primitive.index].vertex(i);
+          if (isVertexUpdated[vertex.getID()]) continue;
+          isVertexUpdated[vertex.getID()] = true;
+          Eigen::Vector2d normal = Eigen::Vector2d::Zero();
+          for (int adjacentEdge : _vertexEdges[vertex.getID()]) {
+            const Edge& edge = _content.edges()[adjacentEdge];
+            normal += edge.getNormal() * edge.getEnclosingRadius() * 2.0; // Weight by length
+          }
+          vertex.setNormal(normal.normalized());
+        }
+      }
+    }
+    else {
+      assertion(_dimensions == 3, _dimensions);
+      // Area-weighted normals of all faces adjacent to the affected vertices and edges
+      auto sumNormals = [&](const std::vector<int>& triangles, const std::vector<int>& quads) {
+        Eigen::Vector3d normal = Eigen::Vector3d::Zero();
+        for (int triangle : triangles) {
+          normal += computeWeightedNormal(_content.triangles()[triangle], _flipNormals);
+        }
+        for (int quad : quads) {
+          normal += computeWeightedNormal(_content.quads()[quad], _flipNormals);
+        }
+        return normal;
+      };
+
+      for (const auto& primitive : primitives) {
+        if (primitive.type == Primitive::Triangle) {
+          Triangle& triangle = _content.triangles()[primitive.index];
+          triangle.setNormal(computeWeightedNormal(triangle, _flipNormals).normalized());
+          for (int i = 0; i < 3; i++) {
+            isVertexUpdated[triangle.vertex(i).getID()] = true;
+            isEdgeUpdated[triangle.edge(i).getID()] = true;
+          }
+        }
+        else if (primitive.type == Primitive::Quad) {
+          Quad& quad = _content.quads()[primitive.index];
+          quad.setNormal(computeWeightedNormal(quad, _flipNormals).normalized());
+          for (int i = 0; i < 4; i++) {
+            isVertexUpdated[quad.vertex(i).getID()] = true;
+            isEdgeUpdated[quad.edge(i).getID()] = true;
+          }
+        }
+      }
+      for (size_t i = 0; i < isEdgeUpdated.size(); i++) {
+        if (isEdgeUpdated[i]) {
+          _content.edges()[i].setNormal(sumNormals(_edgeTriangles[i], _edgeQuads[i]).normalized());
+        }
+      }
+      for (size_t i = 0; i < isVertexUpdated.size(); i++) {
+        if (isVertexUpdated[i]) {
+          _content.vertices()[i].setNormal(sumNormals(_vertexTriangles[i], _vertexQuads[i]).normalized());
+        }
+      }
+    }
+  }
+
+  computeBoundingBox();
+}
+
     
 void Mesh:: clear()
 {
@@ -436,6 +663,8 @@ void Mesh:: clear()
   _manageTriangleIDs.resetIDs();
   _manageEdgeIDs.resetIDs();
   _manageVertexIDs.resetIDs();
+  _vertexEdges.clear(); // Invalidate adjacency
+  _revision++;
 
   meshChanged(*this);
   
@@ -444,6 +673,10 @@ void Mesh:: clear()
   }
 }
 
+std::size_t Mesh:: getRevision() const
+{
+  return _revision;
+}
 
 void Mesh:: addMesh(
     Mesh& deltaMesh)
@@ -451,13 +684,16 @@ void Mesh:: addMesh(
   TRACE();
   assertion(_dimensions==deltaMesh.getDimensions());
 
-  std::map<int, Vertex*> vertexMap;
-  std::map<int, Edge*> edgeMap;
+  reserve(deltaMesh.vertices().size(), deltaMesh.edges().size(),
+          deltaMesh.triangles().size(), deltaMesh.quads().size());
+
+  // Dense tables from the IDs of the delta mesh to the created elements, as the
+  // created elements may have different IDs.
+  std::vector<Vertex*> vertexMap(maxID(deltaMesh.vertices()) + 1, nullptr);
+  std::vector<Edge*> edgeMap(maxID(deltaMesh.edges()) + 1, nullptr);
 
-  Eigen::VectorXd coords(_dimensions);
   for ( const Vertex& vertex : deltaMesh.vertices() ){
-    coords = vertex.getCoords();
-    Vertex& v = createVertex (coords);
+    Vertex& v = createVertex (vertex.getCoords());
     v.setGlobalIndex(vertex.getGlobalIndex());
     if(vertex.isTagged()) v.tag();
     v.setOwner(vertex.isOwner());
@@ -465,27 +701,29 @@ void Mesh:: addMesh(
     vertexMap[vertex.getID()] = &v;
   }
 
-  // you cannot just take the vertices from the edge and add them,
-  // since you need the vertices from the new mesh
-  // (which may differ in IDs)
   for (const Edge& edge : deltaMesh.edges()) {
-    int vertexIndex1 = edge.vertex(0).getID();
-    int vertexIndex2 = edge.vertex(1).getID();
-    assertion ( vertexMap.find(vertexIndex1) != vertexMap.end() );
-    assertion ( vertexMap.find(vertexIndex2) != vertexMap.end() );
-    Edge& e = createEdge(*vertexMap[vertexIndex1], *vertexMap[vertexIndex2]);
-    edgeMap[edge.getID()] = &e;
+    Vertex* vertex1 = vertexMap[edge.vertex(0).getID()];
+    Vertex* vertex2 = vertexMap[edge.vertex(1).getID()];
+    assertion ( vertex1 != nullptr );
+    assertion ( vertex2 != nullptr );
+    edgeMap[edge.getID()] = &createEdge(*vertex1, *vertex2);
   }
 
   if(_dimensions==3){
     for (const Triangle& triangle : deltaMesh.triangles() ) {
-      int edgeIndex1 = triangle.edge(0).getID();
-      int edgeIndex2 = triangle.edge(1).getID();
-      int edgeIndex3 = triangle.edge(2).getID();
-      assertion ( edgeMap.find(edgeIndex1) != edgeMap.end() );
-      assertion ( edgeMap.find(edgeIndex2) != edgeMap.end() );
-      assertion ( edgeMap.find(edgeIndex3) != edgeMap.end() );
-      createTriangle(*edgeMap[edgeIndex1],*edgeMap[edgeIndex2],*edgeMap[edgeIndex3]);
+      Edge* edge1 = edgeMap[triangle.edge(0).getID()];
+      Edge* edge2 = edgeMap[triangle.edge(1).getID()];
+      Edge* edge3 = edgeMap[triangle.edge(2).getID()];
+      assertion ( edge1 != nullptr && edge2 != nullptr && edge3 != nullptr );
+      createTriangle(*edge1, *edge2, *edge3);
+    }
+    for (const Quad& quad : deltaMesh.quads() ) {
+      Edge* edges[4];
+      for (int i = 0; i < 4; i++) {
+        edges[i] = edgeMap[quad.edge(i).getID()];
+        assertion ( edges[i] != nullptr );
+      }
+      createQuad(*edges[0], *edges[1], *edges[2], *edges[3]);
     }
   }
   meshChanged(*this);
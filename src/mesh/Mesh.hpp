@@ -121,6 +121,7 @@ public:
     Vertex* newVertex = new Vertex(coords, _manageVertexIDs.getFreeID());
     newVertex->addParent(*this);
     _content.add(newVertex);
+    _revision++;
     return *newVertex;
   }
 
@@ -160,6 +161,18 @@ public:
     Edge& edgeThree,
     Edge& edgeFour);
 
+  /**
+   * @brief Reserves memory for the given number of additional mesh elements.
+   *
+   * Used before the bulk creation of elements. Memory grows at least geometrically,
+   * such that adding many small meshes does not reallocate every time.
+   */
+  void reserve (
+    size_t vertexCount,
+    size_t edgeCount,
+    size_t triangleCount,
+    size_t quadCount );
+
   /**
    * @brief Creates and initializes a PropertyContainer object.
    *
@@ -220,6 +233,21 @@ public:
    */
   void computeState();
 
+  /**
+   * @brief Moves vertices and updates the mesh state incrementally.
+   *
+   * Only the normals of elements adjacent to moved vertices are recomputed, and
+   * the affected entries of cached RTrees are replaced instead of rebuilding the
+   * trees. As the topology is unchanged, meshChanged is not emitted. computeState()
+   * has to be called once before.
+   *
+   * @param[in] vertexIDs IDs of the vertices to move.
+   * @param[in] coords New coordinates, one column per moved vertex.
+   */
+  void moveVertices (
+    const std::vector<int>& vertexIDs,
+    const Eigen::MatrixXd&  coords );
+
   /**
    * @brief Removes all mesh elements and data values (does not remove data).
    *
@@ -231,6 +259,15 @@ public:
    */
   void clear();
 
+  /**
+   * @brief Returns the revision of the mesh geometry.
+   *
+   * The revision is incremented whenever mesh elements are created, vertices are
+   * moved, or the mesh is cleared. Comparing revisions is a cheap way to detect if
+   * anything computed from the mesh is outdated.
+   */
+  std::size_t getRevision() const;
+
   /// Returns a mapping from rank to used (not necessarily owned) vertex IDs
   VertexDistribution & getVertexDistribution()
   {
@@ -340,6 +377,26 @@ private:
 
   BoundingBox _boundingBox;
 
+  /// Revision of the mesh geometry, see getRevision().
+  std::size_t _revision = 0;
+
+  /// Adjacent edges, triangles and quads per vertex index, built on demand by moveVertices().
+  std::vector<std::vector<int>> _vertexEdges;
+  std::vector<std::vector<int>> _vertexTriangles;
+  std::vector<std::vector<int>> _vertexQuads;
+
+  /// Adjacent triangles and quads per edge index, built on demand by moveVertices().
+  std::vector<std::vector<int>> _edgeTriangles;
+  std::vector<std::vector<int>> _edgeQuads;
+
+  /// Returns true, if faces are available to derive normals from.
+  bool hasNormalInformation() const;
+
+  /// Computes the bounding box from all vertices.
+  void computeBoundingBox();
+
+  /// Builds the adjacency information, if it is missing or outdated.
+  void computeAdjacency();
 };
 
 std::ostream& operator<<(std::ostream& os, const Mesh& q);
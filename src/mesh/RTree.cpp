@@ -48,6 +48,31 @@ void rtree::clear(Mesh &mesh)
   _primitive_trees.erase(mesh.getID());
 }
 
+void rtree::update(const Mesh & mesh, const std::vector<PrimitiveIndex> & primitives,
+                   const std::function<void()> & change)
+{
+  auto vertexTree = _vertex_trees.find(mesh.getID());
+  auto primitiveTree = _primitive_trees.find(mesh.getID());
+  impl::AABBGenerator gen{mesh};
+
+  // Removal needs the old geometry to locate the entries
+  for (const auto & primitive : primitives) {
+    if (vertexTree != _vertex_trees.end() && primitive.type == Primitive::Vertex)
+      vertexTree->second->remove(primitive.index);
+    if (primitiveTree != _primitive_trees.end())
+      primitiveTree->second->remove(std::make_pair(gen(primitive), primitive));
+  }
+
+  change();
+
+  for (const auto & primitive : primitives) {
+    if (vertexTree != _vertex_trees.end() && primitive.type == Primitive::Vertex)
+      vertexTree->second->insert(primitive.index);
+    if (primitiveTree != _primitive_trees.end())
+      primitiveTree->second->insert(std::make_pair(gen(primitive), primitive));
+  }
+}
+
 
 Box3d getEnclosingBox(Vertex const & middlePoint, double sphereRadius)
 {
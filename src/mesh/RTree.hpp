@@ -1,5 +1,6 @@
 #pragma once
 
+#include <functional>
 #include <map>
 #include <memory>
 #include "mesh/impl/RTreeAdapter.hpp"
@@ -113,6 +114,15 @@ public:
   /// Only clear the trees of that specific mesh
   static void clear(Mesh & mesh);
 
+  /// Updates the cached trees of a mesh for primitives whose geometry is changed by a function
+  /*
+   * The given primitives are removed from the cached trees, change is called, and the
+   * primitives are inserted again with their new bounding boxes. This avoids rebuilding
+   * the trees when only parts of a mesh move.
+   */
+  static void update(const Mesh & mesh, const std::vector<PrimitiveIndex> & primitives,
+                     const std::function<void()> & change);
+
   friend struct MeshTests::RTree::CacheClearing;
   
 private:
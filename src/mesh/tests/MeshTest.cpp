@@ -200,6 +200,74 @@ BOOST_AUTO_TEST_CASE(ComputeState_3D_Quad)
 }
 
 
+BOOST_AUTO_TEST_CASE(MoveVertices_3D)
+{
+  // Builds a mesh of two triangles and one quad
+  auto createMesh = [](Mesh & mesh, const Vector3d & coordsV3) {
+    Vertex& v1 = mesh.createVertex ( Vector3d(0.0, 0.0, 0.0) );
+    Vertex& v2 = mesh.createVertex ( Vector3d(1.0, 0.0, 0.0) );
+    Vertex& v3 = mesh.createVertex ( coordsV3 );
+    Vertex& v4 = mesh.createVertex ( Vector3d(1.0, 1.0, 0.0) );
+    Vertex& v5 = mesh.createVertex ( Vector3d(2.0, 0.0, 0.0) );
+    Vertex& v6 = mesh.createVertex ( Vector3d(2.0, 1.0, 0.0) );
+    Edge& e1 = mesh.createEdge ( v1, v2 );
+    Edge& e2 = mesh.createEdge ( v2, v3 );
+    Edge& e3 = mesh.createEdge ( v3, v1 );
+    Edge& e4 = mesh.createEdge ( v2, v4 );
+    Edge& e5 = mesh.createEdge ( v4, v3 );
+    Edge& e6 = mesh.createEdge ( v2, v5 );
+    Edge& e7 = mesh.createEdge ( v5, v6 );
+    Edge& e8 = mesh.createEdge ( v6, v4 );
+    mesh.createTriangle ( e1, e2, e3 );
+    mesh.createTriangle ( e4, e5, e2 );
+    mesh.createQuad ( e6, e7, e8, e4 );
+    mesh.computeState();
+  };
+  Vector3d newCoords(0.0, 1.0, 0.5);
+  Mesh moved ( "MovedMesh", 3, false );
+  createMesh(moved, Vector3d(0.0, 1.0, 0.0));
+  moved.moveVertices({2}, newCoords);
+
+  // The incremental update has to match a mesh that is computed from scratch
+  Mesh recomputed ( "RecomputedMesh", 3, false );
+  createMesh(recomputed, newCoords);
+
+  BOOST_TEST ( equals(moved.vertices()[2].getCoords(), newCoords) );
+  for (size_t i = 0; i < moved.vertices().size(); i++) {
+    BOOST_TEST ( equals(moved.vertices()[i].getNormal(), recomputed.vertices()[i].getNormal()) );
+  }
+  for (size_t i = 0; i < moved.edges().size(); i++) {
+    BOOST_TEST ( equals(moved.edges()[i].getNormal(), recomputed.edges()[i].getNormal()) );
+  }
+  for (size_t i = 0; i < moved.triangles().size(); i++) {
+    BOOST_TEST ( equals(moved.triangles()[i].getNormal(), recomputed.triangles()[i].getNormal()) );
+  }
+  BOOST_TEST ( equals(moved.quads()[0].getNormal(), recomputed.quads()[0].getNormal()) );
+  BOOST_TEST ( moved.getBoundingBox() == recomputed.getBoundingBox() );
+}
+
+BOOST_AUTO_TEST_CASE(MoveVertices_2D)
+{
+  Mesh mesh ( "MyMesh", 2, false );
+  Vertex& v1 = mesh.createVertex ( Vector2d(0.0, 0.0) );
+  Vertex& v2 = mesh.createVertex ( Vector2d(1.0, 0.0) );
+  Vertex& v3 = mesh.createVertex ( Vector2d(2.0, 0.0) );
+  Edge& e1 = mesh.createEdge ( v1, v2 );
+  Edge& e2 = mesh.createEdge ( v2, v3 );
+  mesh.computeState();
+
+  Eigen::MatrixXd coords(2, 1);
+  coords << 2.0, 1.0;
+  mesh.moveVertices({2}, coords);
+
+  BOOST_TEST ( equals(e1.getNormal(), Vector2d(0.0, -1.0)) );
+  BOOST_TEST ( equals(e2.getNormal(), Vector2d(1.0, -1.0).normalized()) );
+  BOOST_TEST ( equals(v1.getNormal(), Vector2d(0.0, -1.0)) );
+  BOOST_TEST ( equals(v2.getNormal(), Vector2d(1.0, -2.0).normalized()) );
+  BOOST_TEST ( equals(v3.getNormal(), Vector2d(1.0, -1.0).normalized()) );
+  BOOST_TEST ( mesh.getBoundingBox()[1].second == 1.0 );
+}
+
 BOOST_AUTO_TEST_CASE(BoundingBoxCOG_2D)
 {
   Eigen::Vector2d coords0(2, 0);
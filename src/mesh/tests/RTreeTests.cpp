@@ -326,6 +326,38 @@ BOOST_AUTO_TEST_CASE(CacheClearing)
   BOOST_TEST(rtree::_primitive_trees.size() == 0);
 }
 
+BOOST_AUTO_TEST_CASE(UpdateMovedVertices)
+{
+  PtrMesh mesh(new precice::mesh::Mesh("MyMesh", 2, false));
+  auto & v1 = mesh->createVertex(Eigen::Vector2d(0, 0));
+  auto & v2 = mesh->createVertex(Eigen::Vector2d(1, 0));
+  mesh->createEdge(v1, v2);
+  mesh->computeState();
+
+  auto vTree = rtree::getVertexRTree(mesh);
+  auto pTree = rtree::getPrimitiveRTree(mesh);
+
+  Eigen::MatrixXd coords(2, 1);
+  coords << 5, 5;
+  mesh->moveVertices({1}, coords);
+
+  // The cached trees are kept and contain the moved primitives
+  BOOST_TEST(rtree::getVertexRTree(mesh) == vTree);
+  BOOST_TEST(rtree::getPrimitiveRTree(mesh) == pTree);
+  BOOST_TEST(vTree->size() == 2);
+  BOOST_TEST(pTree->size() == 3);
+
+  std::vector<size_t> nearest;
+  vTree->query(bgi::nearest(Eigen::VectorXd(Eigen::Vector2d(4, 4)), 1), std::back_inserter(nearest));
+  BOOST_TEST(nearest.size() == 1);
+  BOOST_TEST(nearest.front() == 1);
+
+  std::vector<std::pair<AABB, PrimitiveIndex>> intersecting;
+  pTree->query(bgi::intersects(Eigen::VectorXd(Eigen::Vector2d(3, 3))), std::back_inserter(intersecting));
+  BOOST_TEST(intersecting.size() == 1);
+  BOOST_TEST(intersecting.front().second == (PrimitiveIndex{Primitive::Edge, 0}));
+}
+
 BOOST_AUTO_TEST_CASE(PrimitveIndexComparison) {
   PrimitiveIndex a{Primitive::Vertex, 2lu};
   PrimitiveIndex b{Primitive::Vertex, 2lu};
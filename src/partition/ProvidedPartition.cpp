@@ -27,50 +27,36 @@ void ProvidedPartition::communicate()
   //@todo communication to more than one participant
 
   if (_hasToSend) {
-    Event e1("partition.gatherMesh." + _mesh->getName(), precice::syncMode);
+    // The global mesh is streamed to the remote master in chunks, one per rank in rank
+    // order, such that the master never holds more than its own and one slave mesh.
+    INFO("Gather and send global mesh " << _mesh->getName());
+    Event e("partition.gatherMesh." + _mesh->getName(), precice::syncMode);
 
-    // Temporary globalMesh such that the master also keeps his local mesh
-    mesh::Mesh globalMesh(_mesh->getName(), _mesh->getDimensions(), _mesh->isFlipNormals());
-
-    if (not utils::MasterSlave::_slaveMode) {
-      globalMesh.addMesh(*_mesh); // Add local master mesh to global mesh
-    }
-
-    // Gather Mesh
-    INFO("Gather mesh " + _mesh->getName());
-    if (utils::MasterSlave::_slaveMode ) {
-        com::CommunicateMesh(utils::MasterSlave::_communication).sendMesh(*_mesh, 0);
+    if (utils::MasterSlave::_slaveMode) {
+      com::CommunicateMesh(utils::MasterSlave::_communication).sendMesh(*_mesh, 0);
     }
-    if (utils::MasterSlave::_masterMode)  {
-      assertion(utils::MasterSlave::_rank == 0);
-      assertion(utils::MasterSlave::_size > 1);
+    else {
+      int numberOfChunks = utils::MasterSlave::_masterMode ? utils::MasterSlave::_size : 1;
+      _m2n->getMasterCommunication()->send(numberOfChunks, 0);
 
-      for (int rankSlave = 1; rankSlave < utils::MasterSlave::_size; rankSlave++) {
-        com::CommunicateMesh(utils::MasterSlave::_communication).receiveMesh(globalMesh, rankSlave);
-        DEBUG("Received sub-mesh, from slave: " << rankSlave << ", global vertexCount: " << globalMesh.vertices().size());
-      }
-    }
-    
-    // Set global index
-    if (not utils::MasterSlave::_slaveMode) {
+      // Global indices of the master vertices are the same as set later in compute()
       int globalIndex = 0;
-      for (mesh::Vertex &v : globalMesh.vertices()) {
-        v.setGlobalIndex(globalIndex);
-        globalIndex++;
+      for (mesh::Vertex &v : _mesh->vertices()) {
+        v.setGlobalIndex(globalIndex++);
       }
+      com::CommunicateMesh(_m2n->getMasterCommunication()).sendMesh(*_mesh, 0);
+
+      for (int rankSlave = 1; rankSlave < numberOfChunks; rankSlave++) {
+        mesh::Mesh slaveMesh(_mesh->getName(), _mesh->getDimensions(), _mesh->isFlipNormals());
+        com::CommunicateMesh(utils::MasterSlave::_communication).receiveMesh(slaveMesh, rankSlave);
+        for (mesh::Vertex &v : slaveMesh.vertices()) {
+          v.setGlobalIndex(globalIndex++);
+        }
+        com::CommunicateMesh(_m2n->getMasterCommunication()).sendMesh(slaveMesh, 0);
+        DEBUG("Forwarded sub-mesh of slave: " << rankSlave << ", global vertexCount: " << globalIndex);
+      }
+      CHECK(globalIndex > 0, "The provided mesh " << _mesh->getName() << " is invalid (possibly empty).");
     }
-
-    e1.stop();
-
-    // Send (global) Mesh
-    INFO("Send global mesh " << _mesh->getName());
-    Event e2("partition.sendGlobalMesh." + _mesh->getName(), precice::syncMode);
-    if (not utils::MasterSlave::_slaveMode) {
-      CHECK(globalMesh.vertices().size() > 0, "The provided mesh " << globalMesh.getName() << " is invalid (possibly empty).");
-      com::CommunicateMesh(_m2n->getMasterCommunication()).sendMesh(globalMesh, 0);
-    }
-    e2.stop();
-
   } //_hasToSend
 }
 
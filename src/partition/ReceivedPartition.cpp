@@ -36,7 +36,12 @@ void ReceivedPartition::communicate()
   Event e("partition.receiveGlobalMesh." + _mesh->getName(), precice::syncMode);
   if (not utils::MasterSlave::_slaveMode) {
     assertion(_mesh->vertices().size() == 0);
-    com::CommunicateMesh(_m2n->getMasterCommunication()).receiveMesh(*_mesh, 0);
+    // The global mesh arrives in chunks, see ProvidedPartition::communicate()
+    int numberOfChunks = 0;
+    _m2n->getMasterCommunication()->receive(numberOfChunks, 0);
+    for (int chunk = 0; chunk < numberOfChunks; chunk++) {
+      com::CommunicateMesh(_m2n->getMasterCommunication()).receiveMesh(*_mesh, 0);
+    }
   }
 }
 
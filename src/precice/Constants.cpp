@@ -50,6 +50,12 @@ const std::string& actionPlotOutput()
   return plotOutput;
 }
 
+const std::string& actionWriteSimulationCheckpoint()
+{
+  static std::string writeSimulationCheckpoint("write-simulation-checkpoint");
+  return writeSimulationCheckpoint;
+}
+
 int exportVTK()
 {
   return io::constants::exportVTK();
@@ -16,6 +16,7 @@ const std::string& actionWriteInitialData();
 const std::string& actionWriteIterationCheckpoint();
 const std::string& actionReadIterationCheckpoint();
 const std::string& actionPlotOutput();
+const std::string& actionWriteSimulationCheckpoint();
 
 int exportVTK();
 int exportAll();
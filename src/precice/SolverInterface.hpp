@@ -46,6 +46,7 @@ namespace PreciceTests {
   namespace Server {
     struct testCouplingModeWithOneServer;
     struct testCouplingModeParallelWithOneServer;
+    struct testBatchedMeshRequests;
   }
 }
 
@@ -614,6 +615,7 @@ private:
   friend struct PreciceTests::Serial::testMultiCoupling;
   friend struct PreciceTests::Server::testCouplingModeWithOneServer;
   friend struct PreciceTests::Server::testCouplingModeParallelWithOneServer;
+  friend struct PreciceTests::Server::testBatchedMeshRequests;
 
 };
 
@@ -19,3 +19,7 @@ const char* precicec_actionReadIterationCheckpoint()
   return precice::constants::actionReadIterationCheckpoint().c_str();
 }
 
+const char* precicec_actionWriteSimulationCheckpoint()
+{
+  return precice::constants::actionWriteSimulationCheckpoint().c_str();
+}
@@ -1,5 +1,6 @@
 #include "Configuration.hpp"
 #include "xml/XMLAttribute.hpp"
+#include "utils/EventTimings.hpp"
 
 
 namespace precice {
@@ -30,6 +31,13 @@ Configuration:: Configuration()
   attrSyncMode.setDocumentation(doc);
   _tag.addAttribute(attrSyncMode);
 
+  xml::XMLAttribute<bool> attrEventTrace("event-trace");
+  doc = "event-trace streams all event timings of each rank to a separate binary trace file, "
+        "instead of gathering them on the first rank at the end. "
+        "Use tools/mergeEventTraces.py to merge the trace files.";
+  attrEventTrace.setDefaultValue(false);
+  attrEventTrace.setDocumentation(doc);
+  _tag.addAttribute(attrEventTrace);
 }
 
 xml::XMLTag& Configuration:: getXMLTag()
@@ -42,6 +50,7 @@ void Configuration::xmlTagCallback(xml::XMLTag& tag)
   TRACE(tag.getName());
   if (tag.getName() == "precice-configuration") {
     precice::syncMode = tag.getBooleanAttributeValue("sync-mode");
+    utils::EventRegistry::instance().traceEnabled = tag.getBooleanAttributeValue("event-trace");
   }
 }
 
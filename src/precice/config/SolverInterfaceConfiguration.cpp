@@ -28,6 +28,13 @@ SolverInterfaceConfiguration:: SolverInterfaceConfiguration(xml::XMLTag& parent
   attrDimensions.setValidator(validDim2 || validDim3);
   tag.addAttribute(attrDimensions);
 
+  XMLAttribute<bool> attrRestartMode("restart-mode");
+  doc = "If true, the coupling schemes read their state from the checkpoints written before, ";
+  doc += "see tag checkpoint of the coupling schemes.";
+  attrRestartMode.setDocumentation(doc);
+  attrRestartMode.setDefaultValue(false);
+  tag.addAttribute(attrRestartMode);
+
   _dataConfiguration = mesh::PtrDataConfiguration (
       new mesh::DataConfiguration(tag) );
   _meshConfiguration = mesh::PtrMeshConfiguration (
@@ -50,6 +57,7 @@ void SolverInterfaceConfiguration:: xmlTagCallback
   TRACE();
   if (tag.getName() == "solver-interface"){
     _dimensions = tag.getIntAttributeValue("dimensions");
+    _restartMode = tag.getBooleanAttributeValue("restart-mode");
     _dataConfiguration->setDimensions(_dimensions);
     _meshConfiguration->setDimensions(_dimensions);
     _participantConfiguration->setDimensions(_dimensions);
@@ -101,6 +109,11 @@ int SolverInterfaceConfiguration:: getDimensions() const
   return _dimensions;
 }
 
+bool SolverInterfaceConfiguration:: getRestartMode() const
+{
+  return _restartMode;
+}
+
 const PtrParticipantConfiguration &
 SolverInterfaceConfiguration:: getParticipantConfiguration() const
 {
@@ -47,6 +47,9 @@ public:
    */
   int getDimensions() const;
 
+  /// Returns true, if the coupling state is read from checkpoints at initialization.
+  bool getRestartMode() const;
+
   const mesh::PtrDataConfiguration getDataConfiguration() const
   {
     return _dataConfiguration;
@@ -101,6 +104,9 @@ private:
   /// Spatial dimension of problem to be solved. Either 2 or 3.
   int _dimensions = -1;
 
+  /// If true, the coupling state is read from checkpoints at initialization.
+  bool _restartMode = false;
+
   // @brief Participating solvers in the coupled simulation.
   //std::vector<impl::PtrParticipant> _participants;
 
@@ -3,21 +3,29 @@
 #include "cplscheme/CouplingScheme.hpp"
 #include "precice/impl/SolverInterfaceImpl.hpp"
 #include <algorithm>
+#include <initializer_list>
 #include <utility>
 #include <vector>
 
 namespace precice {
 namespace impl {
 
+namespace {
+/// Number of buffered ints and doubles, after which a batch of requests is sent.
+const size_t MAX_BATCH_SIZE = 1 << 16;
+}
+
 RequestManager:: RequestManager
 (
   SolverInterfaceImpl&  solverInterfaceImpl,
   com::PtrCommunication clientServerCommunication,
-  cplscheme::PtrCouplingScheme couplingScheme)
+  cplscheme::PtrCouplingScheme couplingScheme,
+  bool                  singleClient )
 :
   _interface(solverInterfaceImpl),
   _com(std::move(clientServerCommunication)),
-  _couplingScheme(std::move(couplingScheme))
+  _couplingScheme(std::move(couplingScheme)),
+  _singleClient(singleClient)
 {}
 
 void RequestManager:: handleRequests()
@@ -107,9 +115,6 @@ void RequestManager:: handleRequests()
       handleRequestGetMeshVertexSize(rankSender);
       singleRequest = true;
       break;
-    case REQUEST_RESET_MESH:
-      handleRequestResetMesh(rankSender);
-      break;
     case REQUEST_SET_MESH_VERTICES:
       handleRequestSetMeshVertices(rankSender);
       singleRequest = true;
@@ -122,40 +127,12 @@ void RequestManager:: handleRequests()
       handleRequestGetMeshVertexIDsFromPositions(rankSender);
       singleRequest = true;
       break;
-    case REQUEST_SET_MESH_EDGE:
-      handleRequestSetMeshEdge(rankSender);
-      singleRequest = true;
-      break;
-    case REQUEST_SET_MESH_TRIANGLE:
-      handleRequestSetMeshTriangle(rankSender);
-      singleRequest = true;
-      break;
-    case REQUEST_SET_MESH_TRIANGLE_WITH_EDGES:
-      handleRequestSetMeshTriangleWithEdges(rankSender);
-      singleRequest = true;
-      break;
-    case REQUEST_SET_MESH_QUAD:
-      handleRequestSetMeshQuad(rankSender);
-      singleRequest = true;
-      break;
-    case REQUEST_SET_MESH_QUAD_WITH_EDGES:
-      handleRequestSetMeshQuadWithEdges(rankSender);
-      singleRequest = true;
-      break;
-    case REQUEST_WRITE_BLOCK_SCALAR_DATA:
-      handleRequestWriteBlockScalarData(rankSender);
-      singleRequest = true;
-      break;
-    case REQUEST_WRITE_SCALAR_DATA:
-      handleRequestWriteScalarData(rankSender);
-      singleRequest = true;
-      break;
-    case REQUEST_WRITE_BLOCK_VECTOR_DATA:
-      handleRequestWriteBlockVectorData(rankSender);
+    case REQUEST_BATCH:
+      handleRequestBatch(rankSender);
       singleRequest = true;
       break;
-    case REQUEST_WRITE_VECTOR_DATA:
-      handleRequestWriteVectorData(rankSender);
+    case REQUEST_SET_MESH_EDGE:
+      handleRequestSetMeshEdge(rankSender);
       singleRequest = true;
       break;
     case REQUEST_READ_BLOCK_SCALAR_DATA:
@@ -229,6 +206,7 @@ void RequestManager:: handleRequests()
 void RequestManager:: requestPing()
 {
   TRACE();
+  flushBatch();
   _com->send(REQUEST_PING, 0);
   int dummy = 0;
   _com->receive(dummy, 0);
@@ -237,6 +215,10 @@ void RequestManager:: requestPing()
 void RequestManager:: requestInitialize()
 {
   TRACE();
+  flushBatch();
+  // The server may change the meshes during initialization
+  _nextVertexIDs.clear();
+  _nextEdgeIDs.clear();
   _com->send(REQUEST_INITIALIZE, 0);
   _couplingScheme->receiveState(_com, 0);
 }
@@ -244,6 +226,7 @@ void RequestManager:: requestInitialize()
 void RequestManager:: requestInitialzeData()
 {
   TRACE();
+  flushBatch();
   _com->send(REQUEST_INITIALIZE_DATA, 0);
   _couplingScheme->receiveState(_com, 0);
 }
@@ -253,6 +236,7 @@ void RequestManager:: requestAdvance
   double dt )
 {
   TRACE();
+  flushBatch();
   _com->send(REQUEST_ADVANCE, 0);
   _com->send(dt, 0);
   _couplingScheme->receiveState(_com, 0);
@@ -261,6 +245,7 @@ void RequestManager:: requestAdvance
 void RequestManager:: requestFinalize()
 {
   TRACE();
+  flushBatch();
   _com->send(REQUEST_FINALIZE, 0);
 }
 
@@ -270,6 +255,7 @@ void RequestManager:: requestFulfilledAction
   const std::string& action )
 {
   TRACE();
+  flushBatch();
   _com->send(REQUEST_FULFILLED_ACTION, 0);
   _com->send(action, 0);
 }
@@ -280,6 +266,16 @@ int RequestManager:: requestSetMeshVertex
   Eigen::VectorXd& position )
 {
   TRACE();
+  if (_singleClient){
+    auto iter = _nextVertexIDs.find(meshID);
+    if (iter == _nextVertexIDs.end()){
+      iter = _nextVertexIDs.emplace(meshID, requestGetMeshVertexSize(meshID)).first;
+    }
+    int vertexID = iter->second++;
+    appendToBatch({REQUEST_SET_MESH_VERTEX, meshID, vertexID}, nullptr, 0, position.data(), position.size());
+    return vertexID;
+  }
+  flushBatch();
   _com->send(REQUEST_SET_MESH_VERTEX, 0);
   _com->send(meshID, 0);
   _com->send(position.data(), position.size(), 0);
@@ -293,6 +289,7 @@ int RequestManager:: requestGetMeshVertexSize
   int meshID )
 {
   TRACE(meshID);
+  flushBatch();
   _com->send(REQUEST_GET_MESH_VERTEX_SIZE, 0);
   _com->send(meshID, 0);
   int size = -1;
@@ -305,8 +302,9 @@ void RequestManager:: requestResetMesh
   int meshID )
 {
   TRACE(meshID);
-  _com->send(REQUEST_RESET_MESH, 0);
-  _com->send(meshID, 0);
+  appendToBatch({REQUEST_RESET_MESH, meshID}, nullptr, 0, nullptr, 0);
+  _nextVertexIDs[meshID] = 0;
+  _nextEdgeIDs.erase(meshID);
 }
 
 void RequestManager:: requestSetMeshVertices
@@ -317,11 +315,15 @@ void RequestManager:: requestSetMeshVertices
   int*    ids )
 {
   TRACE();
+  flushBatch();
   _com->send(REQUEST_SET_MESH_VERTICES, 0);
   _com->send(meshID, 0);
   _com->send(size, 0);
   _com->send(positions, size*_interface.getDimensions(), 0);
   _com->receive(ids, size, 0);
+  if (_singleClient && size > 0){
+    _nextVertexIDs[meshID] = ids[size-1] + 1;
+  }
 }
 
 void RequestManager:: requestGetMeshVertices
@@ -332,6 +334,7 @@ void RequestManager:: requestGetMeshVertices
   double* positions )
 {
   TRACE();
+  flushBatch();
   _com->send(REQUEST_GET_MESH_VERTICES, 0);
   _com->send(meshID, 0);
   _com->send(size, 0);
@@ -347,6 +350,7 @@ void RequestManager:: requestGetMeshVertexIDsFromPositions
   int*    ids )
 {
   TRACE(size);
+  flushBatch();
   _com->send(REQUEST_GET_MESH_VERTEX_IDS_FROM_POSITIONS, 0);
   _com->send(meshID, 0);
   _com->send(size, 0);
@@ -362,11 +366,25 @@ int RequestManager:: requestSetMeshEdge
   int secondVertexID )
 {
   TRACE(meshID, firstVertexID, secondVertexID);
+  auto iter = _nextEdgeIDs.find(meshID);
+  if (iter != _nextEdgeIDs.end()){
+    int edgeID = iter->second;
+    if (edgeID >= 0){
+      iter->second++;
+    }
+    appendToBatch({REQUEST_SET_MESH_EDGE, meshID, firstVertexID, secondVertexID, edgeID}, nullptr, 0, nullptr, 0);
+    return edgeID;
+  }
+  flushBatch();
   _com->send(REQUEST_SET_MESH_EDGE, 0);
   int data[3] = { meshID, firstVertexID, secondVertexID };
   _com->send(data, 3, 0);
   int createdEdgeID = -1;
   _com->receive(createdEdgeID, 0);
+  if (_singleClient){
+    // The first edge tells whether the server stores edges of this mesh
+    _nextEdgeIDs[meshID] = createdEdgeID < 0 ? -1 : createdEdgeID + 1;
+  }
   return createdEdgeID;
 }
 
@@ -378,9 +396,7 @@ void RequestManager:: requestSetMeshTriangle
   int thirdEdgeID )
 {
   TRACE(meshID, firstEdgeID, secondEdgeID, thirdEdgeID);
-  _com->send(REQUEST_SET_MESH_TRIANGLE, 0);
-  int data[4] = {meshID, firstEdgeID, secondEdgeID, thirdEdgeID};
-  _com->send(data, 4, 0);
+  appendToBatch({REQUEST_SET_MESH_TRIANGLE, meshID, firstEdgeID, secondEdgeID, thirdEdgeID}, nullptr, 0, nullptr, 0);
 }
 
 void RequestManager:: requestSetMeshTriangleWithEdges
@@ -392,9 +408,8 @@ void RequestManager:: requestSetMeshTriangleWithEdges
 {
   TRACE(meshID, firstVertexID,
                 secondVertexID, thirdVertexID);
-  _com->send(REQUEST_SET_MESH_TRIANGLE_WITH_EDGES, 0);
-  int data[4] = {meshID, firstVertexID, secondVertexID, thirdVertexID};
-  _com->send(data, 4, 0);
+  appendToBatch({REQUEST_SET_MESH_TRIANGLE_WITH_EDGES, meshID, firstVertexID, secondVertexID, thirdVertexID}, nullptr, 0, nullptr, 0);
+  _nextEdgeIDs.erase(meshID); // may create edges
 }
 
 void RequestManager:: requestSetMeshQuad
@@ -406,9 +421,7 @@ void RequestManager:: requestSetMeshQuad
   int fourthEdgeID )
 {
   TRACE(meshID, firstEdgeID, secondEdgeID, thirdEdgeID, fourthEdgeID);
-  _com->send(REQUEST_SET_MESH_QUAD, 0);
-  int data[5] = {meshID, firstEdgeID, secondEdgeID, thirdEdgeID, fourthEdgeID};
-  _com->send(data, 5, 0);
+  appendToBatch({REQUEST_SET_MESH_QUAD, meshID, firstEdgeID, secondEdgeID, thirdEdgeID, fourthEdgeID}, nullptr, 0, nullptr, 0);
 }
 
 void RequestManager:: requestSetMeshQuadWithEdges
@@ -420,9 +433,8 @@ void RequestManager:: requestSetMeshQuadWithEdges
   int fourthVertexID )
 {
   TRACE(meshID, firstVertexID, secondVertexID, thirdVertexID, fourthVertexID);
-  _com->send(REQUEST_SET_MESH_QUAD_WITH_EDGES, 0);
-  int data[5] = {meshID, firstVertexID, secondVertexID, thirdVertexID, fourthVertexID};
-  _com->send(data, 5, 0);
+  appendToBatch({REQUEST_SET_MESH_QUAD_WITH_EDGES, meshID, firstVertexID, secondVertexID, thirdVertexID, fourthVertexID}, nullptr, 0, nullptr, 0);
+  _nextEdgeIDs.erase(meshID); // may create edges
 }
 
 void RequestManager:: requestWriteBlockScalarData (
@@ -432,11 +444,7 @@ void RequestManager:: requestWriteBlockScalarData (
   double* values )
 {
   TRACE(dataID, size);
-  _com->send(REQUEST_WRITE_BLOCK_SCALAR_DATA, 0);
-  _com->send(dataID, 0);
-  _com->send(size, 0);
-  _com->send(valueIndices, size, 0);
-  _com->send(values, size, 0);
+  appendToBatch({REQUEST_WRITE_BLOCK_SCALAR_DATA, dataID, size}, valueIndices, size, values, size);
 }
 
 void RequestManager:: requestWriteScalarData
@@ -446,10 +454,7 @@ void RequestManager:: requestWriteScalarData
   double value )
 {
   TRACE();
-  _com->send(REQUEST_WRITE_SCALAR_DATA, 0);
-  _com->send(dataID, 0);
-  _com->send(valueIndex, 0);
-  _com->send(value, 0);
+  appendToBatch({REQUEST_WRITE_SCALAR_DATA, dataID, valueIndex}, nullptr, 0, &value, 1);
 }
 
 void RequestManager:: requestWriteBlockVectorData (
@@ -459,11 +464,7 @@ void RequestManager:: requestWriteBlockVectorData (
   double* values )
 {
   TRACE(dataID);
-  _com->send(REQUEST_WRITE_BLOCK_VECTOR_DATA, 0);
-  _com->send(dataID, 0);
-  _com->send(size, 0);
-  _com->send(valueIndices, size, 0);
-  _com->send(values, size*_interface.getDimensions(), 0);
+  appendToBatch({REQUEST_WRITE_BLOCK_VECTOR_DATA, dataID, size}, valueIndices, size, values, size*_interface.getDimensions());
 }
 
 void RequestManager:: requestWriteVectorData
@@ -473,10 +474,7 @@ void RequestManager:: requestWriteVectorData
   double* value )
 {
   TRACE();
-  _com->send(REQUEST_WRITE_VECTOR_DATA, 0);
-  _com->send(dataID, 0);
-  _com->send(valueIndex, 0);
-  _com->send(value, _interface.getDimensions(), 0);
+  appendToBatch({REQUEST_WRITE_VECTOR_DATA, dataID, valueIndex}, nullptr, 0, value, _interface.getDimensions());
 }
 
 void RequestManager:: requestReadBlockScalarData (
@@ -486,6 +484,7 @@ void RequestManager:: requestReadBlockScalarData (
   double* values )
 {
   TRACE(dataID, size);
+  flushBatch();
   _com->send(REQUEST_READ_BLOCK_SCALAR_DATA, 0);
   _com->send(dataID, 0);
   _com->send(size, 0);
@@ -500,6 +499,7 @@ void RequestManager:: requestReadScalarData
   double& value )
 {
   TRACE();
+  flushBatch();
   _com->send(REQUEST_READ_SCALAR_DATA, 0);
   _com->send(dataID, 0);
   _com->send(valueIndex, 0);
@@ -514,6 +514,7 @@ void RequestManager:: requestReadBlockVectorData
   double* values )
 {
   TRACE(dataID, size);
+  flushBatch();
   _com->send(REQUEST_READ_BLOCK_VECTOR_DATA, 0);
   _com->send(dataID, 0);
   _com->send(size, 0);
@@ -528,6 +529,7 @@ void RequestManager:: requestReadVectorData
   double* value )
 {
   TRACE();
+  flushBatch();
   _com->send(REQUEST_READ_VETOR_DATA, 0);
   _com->send(dataID, 0);
   _com->send(valueIndex, 0);
@@ -539,6 +541,7 @@ void RequestManager:: requestMapWriteDataFrom
   int fromMeshID )
 {
   TRACE(fromMeshID);
+  flushBatch();
   _com->send(REQUEST_MAP_WRITE_DATA_FROM, 0);
   int ping;
   _com->receive(ping, 0);
@@ -550,12 +553,43 @@ void RequestManager:: requestMapReadDataTo
   int toMeshID )
 {
   TRACE(toMeshID);
+  flushBatch();
   _com->send(REQUEST_MAP_READ_DATA_TO, 0);
   int ping;
   _com->receive(ping, 0);
   _com->send(toMeshID, 0);
 }
 
+void RequestManager:: appendToBatch
+(
+  std::initializer_list<int> header,
+  const int*                 ints,
+  int                        intSize,
+  const double*              doubles,
+  int                        doubleSize )
+{
+  TRACE(intSize, doubleSize);
+  _batchInts.insert(_batchInts.end(), header);
+  _batchInts.insert(_batchInts.end(), ints, ints + intSize);
+  _batchDoubles.insert(_batchDoubles.end(), doubles, doubles + doubleSize);
+  if (_batchInts.size() + _batchDoubles.size() >= MAX_BATCH_SIZE) {
+    flushBatch();
+  }
+}
+
+void RequestManager:: flushBatch()
+{
+  if (_batchInts.empty()) {
+    return;
+  }
+  TRACE(_batchInts.size(), _batchDoubles.size());
+  _com->send(REQUEST_BATCH, 0);
+  _com->send(_batchInts, 0);
+  _com->send(_batchDoubles, 0);
+  _batchInts.clear();
+  _batchDoubles.clear();
+}
+
 void RequestManager:: handleRequestInitialze
 (
   const std::list<int>& clientRanks )
@@ -640,17 +674,6 @@ void RequestManager:: handleRequestGetMeshVertexSize
   _com->send(size, rankSender);
 }
 
-void RequestManager:: handleRequestResetMesh
-(
-  int rankSender )
-{
-  TRACE(rankSender);
-  int meshID = -1;
-  _com->receive(meshID, rankSender);
-  _interface.resetMesh(meshID);
-}
-
-
 void RequestManager:: handleRequestSetMeshVertices
 (
   int rankSender )
@@ -702,115 +725,102 @@ void RequestManager:: handleRequestGetMeshVertexIDsFromPositions
   _com->send(ids, rankSender);
 }
 
-void RequestManager:: handleRequestSetMeshEdge
-(
-  int rankSender )
-{
-  TRACE(rankSender);
-  int data[3]; // 0: meshID, 1: firstVertexID, 2: secondVertexID
-  _com->receive(data, 3, rankSender);
-  int createEdgeID = _interface.setMeshEdge(data[0], data[1], data[2]);
-  _com->send(createEdgeID, rankSender);
-}
-
-void RequestManager:: handleRequestSetMeshTriangle
+void RequestManager:: handleRequestBatch
 (
   int rankSender )
 {
   TRACE(rankSender);
-  int data[4]; // 0: meshID, 1,2,3: edge IDs
-  _com->receive(data, 4, rankSender);
-  _interface.setMeshTriangle(data[0], data[1], data[2], data[3]);
-}
-
-void RequestManager:: handleRequestSetMeshTriangleWithEdges
-(
-  int rankSender )
-{
-  TRACE(rankSender);
-  int data[4]; // 0: meshID, 1,2,3: vertex IDs
-  _com->receive(data, 4, rankSender);
-  _interface.setMeshTriangleWithEdges(data[0], data[1], data[2], data[3]);
-}
-
-void RequestManager:: handleRequestSetMeshQuad
-(
-  int rankSender )
-{
-  TRACE(rankSender);
-  int data[5]; // 0: meshID, 1,2,3,4: edge IDs
-  _com->receive(data, 5, rankSender);
-  _interface.setMeshQuad(data[0], data[1], data[2], data[3], data[4]);
-}
-
-void RequestManager:: handleRequestSetMeshQuadWithEdges
-(
-  int rankSender )
-{
-  TRACE(rankSender);
-  int data[5]; // 0: meshID, 1,2,3,4: vertex IDs
-  _com->receive(data, 5, rankSender);
-  _interface.setMeshQuadWithEdges(data[0], data[1], data[2], data[3], data[4]);
-}
-
-void RequestManager:: handleRequestWriteScalarData
-(
-  int rankSender )
-{
-  TRACE(rankSender);
-  int dataID = -1;
-  _com->receive(dataID, rankSender);
-  int index = -1;
-  _com->receive(index, rankSender);
-  double data;
-  _com->receive(data, rankSender);
-  _interface.writeScalarData(dataID, index, data);
-}
-
-void RequestManager:: handleRequestWriteBlockScalarData
-(
-  int rankSender )
-{
-  TRACE(rankSender);
-  int dataID = -1;
-  _com->receive(dataID, rankSender);
-  int size = -1;
-  _com->receive(size, rankSender);
-  std::vector<int> indices(size);
-  _com->receive(indices, rankSender);
-  std::vector<double> data(size);
-  _com->receive(data, rankSender);
-  _interface.writeBlockScalarData(dataID, size, indices.data(), data.data());
-}
-
-void RequestManager:: handleRequestWriteBlockVectorData
-(
-  int rankSender )
-{
-  TRACE(rankSender);
-  int dataID = -1;
-  _com->receive(dataID, rankSender);
-  int size = -1;
-  _com->receive(size, rankSender);
-  std::vector<int> indices(size);
-  _com->receive(indices, rankSender);
-  std::vector<double> data(size*_interface.getDimensions());
-  _com->receive(data, rankSender);
-  _interface.writeBlockVectorData(dataID, size, indices.data(), data.data());
+  std::vector<int> ints;
+  _com->receive(ints, rankSender);
+  std::vector<double> doubles;
+  _com->receive(doubles, rankSender);
+
+  int    dim     = _interface.getDimensions();
+  int*   data    = ints.data();
+  int*   end     = ints.data() + ints.size();
+  double* values = doubles.data();
+  while (data != end) {
+    int requestID = *data++;
+    switch (requestID){
+    case REQUEST_RESET_MESH:
+      _interface.resetMesh(data[0]);
+      data += 1;
+      break;
+    case REQUEST_SET_MESH_VERTEX: { // meshID, vertex ID predicted by the client
+      int vertexID = _interface.setMeshVertex(data[0], values);
+      CHECK(vertexID == data[1], "The server created vertex " << vertexID << " of mesh "
+            << data[0] << ", but the client predicted vertex " << data[1]
+            << ". Mesh vertices must only be set by a single client.");
+      data   += 2;
+      values += dim;
+      break;
+    }
+    case REQUEST_SET_MESH_EDGE: { // meshID, 2 vertex IDs, edge ID predicted by the client
+      int edgeID = _interface.setMeshEdge(data[0], data[1], data[2]);
+      CHECK(edgeID == data[3], "The server created edge " << edgeID << " of mesh "
+            << data[0] << ", but the client predicted edge " << data[3]
+            << ". Mesh edges must only be set by a single client.");
+      data += 4;
+      break;
+    }
+    case REQUEST_SET_MESH_TRIANGLE: // meshID, 3 edge IDs
+      _interface.setMeshTriangle(data[0], data[1], data[2], data[3]);
+      data += 4;
+      break;
+    case REQUEST_SET_MESH_TRIANGLE_WITH_EDGES: // meshID, 3 vertex IDs
+      _interface.setMeshTriangleWithEdges(data[0], data[1], data[2], data[3]);
+      data += 4;
+      break;
+    case REQUEST_SET_MESH_QUAD: // meshID, 4 edge IDs
+      _interface.setMeshQuad(data[0], data[1], data[2], data[3], data[4]);
+      data += 5;
+      break;
+    case REQUEST_SET_MESH_QUAD_WITH_EDGES: // meshID, 4 vertex IDs
+      _interface.setMeshQuadWithEdges(data[0], data[1], data[2], data[3], data[4]);
+      data += 5;
+      break;
+    case REQUEST_WRITE_SCALAR_DATA: // dataID, index
+      _interface.writeScalarData(data[0], data[1], *values);
+      data   += 2;
+      values += 1;
+      break;
+    case REQUEST_WRITE_VECTOR_DATA: // dataID, index
+      _interface.writeVectorData(data[0], data[1], values);
+      data   += 2;
+      values += dim;
+      break;
+    case REQUEST_WRITE_BLOCK_SCALAR_DATA: { // dataID, size, indices
+      int size = data[1];
+      _interface.writeBlockScalarData(data[0], size, data + 2, values);
+      data   += 2 + size;
+      values += size;
+      break;
+    }
+    case REQUEST_WRITE_BLOCK_VECTOR_DATA: { // dataID, size, indices
+      int size = data[1];
+      _interface.writeBlockVectorData(data[0], size, data + 2, values);
+      data   += 2 + size;
+      values += size * dim;
+      break;
+    }
+    default:
+      ERROR("Unknown batched RequestID \"" << requestID << "\"");
+      break;
+    }
+    assertion(data <= end);
+  }
+  assertion(values == doubles.data() + doubles.size());
 }
 
-void RequestManager:: handleRequestWriteVectorData
+void RequestManager:: handleRequestSetMeshEdge
 (
   int rankSender )
 {
   TRACE(rankSender);
-  int dataID = -1;
-  _com->receive(dataID, rankSender);
-  int index = -1;
-  _com->receive( index, rankSender);
-  double data[_interface.getDimensions()];
-  _com->receive(data, _interface.getDimensions(), rankSender);
-  _interface.writeVectorData(dataID, index, data);
+  int data[3]; // 0: meshID, 1: firstVertexID, 2: secondVertexID
+  _com->receive(data, 3, rankSender);
+  int createEdgeID = _interface.setMeshEdge(data[0], data[1], data[2]);
+  _com->send(createEdgeID, rankSender);
 }
 
 void RequestManager:: handleRequestReadScalarData
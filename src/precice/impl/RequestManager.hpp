@@ -5,6 +5,9 @@
 #include "logging/Logger.hpp"
 #include <set>
 #include <list>
+#include <map>
+#include <initializer_list>
+#include <vector>
 #include <Eigen/Core>
 
 namespace precice {
@@ -16,15 +19,33 @@ namespace precice {
 namespace precice {
 namespace impl {
 
-/// Takes requests from clients and handles requests on server side.
+/**
+ * @brief Takes requests from clients and handles requests on server side.
+ *
+ * Requests without an answer, i.e. writing data and setting mesh elements, are buffered
+ * at the client and sent as one batch before the next request with an answer or
+ * collective request, e.g. reading data or advance.
+ *
+ * With a single client, setting mesh vertices and edges is batched as well. The client
+ * predicts the IDs the server assigns, since the server creates the mesh elements of one
+ * client in order. Several clients share the server meshes, hence they cannot predict
+ * the IDs and need one round trip per vertex or edge.
+ */
 class RequestManager
 {
 public:
 
+  /**
+   * @brief Constructor.
+   *
+   * @param[in] singleClient Whether the server has one client, which enables batching of
+   *            mesh vertices and edges. Not used at the server.
+   */
   RequestManager (
     SolverInterfaceImpl&  solverInterfaceImpl,
     com::PtrCommunication clientServerCommunication,
-    cplscheme::PtrCouplingScheme couplingScheme);
+    cplscheme::PtrCouplingScheme couplingScheme,
+    bool                  singleClient );
 
   /// Redirects all requests from client to corresponding handle methods.
   void handleRequests();
@@ -203,6 +224,7 @@ private:
     REQUEST_READ_BLOCK_VECTOR_DATA,
     REQUEST_MAP_WRITE_DATA_FROM,
     REQUEST_MAP_READ_DATA_TO,
+    REQUEST_BATCH,
     REQUEST_PING // Used in tests only
   };
 
@@ -214,6 +236,37 @@ private:
 
   cplscheme::PtrCouplingScheme _couplingScheme;
 
+  /// Integer part of the requests buffered at the client, starting with their request IDs.
+  std::vector<int> _batchInts;
+
+  /// Double values of the requests buffered at the client.
+  std::vector<double> _batchDoubles;
+
+  /// Whether the client predicts vertex and edge IDs to batch their creation.
+  bool _singleClient;
+
+  /// Next vertex ID per mesh ID the server assigns, known by the client.
+  std::map<int,int> _nextVertexIDs;
+
+  /// Next edge ID per mesh ID the server assigns, -1 if the mesh does not store edges.
+  std::map<int,int> _nextEdgeIDs;
+
+  /**
+   * @brief Buffers a request without answer at the client.
+   *
+   * The header holds the request ID followed by scalar arguments, ints and doubles the
+   * array arguments. The buffered requests are sent by flushBatch().
+   */
+  void appendToBatch (
+    std::initializer_list<int> header,
+    const int*                 ints,
+    int                        intSize,
+    const double*              doubles,
+    int                        doubleSize );
+
+  /// Sends all buffered requests to the server, needs to be called before any other request.
+  void flushBatch();
+
   /// Handles request initialize from client.
   void handleRequestInitialze ( const std::list<int>& clientRanks );
 
@@ -235,9 +288,6 @@ private:
   /// Handles request get mesh vertex size from client.
   void handleRequestGetMeshVertexSize(int rankSender);
 
-  /// Handles request reset mesh from client.
-  void handleRequestResetMesh(int rankSender);
-
   /// Handles request set vertex positions from client.
   void handleRequestSetMeshVertices ( int rankSender );
 
@@ -247,33 +297,12 @@ private:
   /// Handles request get vertex IDs from client.
   void handleRequestGetMeshVertexIDsFromPositions ( int rankSender );
 
+  /// Handles a batch of buffered requests from client, in the order they were issued.
+  void handleRequestBatch ( int rankSender );
+
   /// Handles request set mesh edge from client.
   void handleRequestSetMeshEdge ( int rankSender );
 
-  /// Handles request set mesh triangle from client.
-  void handleRequestSetMeshTriangle ( int rankSender );
-
-  /// Handles request set mesh triangle with edges from client.
-  void handleRequestSetMeshTriangleWithEdges ( int rankSender );
-
-  /// Handles request set mesh quad from client.
-  void handleRequestSetMeshQuad ( int rankSender );
-
-  /// Handles request set mesh quad with edges from client.
-  void handleRequestSetMeshQuadWithEdges ( int rankSender );
-
-  /// Handles request write block scalar data from client.
-  void handleRequestWriteBlockScalarData ( int rankSender );
-
-  /// Handles request write scalar data from client.
-  void handleRequestWriteScalarData ( int rankSender );
-
-  /// Handles request write block vector data from client.
-  void handleRequestWriteBlockVectorData ( int rankSender );
-
-  /// Handles request write vector data from client.
-  void handleRequestWriteVectorData ( int rankSender );
-
   /// Handles request read block scalar data from client.
   void handleRequestReadBlockScalarData ( int rankSender );
 
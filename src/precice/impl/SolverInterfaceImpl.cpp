@@ -104,6 +104,7 @@ void SolverInterfaceImpl:: configure
   Participant::resetParticipantCount();
 
   _dimensions = config.getDimensions();
+  _restartMode = config.getRestartMode();
   _accessor = determineAccessingParticipant(config);
 
   CHECK(not (_accessor->useServer() && _accessor->useMaster()), "You cannot use a server and a master.");
@@ -139,7 +140,8 @@ void SolverInterfaceImpl:: configure
   if (_serverMode || _clientMode){
     com::PtrCommunication com = _accessor->getClientServerCommunication();
     assertion(com.get() != nullptr);
-    _requestManager = std::make_shared<RequestManager>(*this, com, _couplingScheme);
+    _requestManager = std::make_shared<RequestManager>(*this, com, _couplingScheme,
+                                                       _accessorCommunicatorSize == 1);
   }
 
   // Add meshIDs and data IDs
@@ -245,6 +247,11 @@ double SolverInterfaceImpl:: initialize()
 
     _couplingScheme->initialize(time, timestep);
 
+    if (_restartMode){
+      INFO("Reading coupling state from checkpoint for restart");
+      _couplingScheme->importState(getCheckpointFilenamePrefix());
+    }
+
     dt = _couplingScheme->getNextTimestepMaxLength();
 
     timings.insert(action::Action::ALWAYS_POST);
@@ -1571,6 +1578,15 @@ void SolverInterfaceImpl:: mapWrittenData()
 
       context.mapping->computeMapping();
     }
+    else if (timing == MappingConfiguration::ON_ADVANCE && hasMeshChanged(context)){
+      INFO("Update write mapping from mesh \""
+          << _accessor->meshContext(context.fromMeshID).mesh->getName()
+          << "\" to mesh \""
+          << _accessor->meshContext(context.toMeshID).mesh->getName()
+          << "\".");
+
+      context.mapping->updateMapping();
+    }
   }
 
   // Map data
@@ -1600,13 +1616,8 @@ void SolverInterfaceImpl:: mapWrittenData()
     }
   }
 
-  // Clear non-stationary, non-incremental mappings
+  // Computed mappings are kept, they are updated only if their meshes change
   for (impl::MappingContext& context : _accessor->writeMappingContexts()) {
-    bool isStationary = context.timing
-                        == MappingConfiguration::INITIAL;
-    if (not isStationary){
-        context.mapping->clear();
-    }
     context.hasMappedData = false;
   }
 }
@@ -1630,6 +1641,15 @@ void SolverInterfaceImpl:: mapReadData()
 
       context.mapping->computeMapping();
     }
+    else if (timing == mapping::MappingConfiguration::ON_ADVANCE && hasMeshChanged(context)){
+      INFO("Update read mapping from mesh \""
+              << _accessor->meshContext(context.fromMeshID).mesh->getName()
+              << "\" to mesh \""
+              << _accessor->meshContext(context.toMeshID).mesh->getName()
+              << "\".");
+
+      context.mapping->updateMapping();
+    }
   }
 
   // Map data
@@ -1658,17 +1678,23 @@ void SolverInterfaceImpl:: mapReadData()
     }
   }
 
-  // Clear non-initial, non-incremental mappings
+  // Computed mappings are kept, they are updated only if their meshes change
   for (impl::MappingContext& context : _accessor->readMappingContexts()) {
-    bool isStationary = context.timing
-              == mapping::MappingConfiguration::INITIAL;
-    if (not isStationary){
-      context.mapping->clear();
-    }
     context.hasMappedData = false;
   }
 }
 
+bool SolverInterfaceImpl:: hasMeshChanged
+(
+  const impl::MappingContext& context ) const
+{
+  // All ranks have to agree, as updating a mapping may involve collective operations
+  int changed = context.mapping->hasMeshChanged() ? 1 : 0;
+  int anyChanged = changed;
+  utils::MasterSlave::allreduceSum(changed, anyChanged, 1);
+  return anyChanged > 0;
+}
+
 void SolverInterfaceImpl:: performDataActions
 (
   const std::set<action::Action::Timing>& timings,
@@ -1718,9 +1744,22 @@ void SolverInterfaceImpl:: handleExports()
     for (const PtrWatchPoint& watchPoint : _accessor->watchPoints()) {
       watchPoint->exportPointData(_couplingScheme->getTime());
     }
+
+    // Export checkpoint of the coupling state, the solver has to write its own checkpoint
+    int checkpointInterval = _couplingScheme->getCheckpointTimestepInterval();
+    if (checkpointInterval > 0 && timesteps % checkpointInterval == 0){
+      Event e("exportCheckpoint", precice::syncMode);
+      _couplingScheme->exportState(getCheckpointFilenamePrefix());
+      _couplingScheme->requireAction(constants::actionWriteSimulationCheckpoint());
+    }
   }
 }
 
+std::string SolverInterfaceImpl:: getCheckpointFilenamePrefix() const
+{
+  return "precice_checkpoint_" + _accessorName;
+}
+
 void SolverInterfaceImpl:: resetWrittenData()
 {
   TRACE();
@@ -487,6 +487,9 @@ private:
   /// If true, the interface uses a server to operate on coupling data.
   bool _clientMode = false;
 
+  /// If true, the coupling state is read from the last checkpoint at initialization.
+  bool _restartMode = false;
+
   /// Communication when for client-server mode.
   //com::Communication::SharedPointer _clientServerCommunication;
 
@@ -521,9 +524,12 @@ private:
 
   void configureM2Ns ( const m2n::M2NConfiguration::SharedPointer& config );
 
-  /// Exports meshes with data and watch point data.
+  /// Exports meshes with data, watch point data, and checkpoints of the coupling state.
   void handleExports();
 
+  /// Returns the prefix of the checkpoint files of the coupling scheme.
+  std::string getCheckpointFilenamePrefix() const;
+
   /**
    * @brief Adds exchanged data ids related to accessor to the coupling scheme.
    *
@@ -560,12 +566,15 @@ private:
   /// Communicate meshes and create partition
   void computePartitions();
 
-  /// Computes, performs, and resets all suitable write mappings.
+  /// Computes or updates, and performs all suitable write mappings.
   void mapWrittenData();
 
-  /// Computes, performs, and resets all suitable read mappings.
+  /// Computes or updates, and performs all suitable read mappings.
   void mapReadData();
 
+  /// Returns true, if the meshes of a computed mapping changed on any rank.
+  bool hasMeshChanged(const MappingContext& context) const;
+
   /**
    * @brief Performs all data actions with given timing.
    *
@@ -190,6 +190,97 @@ BOOST_AUTO_TEST_CASE(testCouplingModeParallelWithOneServer, * testing::OnSize(4)
   }
 }
 
+/// Sets mesh vertices and edges at a single client, which batches them with predicted IDs
+BOOST_AUTO_TEST_CASE(testBatchedMeshRequests,
+                     * testing::MinRanks(3)
+                     * boost::unit_test::fixture<testing::MPICommRestrictFixture>(std::vector<int>({0, 1, 2})))
+{
+  if (utils::Parallel::getCommunicatorSize() != 3)
+    return;
+
+  int rank = utils::Parallel::getProcessRank();
+  std::string configFile = _pathToTests + "cplmode-2.xml";
+  if ( rank == 0 ){
+    SolverInterface interface("ParticipantA", 0, 1);
+    config::Configuration config;
+    xml::configure(config.getXMLTag(), configFile);
+    interface._impl->configure(config.getSolverInterfaceConfiguration());
+    int meshID = interface.getMeshID("MeshA");
+    int dataID = interface.getDataID("VectorData", meshID);
+    int indices[2];
+    indices[0] = interface.setMeshVertex(meshID, Eigen::Vector2d(0.5,0.0).data());
+    indices[1] = interface.setMeshVertex(meshID, Eigen::Vector2d(2.0,0.5).data());
+
+    double dt = interface.initialize();
+    interface.advance(dt);
+    Eigen::Vector4d values;
+    interface.readBlockVectorData(dataID, 2, indices, values.data());
+    BOOST_TEST((values == Eigen::Vector4d(1.0, 2.0, 1.0, 2.0)));
+    BOOST_TEST(not interface.isCouplingOngoing());
+    interface.finalize();
+  }
+  else if ( rank == 1 ){
+    SolverInterface interface("ParticipantB", 0, 1);
+    config::Configuration config;
+    xml::configure(config.getXMLTag(), configFile);
+    interface._impl->configure(config.getSolverInterfaceConfiguration());
+    int meshID = interface.getMeshID("MeshB");
+    int dataID = interface.getDataID("VectorData", meshID);
+
+    // Batched vertices, mixed with a round trip
+    Eigen::MatrixXd positions(2, 7);
+    positions << 0.0, 1.0, 1.0, 0.0, 2.0, 2.0, 3.0,
+                 0.0, 0.0, 1.0, 1.0, 0.0, 1.0, 1.0;
+    BOOST_TEST(interface.setMeshVertex(meshID, positions.col(0).data()) == 0);
+    BOOST_TEST(interface.setMeshVertex(meshID, positions.col(1).data()) == 1);
+    BOOST_TEST(interface.setMeshVertex(meshID, positions.col(2).data()) == 2);
+    BOOST_TEST(interface.setMeshVertex(meshID, positions.col(3).data()) == 3);
+    int ids[7];
+    interface.setMeshVertices(meshID, 2, positions.col(4).data(), &ids[4]);
+    BOOST_TEST(ids[4] == 4);
+    BOOST_TEST(ids[5] == 5);
+    BOOST_TEST(interface.setMeshVertex(meshID, positions.col(6).data()) == 6);
+
+    // The first edge is a round trip, the following ones are batched
+    BOOST_TEST(interface.setMeshEdge(meshID, 0, 1) == 0);
+    BOOST_TEST(interface.setMeshEdge(meshID, 1, 2) == 1);
+    BOOST_TEST(interface.setMeshEdge(meshID, 2, 3) == 2);
+    BOOST_TEST(interface.setMeshEdge(meshID, 4, 5) == 3);
+    BOOST_TEST(interface.setMeshEdge(meshID, 5, 6) == 4);
+
+    // Decoded at the server in the order set
+    BOOST_TEST(interface.getMeshVertexSize(meshID) == 7);
+    for (int i = 0; i < 7; i++) {
+      ids[i] = i;
+    }
+    Eigen::MatrixXd received(2, 7);
+    interface.getMeshVertices(meshID, 7, ids, received.data());
+    BOOST_TEST((received == positions));
+
+    double dt = interface.initialize();
+    for (int i = 0; i < 7; i++) {
+      interface.writeVectorData(dataID, i, Eigen::Vector2d(1.0, 2.0).data());
+    }
+    interface.advance(dt);
+    BOOST_TEST(not interface.isCouplingOngoing());
+    interface.finalize();
+  }
+  else {
+    assertion (rank == 2, rank);
+    bool isServer = true;
+    impl::SolverInterfaceImpl server("ParticipantB", 0, 1, isServer);
+
+    // Perform manual configuration without overwritting logging config
+    mesh::Mesh::resetGeometryIDsGlobally();
+    mesh::Data::resetDataCount();
+    impl::Participant::resetParticipantCount();
+    config::Configuration config;
+    xml::configure ( config.getXMLTag(), configFile );
+    server.configure ( config.getSolverInterfaceConfiguration() );
+
+    server.runServer();
+  }
+}
 
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
@@ -4,11 +4,31 @@
 #include "mesh/Edge.hpp"
 #include "mesh/Vertex.hpp"
 #include "mesh/Mesh.hpp"
+#include "mesh/RTree.hpp"
 #include "math/math.hpp"
+#include <boost/function_output_iterator.hpp>
+
+namespace bgi = boost::geometry::index;
 
 namespace precice {
 namespace query {
 
+namespace {
+
+/// Returns the bounding box of a voxel, enlarged by the tolerance of the exact checks.
+mesh::AABB getVoxelBox(const Eigen::VectorXd& center, const Eigen::VectorXd& halflengths)
+{
+  // The RTree adapter expects three coordinates, the third one is zero in 2D
+  Eigen::VectorXd lower = Eigen::VectorXd::Zero(3);
+  Eigen::VectorXd upper = Eigen::VectorXd::Zero(3);
+  Eigen::VectorXd extent = halflengths.cwiseAbs().array() + 10.0 * math::NUMERICAL_ZERO_DIFFERENCE;
+  lower.head(center.size()) = center - extent;
+  upper.head(center.size()) = center + extent;
+  return mesh::AABB(lower, upper);
+}
+
+}
+
 FindVoxelContent:: FindVoxelContent
 (
   const Eigen::VectorXd&  voxelCenter,
@@ -51,6 +71,72 @@ void FindVoxelContent:: clear()
   _content.clear();
 }
 
+bool FindVoxelContent:: operator()
+(
+  mesh::PtrMesh mesh )
+{
+  TRACE(mesh->getName());
+  auto tree = mesh::rtree::getPrimitiveRTree(mesh);
+  std::vector<std::pair<mesh::AABB, mesh::PrimitiveIndex>> candidates;
+  tree->query(bgi::intersects(getVoxelBox(_voxelCenter, _voxelHalflengths)),
+              std::back_inserter(candidates));
+  for (const auto& candidate : candidates) {
+    checkPrimitive(*mesh, candidate.second);
+  }
+  return not _content.empty();
+}
+
+void FindVoxelContent:: findAll
+(
+  const mesh::PtrMesh&           mesh,
+  std::vector<FindVoxelContent>& queries )
+{
+  logging::Logger _log("query::FindVoxelContent"); // used by TRACE, the member logger is not accessible here
+  TRACE(mesh->getName(), queries.size());
+  if (queries.empty()) {
+    return;
+  }
+
+  // Index of the voxels, to find the voxels touched by a primitive
+  std::vector<std::pair<mesh::AABB, size_t>> voxelBoxes;
+  voxelBoxes.reserve(queries.size());
+  mesh::AABB searchBox = getVoxelBox(queries[0]._voxelCenter, queries[0]._voxelHalflengths);
+  for (size_t i = 0; i < queries.size(); i++) {
+    voxelBoxes.emplace_back(getVoxelBox(queries[i]._voxelCenter, queries[i]._voxelHalflengths), i);
+    boost::geometry::expand(searchBox, voxelBoxes.back().first);
+  }
+  bgi::rtree<std::pair<mesh::AABB, size_t>, bgi::rstar<16>> voxelTree(voxelBoxes);
+
+  // One traversal of the primitive RTree for all voxels, each candidate is checked against the voxels it touches
+  auto tree = mesh::rtree::getPrimitiveRTree(mesh);
+  std::vector<std::pair<mesh::AABB, size_t>> touchedVoxels;
+  tree->query(bgi::intersects(searchBox), boost::make_function_output_iterator(
+    [&](const std::pair<mesh::AABB, mesh::PrimitiveIndex>& candidate) {
+      touchedVoxels.clear();
+      voxelTree.query(bgi::intersects(candidate.first), std::back_inserter(touchedVoxels));
+      for (const auto& voxel : touchedVoxels) {
+        queries[voxel.second].checkPrimitive(*mesh, candidate.second);
+      }
+    }));
+}
+
+void FindVoxelContent::checkPrimitive( mesh::Mesh& mesh, const mesh::PrimitiveIndex& primitive )
+{
+  switch (primitive.type) {
+  case mesh::Primitive::Vertex:
+    checkVertex(mesh.vertices()[primitive.index]);
+    break;
+  case mesh::Primitive::Edge:
+    checkEdge(mesh.edges()[primitive.index]);
+    break;
+  case mesh::Primitive::Triangle:
+    checkTriangle(mesh.triangles()[primitive.index]);
+    break;
+  case mesh::Primitive::Quad:
+    break;
+  }
+}
+
 void FindVoxelContent::checkVertex( mesh::Vertex& vertex )
 {
   TRACE();
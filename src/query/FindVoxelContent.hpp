@@ -1,7 +1,15 @@
 #pragma once
 
 #include "mesh/Group.hpp"
+#include "mesh/SharedPointer.hpp"
 #include <Eigen/Core>
+#include <vector>
+
+namespace precice {
+namespace mesh {
+struct PrimitiveIndex;
+}
+}
 
 namespace precice {
 namespace query {
@@ -38,6 +46,24 @@ public:
   template<typename CONTAINER_T>
   bool operator()( CONTAINER_T& container );
 
+  /**
+   * @brief Performs the find operation on the mesh, using its cached primitive RTree.
+   *
+   * Only the primitives whose bounding boxes intersect the voxel are checked.
+   * The mesh is taken by value, such that this overload is preferred over the container template.
+   */
+  bool operator()( mesh::PtrMesh mesh );
+
+  /**
+   * @brief Performs the find operation of all queries on the mesh.
+   *
+   * The cached primitive RTree is traversed once with the bounding box of all voxels. Each found
+   * primitive is only checked against the voxels whose bounds it touches, found by an RTree of the voxels.
+   */
+  static void findAll(
+    const mesh::PtrMesh&           mesh,
+    std::vector<FindVoxelContent>& queries );
+
   /// Returns voxel center coordinates
   const Eigen::VectorXd& getVoxelCenter() const;
 
@@ -77,6 +103,9 @@ private:
 
   void checkTriangle( mesh::Triangle& triangle );
 
+  /// Calls the check of the primitive type, quads are ignored.
+  void checkPrimitive( mesh::Mesh& mesh, const mesh::PrimitiveIndex& primitive );
+
   /// Returns true, if a plane square and a segment intersect.
   bool computeIntersection(
     const Eigen::Vector3d&  squareCenter,
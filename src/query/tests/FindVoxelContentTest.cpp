@@ -2056,5 +2056,77 @@ BOOST_AUTO_TEST_CASE(QueryCube)
   }
 }
 
+BOOST_AUTO_TEST_CASE(RTreeQueries)
+{
+  // Triangulated tilted plane, queried by a grid of voxels with and without the primitive RTree
+  using namespace mesh;
+  PtrMesh mesh(new Mesh("TestMesh", 3, false));
+  int     n = 6;
+  for (int j = 0; j < n; j++) {
+    for (int i = 0; i < n; i++) {
+      mesh->createVertex(Eigen::Vector3d(i * 0.2, j * 0.2, 0.1 * i + 0.05 * j));
+    }
+  }
+  for (int j = 0; j < n - 1; j++) {
+    for (int i = 0; i < n - 1; i++) {
+      Vertex &v00 = mesh->vertices()[j * n + i];
+      Vertex &v10 = mesh->vertices()[j * n + i + 1];
+      Vertex &v01 = mesh->vertices()[(j + 1) * n + i];
+      Vertex &v11 = mesh->vertices()[(j + 1) * n + i + 1];
+      Edge &  e0  = mesh->createEdge(v00, v10);
+      Edge &  e1  = mesh->createEdge(v10, v11);
+      Edge &  e2  = mesh->createEdge(v11, v00);
+      Edge &  e3  = mesh->createEdge(v11, v01);
+      Edge &  e4  = mesh->createEdge(v01, v00);
+      mesh->createTriangle(e0, e1, e2);
+      mesh->createTriangle(e2, e3, e4);
+    }
+  }
+  mesh->computeState();
+
+  for (auto inclusion : {FindVoxelContent::INCLUDE_BOUNDARY, FindVoxelContent::EXCLUDE_BOUNDARY}) {
+    std::vector<FindVoxelContent> batch;
+    std::vector<FindVoxelContent> single;
+    for (int k = 0; k < 3; k++) {
+      for (int j = 0; j < 4; j++) {
+        for (int i = 0; i < 4; i++) {
+          Eigen::Vector3d  center(0.15 + i * 0.3, 0.15 + j * 0.3, 0.15 + k * 0.3);
+          Eigen::Vector3d  halflengths = Eigen::Vector3d::Constant(0.15);
+          FindVoxelContent bruteForce(center, halflengths, inclusion);
+          FindVoxelContent tree(center, halflengths, inclusion);
+          bruteForce(*mesh);
+          tree(mesh);
+          BOOST_TEST(tree.content().vertices().size() == bruteForce.content().vertices().size());
+          BOOST_TEST(tree.content().edges().size() == bruteForce.content().edges().size());
+          BOOST_TEST(tree.content().triangles().size() == bruteForce.content().triangles().size());
+          single.push_back(tree);
+          batch.emplace_back(center, halflengths, inclusion);
+        }
+      }
+    }
+    // Overlapping voxels of different sizes and a voxel far away from the mesh
+    for (double halflength : {0.05, 0.4, 2.0}) {
+      Eigen::Vector3d center(0.5, 0.5, 0.1);
+      single.emplace_back(center, Eigen::Vector3d::Constant(halflength), inclusion);
+      single.back()(mesh);
+      batch.emplace_back(center, Eigen::Vector3d::Constant(halflength), inclusion);
+    }
+    single.emplace_back(Eigen::Vector3d::Constant(10.0), Eigen::Vector3d::Constant(0.1), inclusion);
+    single.back()(mesh);
+    batch.emplace_back(Eigen::Vector3d::Constant(10.0), Eigen::Vector3d::Constant(0.1), inclusion);
+
+    FindVoxelContent::findAll(mesh, batch);
+    size_t total = 0;
+    for (size_t i = 0; i < batch.size(); i++) {
+      BOOST_TEST(batch[i].content().vertices().size() == single[i].content().vertices().size());
+      BOOST_TEST(batch[i].content().edges().size() == single[i].content().edges().size());
+      BOOST_TEST(batch[i].content().triangles().size() == single[i].content().triangles().size());
+      total += single[i].content().size();
+    }
+    BOOST_TEST(total > 0);
+    BOOST_TEST(batch.back().content().empty());
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END() // FindVoxelContentTests
 BOOST_AUTO_TEST_SUITE_END() // QueryTests
@@ -7,6 +7,7 @@
 #include <iostream>
 #include <iomanip>
 #include <fstream>
+#include <sstream>
 #include <string>
 #include <cstring>
 #include <ctime>
@@ -15,6 +16,7 @@
 #include <chrono>
 #include <utility>
 #include <limits>
+#include <cstdint>
 #ifndef PRECICE_NO_MPI
 #include <mpi.h>
 #endif
@@ -24,6 +26,26 @@
 namespace precice {
 namespace utils {
 
+namespace {
+
+/// Magic bytes and version at the beginning of each trace file
+const char traceMagic[8] = {'P', 'R', 'E', 'C', 'I', 'C', 'E', 'T'};
+const std::int32_t traceVersion = 1;
+
+/// Record types of trace files
+enum TraceRecord : std::uint8_t {
+  TRACE_EVENT_NAME   = 0,
+  TRACE_STATE_CHANGE = 1
+};
+
+template<typename T>
+void writeBinary(std::ostream & out, T value)
+{
+  out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+}
+
 struct MPI_EventData
 {
   char name[255] = {'\0'};
@@ -32,6 +54,62 @@ struct MPI_EventData
   int dataSize = 0, stateChangesSize = 0;
 };
 
+StateChangesBuffer::StateChangesBuffer(size_t capacity)
+  : _capacity(capacity)
+{}
+
+void StateChangesBuffer::push_back(value_type const & stateChange)
+{
+  if (_buffer.size() < _capacity) {
+    _buffer.push_back(stateChange);
+  }
+  else {
+    _buffer[_head] = stateChange;
+    _head = (_head + 1) % _capacity;
+    _dropped++;
+  }
+}
+
+void StateChangesBuffer::insert(StateChangesBuffer const & other)
+{
+  insert(other.get());
+  _dropped += other.dropped();
+}
+
+void StateChangesBuffer::insert(std::vector<value_type> const & stateChanges)
+{
+  for (auto & sc : stateChanges)
+    push_back(sc);
+}
+
+std::vector<StateChangesBuffer::value_type> StateChangesBuffer::get() const
+{
+  std::vector<value_type> ordered;
+  ordered.reserve(_buffer.size());
+  ordered.insert(std::end(ordered), std::begin(_buffer) + _head, std::end(_buffer));
+  ordered.insert(std::end(ordered), std::begin(_buffer), std::begin(_buffer) + _head);
+  return ordered;
+}
+
+size_t StateChangesBuffer::size() const
+{
+  return _buffer.size();
+}
+
+size_t StateChangesBuffer::dropped() const
+{
+  return _dropped;
+}
+
+void StateChangesBuffer::clear()
+{
+  _buffer.clear();
+  _head = 0;
+  _dropped = 0;
+}
+
+// -----------------------------------------------------------------------
+
 Event::Event(std::string eventName, Clock::duration initialDuration)
   : name(EventRegistry::instance().prefix + eventName),
     duration(initialDuration)
@@ -51,6 +129,16 @@ Event::Event(std::string eventName, bool barrier, bool autostart)
   }
 }
 
+Event::Event(int eventID, bool barrier, bool autostart)
+  : _id(eventID),
+    _prefixID(EventRegistry::instance().getPrefixID()),
+    _barrier(barrier)
+{
+  if (autostart) {
+    start(_barrier);
+  }
+}
+
 Event::~Event()
 {
   stop(_barrier);
@@ -62,9 +150,10 @@ void Event::start(bool barrier)
     Parallel::synchronizeProcesses();
     
   state = State::STARTED;
-  stateChanges.push_back(std::make_tuple(State::STARTED, Clock::now()));
   starttime = Clock::now();
-  DEBUG("Started event " << name);
+  stateChanges.push_back(std::make_tuple(State::STARTED, starttime));
+  EventRegistry::instance().traceStateChange(this, State::STARTED, starttime);
+  DEBUG("Started event " << getName());
 }
 
 void Event::stop(bool barrier)
@@ -73,17 +162,18 @@ void Event::stop(bool barrier)
     if (barrier)
       Parallel::synchronizeProcesses();
 
+    auto stoptime = Clock::now();
     if (state == State::STARTED) {
-      auto stoptime = Clock::now();
       duration += Clock::duration(stoptime - starttime);
     }
-    stateChanges.push_back(std::make_tuple(State::STOPPED, Clock::now()));
+    stateChanges.push_back(std::make_tuple(State::STOPPED, stoptime));
+    EventRegistry::instance().traceStateChange(this, State::STOPPED, stoptime);
     state = State::STOPPED;
     EventRegistry::instance().put(this);
     data.clear();
     stateChanges.clear();
     duration = Clock::duration::zero();
-    DEBUG("Stopped event " << name);
+    DEBUG("Stopped event " << getName());
   }
 }
 
@@ -94,10 +184,11 @@ void Event::pause(bool barrier)
       Parallel::synchronizeProcesses();
 
     auto stoptime = Clock::now();
-    stateChanges.push_back(std::make_tuple(State::PAUSED, Clock::now()));
+    stateChanges.push_back(std::make_tuple(State::PAUSED, stoptime));
+    EventRegistry::instance().traceStateChange(this, State::PAUSED, stoptime);
     state = State::PAUSED;
     duration += Clock::duration(stoptime - starttime);
-    DEBUG("Paused event " << name);
+    DEBUG("Paused event " << getName());
   }
 }
 
@@ -106,6 +197,14 @@ Event::Clock::duration Event::getDuration()
   return duration;
 }
 
+std::string Event::getName() const
+{
+  if (_id < 0)
+    return name;
+  auto & registry = EventRegistry::instance();
+  return registry.getPrefix(_prefixID) + registry.getEventName(_id);
+}
+
 // -----------------------------------------------------------------------
 
 EventData::EventData(std::string _name) :
@@ -120,11 +219,12 @@ EventData::EventData(std::string _name, int _rank, long _count, long _total,
      min(std::chrono::milliseconds(_min)),
      total(std::chrono::milliseconds(_total)),
      rank(_rank),
-     stateChanges(_stateChanges),
      name(_name),
      count(_count),
      data(_data)
-{}
+{
+  stateChanges.insert(_stateChanges);
+}
 
 void EventData::put(Event* event)
 {
@@ -134,7 +234,7 @@ void EventData::put(Event* event)
   min = std::min(duration, min);
   max = std::max(duration, max);
   data.insert(std::end(data), std::begin(event->data), std::end(event->data));
-  stateChanges.insert(std::end(stateChanges), std::begin(event->stateChanges), std::end(event->stateChanges));
+  stateChanges.insert(event->stateChanges);
 }
 
 std::string EventData::getName() const
@@ -177,6 +277,11 @@ const std::vector<int> & EventData::getData() const
   return data;
 }
 
+Event::StateChanges EventData::getStateChanges() const
+{
+  return stateChanges.get();
+}
+
 
 void EventData::print(std::ostream &out)
 {
@@ -226,7 +331,7 @@ void EventData::writeEventLog(std::ostream &out)
   std::time_t ts = system_clock::to_time_t(now);
   auto ms = duration_cast<milliseconds>(now.time_since_epoch()) % 1000;
   
-  for (auto & sc : stateChanges) {
+  for (auto & sc : getStateChanges()) {
     out << std::put_time(std::localtime(&ts), "%FT%T") << "." << std::setw(3) << ms.count() << ","
         << EventRegistry::instance().runName << ","
         << name << ","
@@ -249,6 +354,9 @@ void EventRegistry::initialize(std::string appName, std::string run)
 {
   applicationName = appName;
   runName = run;
+
+  if (traceEnabled)
+    openTrace();
   
   globalEvent.start(true);
   initialized = true;
@@ -261,12 +369,25 @@ void EventRegistry::finalize()
   initialized = false;
   for (auto & e : storedEvents)
     e.second.stop();
-  collect();
+
+  if (traceFile.is_open()) {
+    traceFile.close();
+    // Keep the local results on rank 0 for the output, all others are in the trace files
+    globalEvents.insert(std::begin(events), std::end(events));
+    reduceGlobalStats();
+  }
+  else {
+    collect();
+  }
 }
 
 void EventRegistry::clear()
 {
   events.clear();
+  globalEvents.clear();
+  globalStats.clear();
+  for (auto & prefixEvents : eventsByID)
+    std::fill(std::begin(prefixEvents), std::end(prefixEvents), nullptr);
 }
 
 void EventRegistry::signal_handler(int signal)
@@ -279,11 +400,103 @@ void EventRegistry::signal_handler(int signal)
 
 void EventRegistry::put(Event* event)
 {
+  getEventData(event).put(event);
+}
+
+EventData & EventRegistry::getEventData(Event* event)
+{
+  if (event->_id >= 0) {
+    // Registered events resolve their EventData only once per prefix
+    auto & prefixEvents = eventsByID[event->_prefixID];
+    if (prefixEvents.size() <= static_cast<size_t>(event->_id))
+      prefixEvents.resize(eventNames.size(), nullptr);
+    EventData * & data = prefixEvents[event->_id];
+    if (data == nullptr) {
+      auto name = event->getName();
+      data = &std::get<0>(events.emplace(std::piecewise_construct,
+                                         std::forward_as_tuple(name),
+                                         std::forward_as_tuple(name)))->second;
+    }
+    return *data;
+  }
+  
   /// Construct or return EventData object with name as key and name as arg to ctor.
   auto data = std::get<0>(events.emplace(std::piecewise_construct,
                                          std::forward_as_tuple(event->name),
                                          std::forward_as_tuple(event->name)));
-  data->second.put(event);
+  return data->second;
+}
+
+void EventRegistry::openTrace()
+{
+  using namespace std::chrono;
+  int rank = Parallel::getProcessRank();
+  std::string filename = applicationName.empty() ? "Events" : applicationName + "-events";
+  filename += "-" + std::to_string(rank) + ".trace";
+  traceFile.open(filename, std::ios::out | std::ios::binary | std::ios::trunc);
+  traceEventCount = 0;
+
+  // Pairs of steady and system time allow to align the traces of different ranks
+  traceFile.write(traceMagic, sizeof(traceMagic));
+  writeBinary<std::int32_t>(traceFile, traceVersion);
+  writeBinary<std::int32_t>(traceFile, rank);
+  writeBinary<std::int64_t>(traceFile, duration_cast<nanoseconds>(Event::Clock::now().time_since_epoch()).count());
+  writeBinary<std::int64_t>(traceFile, duration_cast<nanoseconds>(system_clock::now().time_since_epoch()).count());
+}
+
+void EventRegistry::traceStateChange(Event* event, EventState state, Event::Clock::time_point time)
+{
+  if (not traceFile.is_open())
+    return;
+
+  auto & data = getEventData(event);
+  if (data.traceID < 0) {
+    data.traceID = traceEventCount++;
+    auto name = data.getName();
+    writeBinary<std::uint8_t>(traceFile, TRACE_EVENT_NAME);
+    writeBinary<std::int32_t>(traceFile, data.traceID);
+    writeBinary<std::uint32_t>(traceFile, name.size());
+    traceFile.write(name.data(), name.size());
+  }
+  writeBinary<std::uint8_t>(traceFile, TRACE_STATE_CHANGE);
+  writeBinary<std::int32_t>(traceFile, data.traceID);
+  writeBinary<std::uint8_t>(traceFile, static_cast<std::uint8_t>(state));
+  writeBinary<std::int64_t>(traceFile,
+                            std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count());
+}
+
+int EventRegistry::registerEvent(std::string const & name)
+{
+  auto insertion = eventIDs.emplace(name, eventNames.size());
+  if (std::get<1>(insertion))
+    eventNames.push_back(name);
+  return std::get<0>(insertion)->second;
+}
+
+std::string const & EventRegistry::getEventName(int eventID) const
+{
+  return eventNames.at(eventID);
+}
+
+void EventRegistry::setPrefix(std::string const & newPrefix)
+{
+  prefix = newPrefix;
+  auto insertion = prefixIDs.emplace(prefix, prefixes.size());
+  if (std::get<1>(insertion)) {
+    prefixes.push_back(prefix);
+    eventsByID.emplace_back();
+  }
+  currentPrefixID = std::get<0>(insertion)->second;
+}
+
+int EventRegistry::getPrefixID() const
+{
+  return currentPrefixID;
+}
+
+std::string const & EventRegistry::getPrefix(int prefixID) const
+{
+  return prefixes.at(prefixID);
 }
 
 Event & EventRegistry::getStoredEvent(std::string const & name)
@@ -292,12 +505,12 @@ Event & EventRegistry::getStoredEvent(std::string const & name)
   // but leads to unexpected results, such as not getting the event you want, because someone else up the
   // stack set a prefix.
   auto previousPrefix = prefix;
-  prefix = "";
+  setPrefix("");
   auto insertion = storedEvents.emplace(std::piecewise_construct,
                                         std::forward_as_tuple(name),
                                         std::forward_as_tuple(name, false, false));
 
-  prefix = previousPrefix;
+  setPrefix(previousPrefix);
   return std::get<0>(insertion)->second;
 }
 
@@ -415,7 +628,8 @@ void EventRegistry::writeEventLogs(std::string filename)
 {
   int rank =  Parallel::getProcessRank();
     
-  if (rank != 0)
+  // When tracing, the state changes have already been written to the trace files
+  if (rank != 0 or traceEnabled)
     return;
   
   bool fileExists = std::ifstream(filename).is_open();
@@ -435,11 +649,11 @@ void EventRegistry::writeEventLogs(std::string filename)
 
 
  
-std::map<std::string, GlobalEventStats> getGlobalStats(GlobalEvents events)
+std::map<std::string, GlobalEventStats> getGlobalStats(GlobalEvents const & events)
 {
   std::map<std::string, GlobalEventStats> globalStats;
   for (auto & e : events) {
-    auto ev = e.second;
+    auto & ev = e.second;
     GlobalEventStats & stats = globalStats[e.first];
     if (ev.max > stats.max) {
       stats.max = ev.max;
@@ -459,8 +673,7 @@ void EventRegistry::printGlobalStats()
       {10, "Max"}, {10, "MaxOnRank"}, {10, "Min"}, {10, "MinOnRank"}, {10, "Min/Max"} });
   t.printHeader();
   
-  auto stats = getGlobalStats(globalEvents);
-  for (auto & e : stats) {
+  for (auto & e : globalStats) {
     auto & ev = e.second;
     double rel = 0;
     if (ev.max != Event::Clock::duration::zero()) // Guard against division by zero
@@ -469,6 +682,11 @@ void EventRegistry::printGlobalStats()
   }
 }
 
+std::map<std::string, GlobalEventStats> const & EventRegistry::getGlobalEventStats() const
+{
+  return globalStats;
+}
+
 
 void EventRegistry::collect()
 {
@@ -506,14 +724,15 @@ void EventRegistry::collect()
     eventSendBuf[i].max = ev.second.getMax();
     eventSendBuf[i].min = ev.second.getMin();
     eventSendBuf[i].dataSize = ev.second.getData().size();
-    eventSendBuf[i].stateChangesSize = ev.second.stateChanges.size();
+    auto stateChanges = ev.second.getStateChanges();
+    eventSendBuf[i].stateChangesSize = stateChanges.size();
     
     int packSize = 0, pSize = 0;
     // int packSize = sizeof(int) * ev.second.getData().size() +
       // sizeof(Event::StateChanges::value_type) * ev.second.stateChanges.size();
     MPI_Pack_size(ev.second.getData().size(), MPI_INT, Parallel::getGlobalCommunicator(), &pSize);
     packSize += pSize;
-    MPI_Pack_size(ev.second.stateChanges.size() * sizeof(Event::StateChanges::value_type),
+    MPI_Pack_size(stateChanges.size() * sizeof(Event::StateChanges::value_type),
                   MPI_BYTE, Parallel::getGlobalCommunicator(), &pSize);
     packSize += pSize;
     
@@ -521,8 +740,8 @@ void EventRegistry::collect()
     int position = 0;
     MPI_Pack(const_cast<int*>(ev.second.getData().data()), ev.second.getData().size(),
              MPI_INT, packSendBuf[i].get(), packSize, &position, Parallel::getGlobalCommunicator());
-    MPI_Pack(const_cast<Event::StateChanges::pointer>(ev.second.stateChanges.data()),
-             ev.second.stateChanges.size() * sizeof(Event::StateChanges::value_type),
+    MPI_Pack(stateChanges.data(),
+             stateChanges.size() * sizeof(Event::StateChanges::value_type),
              MPI_BYTE, packSendBuf[i].get(), packSize, &position, Parallel::getGlobalCommunicator());
 
     MPI_Isend(&eventSendBuf[i], 1, MPI_EVENTDATA, 0, 0, Parallel::getGlobalCommunicator(), &req);
@@ -561,6 +780,66 @@ void EventRegistry::collect()
   }    
   MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
   MPI_Type_free(&MPI_EVENTDATA);
+  #else
+  globalEvents.insert(std::begin(events), std::end(events));
+  #endif
+  globalStats = getGlobalStats(globalEvents);
+}
+
+void EventRegistry::reduceGlobalStats()
+{
+  globalStats = getGlobalStats(globalEvents);
+  #ifndef PRECICE_NO_MPI
+  auto comm = Parallel::getGlobalCommunicator();
+  int rank;
+  MPI_Comm_rank(comm, &rank);
+
+  // Broadcast the event names of rank 0, newline separated
+  std::string names;
+  if (rank == 0) {
+    for (const auto & ev : events)
+      names += ev.first + "\n";
+  }
+  int namesSize = names.size();
+  MPI_Bcast(&namesSize, 1, MPI_INT, 0, comm);
+  names.resize(namesSize);
+  MPI_Bcast(&names[0], namesSize, MPI_CHAR, 0, comm);
+
+  std::vector<std::string> eventNames;
+  std::istringstream namesStream(names);
+  for (std::string name; std::getline(namesStream, name); )
+    eventNames.push_back(name);
+
+  // Layout of MPI_LONG_INT
+  struct LongInt {
+    long value;
+    int rank;
+  };
+  std::vector<LongInt> localMax(eventNames.size()), localMin(eventNames.size());
+  for (size_t i = 0; i < eventNames.size(); ++i) {
+    auto ev = events.find(eventNames[i]);
+    if (ev == events.end()) {
+      localMax[i] = {std::numeric_limits<long>::min(), rank};
+      localMin[i] = {std::numeric_limits<long>::max(), rank};
+    }
+    else {
+      localMax[i] = {static_cast<long>(ev->second.max.count()), rank};
+      localMin[i] = {static_cast<long>(ev->second.min.count()), rank};
+    }
+  }
+  std::vector<LongInt> globalMax(eventNames.size()), globalMin(eventNames.size());
+  MPI_Reduce(localMax.data(), globalMax.data(), eventNames.size(), MPI_LONG_INT, MPI_MAXLOC, 0, comm);
+  MPI_Reduce(localMin.data(), globalMin.data(), eventNames.size(), MPI_LONG_INT, MPI_MINLOC, 0, comm);
+
+  if (rank == 0) {
+    for (size_t i = 0; i < eventNames.size(); ++i) {
+      GlobalEventStats & stats = globalStats[eventNames[i]];
+      stats.max     = Event::Clock::duration(globalMax[i].value);
+      stats.maxRank = globalMax[i].rank;
+      stats.min     = Event::Clock::duration(globalMin[i].value);
+      stats.minRank = globalMin[i].rank;
+    }
+  }
   #endif
 }
 
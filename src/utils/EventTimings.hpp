@@ -1,6 +1,8 @@
 #pragma once
 
 #include <chrono>
+#include <fstream>
+#include <tuple>
 #include <list>
 #include <map>
 #include <vector>
@@ -10,6 +12,56 @@
 namespace precice {
 namespace utils {
 
+enum class EventState {
+  STOPPED = 0,
+  STARTED = 1,
+  PAUSED  = 2,
+};
+
+using EventClock = std::chrono::steady_clock;
+
+/// Fixed-capacity ring buffer of state changes, only the most recent ones are kept.
+class StateChangesBuffer
+{
+public:
+  using value_type = std::tuple<EventState, EventClock::time_point>;
+
+  /// Default number of state changes stored per buffer.
+  static constexpr size_t defaultCapacity = 1024;
+
+  explicit StateChangesBuffer(size_t capacity = defaultCapacity);
+
+  /// Appends a state change, overwriting the oldest one if the buffer is full.
+  void push_back(value_type const & stateChange);
+
+  /// Appends all state changes of other, in chronological order.
+  void insert(StateChangesBuffer const & other);
+
+  /// Appends all state changes of a chronologically ordered vector.
+  void insert(std::vector<value_type> const & stateChanges);
+
+  /// Returns the stored state changes in chronological order.
+  std::vector<value_type> get() const;
+
+  /// Number of stored state changes.
+  size_t size() const;
+
+  /// Number of state changes that were overwritten since the last clear.
+  size_t dropped() const;
+
+  void clear();
+
+private:
+  std::vector<value_type> _buffer;
+
+  size_t _capacity;
+
+  /// Position of the oldest state change, once the buffer is full.
+  size_t _head = 0;
+
+  size_t _dropped = 0;
+};
+
 /// Represents an event that can be started and stopped.
 /** Additionally to the duration there is a special property that can be set for a event.
 A property is a a key-value pair with a numerical value that can be used to trace certain events,
@@ -18,16 +70,12 @@ class Event
 {
 public:
   
-  enum class State {
-    STOPPED = 0,
-    STARTED = 1,
-    PAUSED  = 2,
-  };
+  using State = EventState;
 
   /// Default clock type. All other chrono types are derived from it.
-  using Clock = std::chrono::steady_clock;
+  using Clock = EventClock;
 
-  using StateChanges = std::vector<std::tuple<State, Clock::time_point>>;
+  using StateChanges = std::vector<StateChangesBuffer::value_type>;
     
   /// An Event can't be copied.
   Event(const Event & other) = delete;
@@ -42,6 +90,10 @@ public:
   /** Use barrier == true with caution, as it can lead to deadlocks. */
   Event(std::string eventName, bool barrier = false, bool autostart = true);
 
+  /// Creates a new event from a handle obtained by EventRegistry::registerEvent.
+  /** This avoids building and looking up the event name, use it for events on hot paths. */
+  Event(int eventID, bool barrier = false, bool autostart = true);
+
   /// Stops the event if it's running and report its times to the EventRegistry
   ~Event();
 
@@ -57,12 +109,23 @@ public:
   /// Gets the duration of the event.
   Clock::duration getDuration();
 
+  /// Returns the name of the event, including the prefix.
+  std::string getName() const;
+
   std::vector<int> data;
 
-  StateChanges stateChanges;
+  StateChangesBuffer stateChanges;
 
 private:
-  
+  friend class EventRegistry;
+
+  /// Handle given by EventRegistry::registerEvent, -1 for events identified by name.
+  int _id = -1;
+
+  /// Handle of the prefix that was active when the event was created.
+  int _prefixID = -1;
+
+
   Clock::time_point starttime;
   // Clock::time_point stoptime;
   Clock::duration duration = Clock::duration::zero();
@@ -108,6 +171,9 @@ public:
 
   const std::vector<int> & getData() const;
 
+  /// Returns the most recent state changes in chronological order.
+  Event::StateChanges getStateChanges() const;
+
   void print(std::ostream &out);
 
   void writeCSV(std::ostream &out);
@@ -119,7 +185,11 @@ public:
   Event::Clock::duration total = Event::Clock::duration::zero();
   
   int rank;
-  Event::StateChanges stateChanges;
+  
+  StateChangesBuffer stateChanges;
+
+  /// Identifier of this event in the trace file, -1 if not yet written.
+  int traceID = -1;
   
 private:
   std::string name;
@@ -164,6 +234,9 @@ public:
   /// Sets the global end time
   void finalize();
 
+  /// Writes a state change of an event to the trace file of this rank, if tracing is enabled.
+  void traceStateChange(Event* event, EventState state, Event::Clock::time_point time);
+
   /// Clears the registry. needed for tests
   void clear();
 
@@ -173,6 +246,22 @@ public:
   /// Records the event.
   void put(Event* event);
 
+  /// Registers an event name and returns a handle to create events without name lookups.
+  /** The prefix is not part of the registered name, but applied when an event is created. */
+  int registerEvent(std::string const & name);
+
+  /// Returns the registered name of an event handle.
+  std::string const & getEventName(int eventID) const;
+
+  /// Sets the prefix that is applied to newly created events.
+  void setPrefix(std::string const & newPrefix);
+
+  /// Returns a handle for the currently active prefix.
+  int getPrefixID() const;
+
+  /// Returns the prefix of a prefix handle.
+  std::string const & getPrefix(int prefixID) const;
+
   /// Make this returning a reference or smart ptr?
   Event & getStoredEvent(std::string const & name);
 
@@ -198,20 +287,40 @@ public:
   
   void printGlobalStats();
 
-  /// Currently active prefix. Changing that applies to newly created events.
+  /// Returns the statistics over all ranks per event name, valid on rank 0 after finalize.
+  std::map<std::string, GlobalEventStats> const & getGlobalEventStats() const;
+
+  /// Currently active prefix. Use setPrefix to change it, which applies to newly created events.
   std::string prefix;
   
   /// A name that is added to the logfile to identify a run
   std::string runName;
 
+  /// Stream all state changes to a binary trace file per rank, instead of gathering them on rank 0.
+  /** Needs to be set before initialize. Only the global statistics are then reduced at finalize.
+      Use tools/mergeEventTraces.py to merge the trace files of all ranks. */
+  bool traceEnabled = false;
+
 private:
   /// Private, empty constructor for singleton pattern
   EventRegistry()
     : globalEvent("_GLOBAL", true, false) // Unstarted, it's started in initialize
-  {}
+  {
+    setPrefix("");
+  }
   
   /// Gather EventData from all ranks on rank 0.
   void collect();
+
+  /// Reduce the global statistics of all events known on rank 0, used when tracing.
+  /** Events which do not occur on rank 0 are only contained in the trace files. */
+  void reduceGlobalStats();
+
+  /// Returns the EventData an event is recorded to, creates it if necessary.
+  EventData & getEventData(Event* event);
+
+  /// Opens the trace file of this rank and writes its header.
+  void openTrace();
   
   /// Returns length of longest name
   size_t getMaxNameWidth();
@@ -229,9 +338,35 @@ private:
 
   std::map<std::string, Event> storedEvents;
 
+  /// Names of registered events, indexed by handle
+  std::vector<std::string> eventNames;
+
+  /// Handles of registered event names
+  std::map<std::string, int> eventIDs;
+
+  /// Prefixes that have been in use, indexed by handle
+  std::vector<std::string> prefixes;
+
+  /// Handles of prefixes
+  std::map<std::string, int> prefixIDs;
+
+  int currentPrefixID = -1;
+
+  /// EventData of registered events per prefix handle and event handle, resolved on first use
+  std::vector<std::vector<EventData*>> eventsByID;
+
   /// Multimap of name -> EventData of events for all ranks
   GlobalEvents globalEvents;
 
+  /// Map of name -> statistics over all ranks, valid on rank 0 after finalize
+  std::map<std::string, GlobalEventStats> globalStats;
+
+  /// Binary trace file of this rank, if tracing is enabled
+  std::ofstream traceFile;
+
+  /// Number of events written to the trace file
+  int traceEventCount = 0;
+
   /// A name that is added to the logfile to distinguish different participants
   std::string applicationName;
 };
@@ -245,12 +380,12 @@ public:
   ScopedEventPrefix(const std::string & name)
   {
     previousName = EventRegistry::instance().prefix;
-    EventRegistry::instance().prefix += name;
+    EventRegistry::instance().setPrefix(previousName + name);
   }
 
   ~ScopedEventPrefix()
   {
-    EventRegistry::instance().prefix = previousName;
+    EventRegistry::instance().setPrefix(previousName);
   }
   
 private:
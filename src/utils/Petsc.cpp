@@ -476,6 +476,15 @@ bool KSPSolver::solve(Vector &b, Vector &x)
   return (convReason > 0);
 }
 
+PetscInt KSPSolver::getIterationNumber()
+{
+  PetscErrorCode ierr = 0;
+  PetscInt its = 0;
+  // Aborts on error, the return value cannot carry an error code
+  ierr = KSPGetIterationNumber(ksp, &its); CHKERRABORT(PetscObjectComm(reinterpret_cast<PetscObject>(ksp)), ierr);
+  return its;
+}
+
 
 /////////////////////////////////////////////////////////////////////////
 
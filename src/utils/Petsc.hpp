@@ -219,6 +219,9 @@ public:
 
   /// Solves the linear system, returns false it not converged
   bool solve(Vector &b, Vector &x);
+
+  /// Returns the number of iterations of the last solve
+  PetscInt getIterationNumber();
 };
 
 
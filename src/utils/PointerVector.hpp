@@ -100,6 +100,18 @@ public:
      return *_content.back();
    }
 
+   /// Reserves memory for at least the given number of elements.
+   void reserve ( size_t count )
+   {
+      _content.reserve ( count );
+   }
+
+   /// Returns the number of elements memory is reserved for.
+   size_t capacity () const
+   {
+      return _content.capacity ();
+   }
+
    /**
     * @brief Adds element to the end of the vector.
     */
@@ -0,0 +1,139 @@
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <thread>
+#include "testing/Testing.hpp"
+#include "utils/EventTimings.hpp"
+#include "utils/Parallel.hpp"
+
+using namespace precice::utils;
+
+namespace {
+template<typename T>
+T readBinary(std::string const & content, size_t & pos)
+{
+  T value;
+  BOOST_REQUIRE(pos + sizeof(T) <= content.size());
+  std::copy(content.data() + pos, content.data() + pos + sizeof(T), reinterpret_cast<char*>(&value));
+  pos += sizeof(T);
+  return value;
+}
+}
+
+BOOST_AUTO_TEST_SUITE(UtilsTests)
+BOOST_AUTO_TEST_SUITE(EventTimingsTests)
+
+BOOST_AUTO_TEST_CASE(StateChangesRingBuffer)
+{
+  StateChangesBuffer buffer(3);
+  auto now = EventClock::now();
+  for (int i = 0; i < 5; ++i) {
+    buffer.push_back(std::make_tuple(EventState::STARTED, now + std::chrono::seconds(i)));
+  }
+  BOOST_TEST(buffer.size() == 3);
+  BOOST_TEST(buffer.dropped() == 2);
+
+  // Oldest entries are overwritten, the remaining ones are returned in order
+  auto ordered = buffer.get();
+  BOOST_TEST(ordered.size() == 3);
+  for (int i = 0; i < 3; ++i) {
+    BOOST_TEST((std::get<1>(ordered[i]) == now + std::chrono::seconds(i + 2)));
+  }
+
+  buffer.clear();
+  BOOST_TEST(buffer.size() == 0);
+  BOOST_TEST(buffer.dropped() == 0);
+}
+
+BOOST_AUTO_TEST_CASE(RegisteredEvents)
+{
+  auto & registry = EventRegistry::instance();
+  int id = registry.registerEvent("test.registered");
+  BOOST_TEST(registry.registerEvent("test.registered") == id);
+  BOOST_TEST(registry.getEventName(id) == "test.registered");
+  {
+    ScopedEventPrefix prefix("scope/");
+    Event e(id);
+    BOOST_TEST(e.getName() == "scope/test.registered");
+  }
+  Event e(id);
+  BOOST_TEST(e.getName() == "test.registered");
+}
+
+/// Runs on all ranks, since the statistics are reduced over all of them.
+BOOST_AUTO_TEST_CASE(TraceFileAndGlobalStats)
+{
+  const int rank = Parallel::getProcessRank();
+  const int size = Parallel::getCommunicatorSize();
+  auto & registry = EventRegistry::instance();
+  registry.clear();
+  registry.traceEnabled = true;
+  registry.initialize("TraceTest");
+  {
+    // Durations increase with the rank
+    Event e("trace.test");
+    e.pause();
+    e.start();
+    std::this_thread::sleep_for(std::chrono::milliseconds(5 * (rank + 1)));
+    e.stop();
+    if (rank != 0) {
+      Event other("trace.notOnMaster");
+    }
+  }
+  registry.finalize();
+  registry.traceEnabled = false;
+
+  if (rank == 0) {
+    auto & stats = registry.getGlobalEventStats();
+    BOOST_TEST(stats.count("trace.notOnMaster") == 0);
+    BOOST_REQUIRE(stats.count("trace.test") == 1);
+    auto & traceStats = stats.at("trace.test");
+    BOOST_TEST(traceStats.minRank == 0);
+    BOOST_TEST(traceStats.maxRank == size - 1);
+    BOOST_TEST((traceStats.min <= traceStats.max));
+    BOOST_TEST((traceStats.min >= std::chrono::milliseconds(5)));
+  }
+
+  // Header, then name and state change records in the order of occurrence
+  std::string filename = "TraceTest-events-" + std::to_string(rank) + ".trace";
+  std::ifstream file(filename, std::ios::binary);
+  BOOST_REQUIRE(file.is_open());
+  std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+  file.close();
+  std::remove(filename.c_str());
+
+  BOOST_REQUIRE(content.size() > 8);
+  BOOST_TEST(content.substr(0, 8) == "PRECICET");
+  size_t pos = 8;
+  BOOST_TEST(readBinary<std::int32_t>(content, pos) == 1);
+  BOOST_TEST(readBinary<std::int32_t>(content, pos) == rank);
+  readBinary<std::int64_t>(content, pos);
+  readBinary<std::int64_t>(content, pos);
+
+  std::map<int, std::string> names;
+  std::vector<EventState> states;
+  while (pos < content.size()) {
+    auto type = readBinary<std::uint8_t>(content, pos);
+    auto id   = readBinary<std::int32_t>(content, pos);
+    if (type == 0) {
+      auto length = readBinary<std::uint32_t>(content, pos);
+      BOOST_TEST(names.count(id) == 0);
+      names[id] = content.substr(pos, length);
+      pos += length;
+    } else {
+      BOOST_REQUIRE(type == 1);
+      BOOST_REQUIRE(names.count(id) == 1);
+      auto state = static_cast<EventState>(readBinary<std::uint8_t>(content, pos));
+      readBinary<std::int64_t>(content, pos);
+      if (names[id] == "trace.test")
+        states.push_back(state);
+    }
+  }
+  std::vector<EventState> expected{EventState::STARTED, EventState::PAUSED, EventState::STARTED, EventState::STOPPED};
+  BOOST_TEST((states == expected));
+  registry.clear();
+}
+
+BOOST_AUTO_TEST_SUITE_END() // EventTimingsTests
+BOOST_AUTO_TEST_SUITE_END() // UtilsTests
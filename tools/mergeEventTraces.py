@@ -0,0 +1,85 @@
+#!env python3
+""" Merges the binary per-rank trace files written with event-trace enabled into a single
+Chrome trace file, which can be viewed using chrome://tracing or https://ui.perfetto.dev """
+
+import argparse, glob, json, struct, sys
+
+parser = argparse.ArgumentParser(formatter_class=argparse.ArgumentDefaultsHelpFormatter,
+                                 description = "Merge event trace files of all ranks")
+parser.add_argument('files', nargs = '*', help = "Trace files to merge", default = glob.glob("*.trace"))
+parser.add_argument('--output', help = "File name of merged trace", type = str, default = "trace.json")
+
+MAGIC = b"PRECICET"
+VERSION = 1
+EVENT_NAME, STATE_CHANGE = 0, 1
+STOPPED, STARTED, PAUSED = 0, 1, 2
+
+
+def readTrace(filename):
+    """ Returns the rank and a list of (name, state, system time in ns) of a trace file. """
+    with open(filename, "rb") as f:
+        content = f.read()
+
+    if content[:8] != MAGIC:
+        sys.exit("File {} is not a preCICE trace file.".format(filename))
+    version, rank, steadyStart, systemStart = struct.unpack_from("<iiqq", content, 8)
+    if version != VERSION:
+        sys.exit("File {} has unsupported version {}.".format(filename, version))
+
+    names = {}
+    stateChanges = []
+    pos = 8 + struct.calcsize("<iiqq")
+    while pos < len(content):
+        recordType, eventID = struct.unpack_from("<Bi", content, pos)
+        pos += struct.calcsize("<Bi")
+        if recordType == EVENT_NAME:
+            length, = struct.unpack_from("<I", content, pos)
+            pos += struct.calcsize("<I")
+            names[eventID] = content[pos:pos + length].decode()
+            pos += length
+        elif recordType == STATE_CHANGE:
+            state, timestamp = struct.unpack_from("<Bq", content, pos)
+            pos += struct.calcsize("<Bq")
+            # Steady clocks are not comparable between nodes, use the system clock instead
+            stateChanges.append((names[eventID], state, systemStart + timestamp - steadyStart))
+        else:
+            sys.exit("File {} is corrupted at byte {}.".format(filename, pos))
+
+    return rank, stateChanges
+
+
+def main():
+    args = parser.parse_args()
+    if not args.files:
+        parser.print_help()
+        sys.exit(1)
+
+    traces = [readTrace(filename) for filename in args.files]
+    start = min(sc[2] for rank, stateChanges in traces for sc in stateChanges)
+
+    events = []
+    for rank, stateChanges in traces:
+        # An event is running only between STARTED and the next PAUSED or STOPPED. Only the
+        # transitions into and out of STARTED are emitted, so that "B" and "E" stay balanced.
+        running = set()
+        for name, state, timestamp in stateChanges:
+            if state == STARTED and name not in running:
+                running.add(name)
+                phase = "B"
+            elif state != STARTED and name in running:
+                running.remove(name)
+                phase = "E"
+            else:
+                continue
+            events.append({"name" : name,
+                           "ph"   : phase,
+                           "ts"   : (timestamp - start) / 1000.0, # Chrome traces use microseconds
+                           "pid"  : rank,
+                           "tid"  : 0})
+
+    with open(args.output, "w") as f:
+        json.dump({"traceEvents" : events, "displayTimeUnit" : "ms"}, f)
+
+
+if __name__ == "__main__":
+    main()